@@ -0,0 +1,124 @@
+#include "nd_array/nd_array.hpp"
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace cppa;
+
+// Element access: checked operator(), unchecked() and a raw nested loop over the same buffer
+
+static void bm_access_checked_2d( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> arr( n, n );
+	arr.fill( 1.0f );
+	for( auto _: t_state )
+	{
+		float sum = 0.0f;
+		for( size_t i = 0; i < n; ++i )
+		{
+			for( size_t j = 0; j < n; ++j )
+			{
+				sum += arr( i, j );
+			}
+		}
+		benchmark::DoNotOptimize( sum );
+	}
+	t_state.SetItemsProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n ) );
+}
+BENCHMARK( bm_access_checked_2d )->RangeMultiplier( 4 )->Range( 64, 4096 );
+
+static void bm_access_unchecked_2d( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> arr( n, n );
+	arr.fill( 1.0f );
+	for( auto _: t_state )
+	{
+		float sum = 0.0f;
+		for( size_t i = 0; i < n; ++i )
+		{
+			for( size_t j = 0; j < n; ++j )
+			{
+				sum += arr.unchecked( i, j );
+			}
+		}
+		benchmark::DoNotOptimize( sum );
+	}
+	t_state.SetItemsProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n ) );
+}
+BENCHMARK( bm_access_unchecked_2d )->RangeMultiplier( 4 )->Range( 64, 4096 );
+
+static void bm_access_raw_2d( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	std::vector<float> data( n * n, 1.0f );
+	for( auto _: t_state )
+	{
+		float sum = 0.0f;
+		for( size_t i = 0; i < n; ++i )
+		{
+			for( size_t j = 0; j < n; ++j )
+			{
+				sum += data[i * n + j];
+			}
+		}
+		benchmark::DoNotOptimize( sum );
+	}
+	t_state.SetItemsProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n ) );
+}
+BENCHMARK( bm_access_raw_2d )->RangeMultiplier( 4 )->Range( 64, 4096 );
+
+static void bm_access_checked_4d( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> arr( n, n, n, n );
+	arr.fill( 1.0f );
+	for( auto _: t_state )
+	{
+		float sum = 0.0f;
+		for( size_t i = 0; i < n; ++i )
+		{
+			for( size_t j = 0; j < n; ++j )
+			{
+				for( size_t k = 0; k < n; ++k )
+				{
+					for( size_t l = 0; l < n; ++l )
+					{
+						sum += arr( i, j, k, l );
+					}
+				}
+			}
+		}
+		benchmark::DoNotOptimize( sum );
+	}
+	t_state.SetItemsProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * n * n ) );
+}
+BENCHMARK( bm_access_checked_4d )->Arg( 8 )->Arg( 32 );
+
+static void bm_access_unchecked_4d( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> arr( n, n, n, n );
+	arr.fill( 1.0f );
+	for( auto _: t_state )
+	{
+		float sum = 0.0f;
+		for( size_t i = 0; i < n; ++i )
+		{
+			for( size_t j = 0; j < n; ++j )
+			{
+				for( size_t k = 0; k < n; ++k )
+				{
+					for( size_t l = 0; l < n; ++l )
+					{
+						sum += arr.unchecked( i, j, k, l );
+					}
+				}
+			}
+		}
+		benchmark::DoNotOptimize( sum );
+	}
+	t_state.SetItemsProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * n * n ) );
+}
+BENCHMARK( bm_access_unchecked_4d )->Arg( 8 )->Arg( 32 );
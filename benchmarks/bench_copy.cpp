@@ -0,0 +1,151 @@
+#include "nd_array/nd_array.hpp"
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace cppa;
+
+// Construction, copies, from_span materialization and view creation
+
+static void bm_construct_zeroed( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	for( auto _: t_state )
+	{
+		nd_array<float> arr( n, n );
+		benchmark::DoNotOptimize( arr.data( ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_construct_zeroed )->RangeMultiplier( 8 )->Range( 64, 4096 );
+
+static void bm_construct_uninitialized( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	for( auto _: t_state )
+	{
+		nd_array<float> arr( uninitialized, n, n );
+		benchmark::DoNotOptimize( arr.data( ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_construct_uninitialized )->RangeMultiplier( 8 )->Range( 64, 4096 );
+
+static void bm_construct_rank( benchmark::State& t_state )
+{
+	// Same element count (2^20) spread over rank 1, 2, 4 and 5
+	const auto rank = static_cast<size_t>( t_state.range( 0 ) );
+	for( auto _: t_state )
+	{
+		switch( rank )
+		{
+			case 1: benchmark::DoNotOptimize( nd_array<float>( 1048576 ).data( ) ); break;
+			case 2: benchmark::DoNotOptimize( nd_array<float>( 1024, 1024 ).data( ) ); break;
+			case 4: benchmark::DoNotOptimize( nd_array<float>( 32, 32, 32, 32 ).data( ) ); break;
+			default: benchmark::DoNotOptimize( nd_array<float>( 16, 16, 16, 16, 16 ).data( ) ); break;
+		}
+	}
+}
+BENCHMARK( bm_construct_rank )->Arg( 1 )->Arg( 2 )->Arg( 4 )->Arg( 5 );
+
+static void bm_copy_construct( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> src( n, n );
+	for( auto _: t_state )
+	{
+		nd_array<float> copy( src );
+		benchmark::DoNotOptimize( copy.data( ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_copy_construct )->RangeMultiplier( 8 )->Range( 64, 4096 );
+
+static void bm_copy_assign( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> src( n, n );
+	nd_array<float> dst( n, n );
+	for( auto _: t_state )
+	{
+		dst = src;
+		benchmark::DoNotOptimize( dst.data( ) );
+		benchmark::ClobberMemory( );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_copy_assign )->RangeMultiplier( 8 )->Range( 64, 4096 );
+
+static void bm_copy_raw( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	std::vector<float> src( n * n );
+	for( auto _: t_state )
+	{
+		std::vector<float> copy( src );
+		benchmark::DoNotOptimize( copy.data( ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_copy_raw )->RangeMultiplier( 8 )->Range( 64, 4096 );
+
+static void bm_from_span_subspan( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> src( n, n );
+	const auto view = src.subspan( 1, { 1, n - 1 } );
+	for( auto _: t_state )
+	{
+		auto copy = nd_array<float>::from_span( view );
+		benchmark::DoNotOptimize( copy.data( ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * view.size( ) * sizeof( float ) ) );
+}
+BENCHMARK( bm_from_span_subspan )->RangeMultiplier( 8 )->Range( 64, 4096 );
+
+static void bm_from_span_transposed( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> src( n, n );
+	for( auto _: t_state )
+	{
+		auto copy = src.transpose_copy( );
+		benchmark::DoNotOptimize( copy.data( ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_from_span_transposed )->RangeMultiplier( 8 )->Range( 64, 4096 );
+
+static void bm_transpose_raw( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	std::vector<float> src( n * n );
+	std::vector<float> dst( n * n );
+	for( auto _: t_state )
+	{
+		for( size_t i = 0; i < n; ++i )
+		{
+			for( size_t j = 0; j < n; ++j )
+			{
+				dst[i * n + j] = src[j * n + i];
+			}
+		}
+		benchmark::DoNotOptimize( dst.data( ) );
+		benchmark::ClobberMemory( );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_transpose_raw )->RangeMultiplier( 8 )->Range( 64, 4096 );
+
+static void bm_view_creation( benchmark::State& t_state )
+{
+	nd_array<float> arr( 16, 32, 64 );
+	for( auto _: t_state )
+	{
+		benchmark::DoNotOptimize( arr.reshape( 512, 64 ) );
+		benchmark::DoNotOptimize( arr.transpose( { 2, 0, 1 } ) );
+		benchmark::DoNotOptimize( arr.subspan( 1, { 4, 12 } ) );
+		benchmark::DoNotOptimize( arr.slice( 0, 3 ) );
+	}
+}
+BENCHMARK( bm_view_creation );
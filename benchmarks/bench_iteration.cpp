@@ -0,0 +1,157 @@
+#include "nd_array/nd_array.hpp"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <numeric>
+#include <vector>
+
+using namespace cppa;
+
+// Traversal of contiguous, transposed and sliced views through nd_iterator, compared with raw loops
+
+namespace
+{
+	template<typename View>
+	float iterate_sum( const View& t_view )
+	{
+		float sum = 0.0f;
+		for( const float value: t_view )
+		{
+			sum += value;
+		}
+		return sum;
+	}
+} // namespace
+
+static void bm_iterate_contiguous( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> arr( n, n );
+	arr.fill( 1.0f );
+	const auto view = arr.as_span( );
+	for( auto _: t_state )
+	{
+		benchmark::DoNotOptimize( iterate_sum( view ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_iterate_contiguous )->RangeMultiplier( 4 )->Range( 64, 4096 );
+
+static void bm_iterate_transposed( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> arr( n, n );
+	arr.fill( 1.0f );
+	const auto view = arr.T( );
+	for( auto _: t_state )
+	{
+		benchmark::DoNotOptimize( iterate_sum( view ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_iterate_transposed )->RangeMultiplier( 4 )->Range( 64, 4096 );
+
+static void bm_iterate_transposed_memory_order( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> arr( n, n );
+	arr.fill( 1.0f );
+	const auto view = arr.T( );
+	for( auto _: t_state )
+	{
+		float sum = 0.0f;
+		view.for_each_in_memory_order( [&sum]( const float t_value ) { sum += t_value; } );
+		benchmark::DoNotOptimize( sum );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_iterate_transposed_memory_order )->RangeMultiplier( 4 )->Range( 64, 4096 );
+
+static void bm_iterate_sliced( benchmark::State& t_state )
+{
+	// Second quarter of the columns: short unit-stride rows separated by gaps
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> arr( n, n );
+	arr.fill( 1.0f );
+	const auto view = arr.subspan( 1, { n / 4, n / 2 } );
+	for( auto _: t_state )
+	{
+		benchmark::DoNotOptimize( iterate_sum( view ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * view.size( ) * sizeof( float ) ) );
+}
+BENCHMARK( bm_iterate_sliced )->RangeMultiplier( 4 )->Range( 64, 4096 );
+
+static void bm_iterate_raw_contiguous( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	std::vector<float> data( n * n, 1.0f );
+	for( auto _: t_state )
+	{
+		benchmark::DoNotOptimize( std::accumulate( data.begin( ), data.end( ), 0.0f ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_iterate_raw_contiguous )->RangeMultiplier( 4 )->Range( 64, 4096 );
+
+static void bm_iterate_raw_transposed( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	std::vector<float> data( n * n, 1.0f );
+	for( auto _: t_state )
+	{
+		float sum = 0.0f;
+		for( size_t j = 0; j < n; ++j )
+		{
+			for( size_t i = 0; i < n; ++i )
+			{
+				sum += data[i * n + j];
+			}
+		}
+		benchmark::DoNotOptimize( sum );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_iterate_raw_transposed )->RangeMultiplier( 4 )->Range( 64, 4096 );
+
+// A standard algorithm over a contiguous view, through nd_iterator and through the raw pointers of with_iterators
+static void bm_transform_iterators( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> arr( n, n );
+	auto view = arr.as_span( );
+	for( auto _: t_state )
+	{
+		std::transform( view.begin( ), view.end( ), view.begin( ), []( float t_x ) { return t_x * 0.5f + 1.0f; } );
+		benchmark::DoNotOptimize( arr.data( ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_transform_iterators )->RangeMultiplier( 4 )->Range( 64, 1024 );
+
+static void bm_transform_with_iterators( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> arr( n, n );
+	auto view = arr.as_span( );
+	for( auto _: t_state )
+	{
+		view.with_iterators( []( auto t_first, auto t_last ) { std::transform( t_first, t_last, t_first, []( float t_x ) { return t_x * 0.5f + 1.0f; } ); } );
+		benchmark::DoNotOptimize( arr.data( ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_transform_with_iterators )->RangeMultiplier( 4 )->Range( 64, 1024 );
+
+static void bm_reduce_parallel( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> arr( n, n );
+	arr.fill( 1.0f );
+	for( auto _: t_state )
+	{
+		benchmark::DoNotOptimize( arr.reduce( par, 0.0f, std::plus<>( ) ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_reduce_parallel )->RangeMultiplier( 4 )->Range( 256, 4096 )->UseRealTime( );
@@ -0,0 +1,143 @@
+#include "nd_array/nd_linalg.hpp"
+
+#include <benchmark/benchmark.h>
+
+using namespace cppa;
+
+// Matrix products through matmul/matvec, compared with the triple loop over operator() they replace
+
+static void set_flops( benchmark::State& t_state, size_t t_n )
+{
+	t_state.counters["flops"] = benchmark::Counter( static_cast<double>( t_state.iterations( ) ) * 2.0 * static_cast<double>( t_n * t_n * t_n ), benchmark::Counter::kIsRate );
+}
+
+static void bm_matmul( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> a( n, n );
+	nd_array<float> b( n, n );
+	nd_array<float> c( n, n );
+	a.fill( 1.0f );
+	b.fill( 0.5f );
+	for( auto _: t_state )
+	{
+		matmul( a, b, c );
+		benchmark::DoNotOptimize( c.data( ) );
+	}
+	set_flops( t_state, n );
+}
+BENCHMARK( bm_matmul )->RangeMultiplier( 4 )->Range( 64, 1024 );
+
+static void bm_matmul_transposed( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> a( n, n );
+	nd_array<float> b( n, n );
+	nd_array<float> c( n, n );
+	a.fill( 1.0f );
+	b.fill( 0.5f );
+	for( auto _: t_state )
+	{
+		matmul( a, b.T( ), c );
+		benchmark::DoNotOptimize( c.data( ) );
+	}
+	set_flops( t_state, n );
+}
+BENCHMARK( bm_matmul_transposed )->RangeMultiplier( 4 )->Range( 64, 1024 );
+
+static void bm_matmul_parallel( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> a( n, n );
+	nd_array<float> b( n, n );
+	nd_array<float> c( n, n );
+	a.fill( 1.0f );
+	b.fill( 0.5f );
+	for( auto _: t_state )
+	{
+		matmul( par, a, b, c );
+		benchmark::DoNotOptimize( c.data( ) );
+	}
+	set_flops( t_state, n );
+}
+BENCHMARK( bm_matmul_parallel )->RangeMultiplier( 4 )->Range( 256, 1024 )->UseRealTime( );
+
+static void bm_matmul_batched( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> q( 16, n, 64 );
+	nd_array<float> k( 16, n, 64 );
+	nd_array<float> scores( 16, n, n );
+	q.fill( 1.0f );
+	k.fill( 0.5f );
+	for( auto _: t_state )
+	{
+		matmul( q, k.transpose( { 0, 2, 1 } ), scores );
+		benchmark::DoNotOptimize( scores.data( ) );
+	}
+	t_state.counters["flops"] = benchmark::Counter( static_cast<double>( t_state.iterations( ) ) * 2.0 * 16.0 * 64.0 * static_cast<double>( n * n ), benchmark::Counter::kIsRate );
+}
+BENCHMARK( bm_matmul_batched )->RangeMultiplier( 4 )->Range( 64, 256 );
+
+// Hand-written i-k-j loop through the bounds-checked accessors
+static void bm_matmul_naive( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> a( n, n );
+	nd_array<float> b( n, n );
+	nd_array<float> c( n, n );
+	a.fill( 1.0f );
+	b.fill( 0.5f );
+	for( auto _: t_state )
+	{
+		c.fill( 0.0f );
+		for( size_t i = 0; i < n; ++i )
+		{
+			for( size_t k = 0; k < n; ++k )
+			{
+				const float aik = a( i, k );
+				for( size_t j = 0; j < n; ++j )
+				{
+					c( i, j ) += aik * b( k, j );
+				}
+			}
+		}
+		benchmark::DoNotOptimize( c.data( ) );
+	}
+	set_flops( t_state, n );
+}
+BENCHMARK( bm_matmul_naive )->RangeMultiplier( 4 )->Range( 64, 1024 );
+
+static void bm_matvec_transposed( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> a( n, n );
+	nd_array<float> x( n );
+	nd_array<float> y( n );
+	a.fill( 1.0f );
+	x.fill( 0.5f );
+	for( auto _: t_state )
+	{
+		matvec( a.T( ), x, y );
+		benchmark::DoNotOptimize( y.data( ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_matvec_transposed )->RangeMultiplier( 4 )->Range( 256, 4096 );
+
+static void bm_matvec( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> a( n, n );
+	nd_array<float> x( n );
+	nd_array<float> y( n );
+	a.fill( 1.0f );
+	x.fill( 0.5f );
+	for( auto _: t_state )
+	{
+		matvec( a, x, y );
+		benchmark::DoNotOptimize( y.data( ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_matvec )->RangeMultiplier( 4 )->Range( 256, 4096 );
@@ -0,0 +1,71 @@
+#include "nd_array/nd_reduce.hpp"
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace cppa;
+
+// Reductions along the unit-stride axis and across rows, compared with a loop over nd_span iterators
+
+static void bm_reduce_rows( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> arr( n, n );
+	arr.fill( 1.0f );
+	for( auto _: t_state )
+	{
+		benchmark::DoNotOptimize( cppa::sum( arr, { 1 } ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_reduce_rows )->RangeMultiplier( 4 )->Range( 64, 4096 );
+
+static void bm_reduce_columns( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> arr( n, n );
+	arr.fill( 1.0f );
+	for( auto _: t_state )
+	{
+		benchmark::DoNotOptimize( cppa::sum( arr, { 0 } ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_reduce_columns )->RangeMultiplier( 4 )->Range( 64, 4096 );
+
+static void bm_reduce_columns_parallel( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> arr( n, n );
+	arr.fill( 1.0f );
+	for( auto _: t_state )
+	{
+		benchmark::DoNotOptimize( cppa::sum( par, arr, { 0 } ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_reduce_columns_parallel )->RangeMultiplier( 4 )->Range( 256, 4096 )->UseRealTime( );
+
+// Column sums through the iterators of each column view, the pattern reduce() replaces
+static void bm_reduce_columns_iterator( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> arr( n, n );
+	arr.fill( 1.0f );
+	std::vector<float> sums( n );
+	for( auto _: t_state )
+	{
+		for( size_t j = 0; j < n; ++j )
+		{
+			float sum = 0.0f;
+			for( const float value: arr.subspan( 1, { j, j + 1 } ) )
+			{
+				sum += value;
+			}
+			sums[j] = sum;
+		}
+		benchmark::DoNotOptimize( sums.data( ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_reduce_columns_iterator )->RangeMultiplier( 4 )->Range( 64, 4096 );
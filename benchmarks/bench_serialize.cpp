@@ -0,0 +1,128 @@
+#include "nd_array/nd_serialize.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace cppa;
+
+// Writing views to the serial format, and reading a message in place against copying it out
+
+static nd_array<float> make_frame( size_t t_n )
+{
+	nd_array<float> frame( t_n, t_n );
+	for( size_t i = 0; i < frame.size( ); ++i )
+	{
+		frame.data( )[i] = static_cast<float>( i % 251 );
+	}
+	return frame;
+}
+
+// Stream over a preallocated buffer, so that stream growth does not dominate the timings
+class buffer_stream : public std::streambuf
+{
+public:
+	explicit buffer_stream( std::vector<char>& t_buffer ) { setp( t_buffer.data( ), t_buffer.data( ) + t_buffer.size( ) ); }
+};
+
+static std::vector<std::byte> to_buffer( const std::string& t_bytes )
+{
+	std::vector<std::byte> buffer( t_bytes.size( ) );
+	std::memcpy( buffer.data( ), t_bytes.data( ), t_bytes.size( ) );
+	return buffer;
+}
+
+static void bm_serialize_contiguous( benchmark::State& t_state )
+{
+	const auto n     = static_cast<size_t>( t_state.range( 0 ) );
+	const auto frame = make_frame( n );
+	std::vector<char> buffer( 2 * frame.size( ) * sizeof( float ) );
+	for( auto _: t_state )
+	{
+		buffer_stream target( buffer );
+		std::ostream out( &target );
+		serialize( out, frame.as_span( ) );
+		benchmark::DoNotOptimize( buffer.data( ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_serialize_contiguous )->Arg( 1024 );
+
+// Neither row- nor column-major, so the writer gathers it block-wise
+static void bm_serialize_gathered( benchmark::State& t_state )
+{
+	const auto n     = static_cast<size_t>( t_state.range( 0 ) );
+	const auto frame = make_frame( n );
+	const auto view  = frame.T( ).subspan( 0, { 0, n - 1 } );
+	std::vector<char> buffer( 2 * frame.size( ) * sizeof( float ) );
+	for( auto _: t_state )
+	{
+		buffer_stream target( buffer );
+		std::ostream out( &target );
+		serialize( out, view );
+		benchmark::DoNotOptimize( buffer.data( ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * view.size( ) * sizeof( float ) ) );
+}
+BENCHMARK( bm_serialize_gathered )->Arg( 1024 );
+
+static void bm_view_serialized( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	std::ostringstream out;
+	serialize( out, make_frame( n ).as_span( ) );
+	const auto buffer = to_buffer( out.str( ) );
+	for( auto _: t_state )
+	{
+		auto view = view_serialized<const float>( buffer.data( ), buffer.size( ) );
+		benchmark::DoNotOptimize( view );
+	}
+}
+BENCHMARK( bm_view_serialized )->Arg( 1024 );
+
+static void bm_deserialize( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	std::ostringstream out;
+	serialize( out, make_frame( n ).as_span( ) );
+	const auto buffer = to_buffer( out.str( ) );
+	for( auto _: t_state )
+	{
+		auto copy = deserialize<float>( buffer.data( ), buffer.size( ) );
+		benchmark::DoNotOptimize( copy.data( ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+BENCHMARK( bm_deserialize )->Arg( 1024 );
+
+#if defined( ND_ARRAY_USE_LZ4 ) || defined( ND_ARRAY_USE_ZSTD ) || defined( ND_ARRAY_USE_ZLIB )
+template<typename Codec>
+static void bm_compressed_round_trip( benchmark::State& t_state )
+{
+	const auto n     = static_cast<size_t>( t_state.range( 0 ) );
+	const auto frame = make_frame( n );
+	size_t stored    = 0;
+	for( auto _: t_state )
+	{
+		std::ostringstream out;
+		serialize( out, frame.as_span( ), Codec { } );
+		const auto buffer = to_buffer( out.str( ) );
+		auto copy         = deserialize<float>( buffer.data( ), buffer.size( ), Codec { } );
+		benchmark::DoNotOptimize( copy.data( ) );
+		stored = buffer.size( );
+	}
+	t_state.counters["ratio"] = static_cast<double>( n * n * sizeof( float ) ) / static_cast<double>( stored );
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+}
+#endif
+#if defined( ND_ARRAY_USE_LZ4 )
+BENCHMARK_TEMPLATE( bm_compressed_round_trip, lz4_codec )->Arg( 1024 );
+#endif
+#if defined( ND_ARRAY_USE_ZSTD )
+BENCHMARK_TEMPLATE( bm_compressed_round_trip, zstd_codec )->Arg( 1024 );
+#endif
+#if defined( ND_ARRAY_USE_ZLIB )
+BENCHMARK_TEMPLATE( bm_compressed_round_trip, zlib_codec )->Arg( 1024 );
+#endif
@@ -0,0 +1,117 @@
+#include "nd_array/nd_expr.hpp"
+#include "nd_array/nd_simd.hpp"
+#include "nd_array/nd_stencil.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <utility>
+
+using namespace cppa;
+
+// Bulk kernels on each instruction set path; the first argument is the simd_isa, the label names it
+
+// Pins the path of the first argument for the benchmark, or skips it if the build or CPU lacks it
+static bool pin_isa( benchmark::State& t_state )
+{
+	const auto isa = static_cast<simd_isa>( t_state.range( 0 ) );
+	if( !simd_isa_supported( isa ) )
+	{
+		t_state.SkipWithError( "instruction set not supported" );
+		return false;
+	}
+	set_simd_isa( isa );
+	t_state.SetLabel( simd_isa_name( isa ) );
+	return true;
+}
+
+static void isa_args( benchmark::internal::Benchmark* t_bench )
+{
+	t_bench->ArgsProduct( { { static_cast<int64_t>( simd_isa::sse2 ), static_cast<int64_t>( simd_isa::avx2 ), static_cast<int64_t>( simd_isa::avx512 ) }, { 256, 1024 } } );
+}
+
+static void bm_simd_apply( benchmark::State& t_state )
+{
+	const simd_isa previous = active_simd_isa( );
+	if( !pin_isa( t_state ) )
+	{
+		return;
+	}
+	const auto n = static_cast<size_t>( t_state.range( 1 ) );
+	nd_array<float> arr( n, n );
+	arr.fill( 1.0f );
+	for( auto _: t_state )
+	{
+		arr.apply( []( float t_x ) { return t_x * 0.5f + 0.25f; } );
+		benchmark::DoNotOptimize( arr.data( ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * sizeof( float ) ) );
+	set_simd_isa( previous );
+}
+BENCHMARK( bm_simd_apply )->Apply( isa_args );
+
+static void bm_simd_transform( benchmark::State& t_state )
+{
+	const simd_isa previous = active_simd_isa( );
+	if( !pin_isa( t_state ) )
+	{
+		return;
+	}
+	const auto n = static_cast<size_t>( t_state.range( 1 ) );
+	nd_array<std::uint16_t> raw( n, n );
+	raw.fill( 4096 );
+	nd_array<float> out( n, n );
+	for( auto _: t_state )
+	{
+		out.transform( std::as_const( raw ).as_span( ), []( std::uint16_t t_x ) { return static_cast<float>( t_x ) / 65535.0f; } );
+		benchmark::DoNotOptimize( out.data( ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * ( sizeof( float ) + sizeof( std::uint16_t ) ) ) );
+	set_simd_isa( previous );
+}
+BENCHMARK( bm_simd_transform )->Apply( isa_args );
+
+static void bm_simd_expression( benchmark::State& t_state )
+{
+	const simd_isa previous = active_simd_isa( );
+	if( !pin_isa( t_state ) )
+	{
+		return;
+	}
+	const auto n = static_cast<size_t>( t_state.range( 1 ) );
+	nd_array<float> a( n, n );
+	nd_array<float> b( n, n );
+	nd_array<float> out( n, n );
+	a.fill( 1.5f );
+	b.fill( 2.0f );
+	for( auto _: t_state )
+	{
+		out = a * b + a;
+		benchmark::DoNotOptimize( out.data( ) );
+	}
+	t_state.SetBytesProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n * 3 * sizeof( float ) ) );
+	set_simd_isa( previous );
+}
+BENCHMARK( bm_simd_expression )->Apply( isa_args );
+
+static void bm_simd_correlate( benchmark::State& t_state )
+{
+	const simd_isa previous = active_simd_isa( );
+	if( !pin_isa( t_state ) )
+	{
+		return;
+	}
+	const auto n = static_cast<size_t>( t_state.range( 1 ) );
+	nd_array<float> image( n, n );
+	image.fill( 1.0f );
+	nd_array<float> out( n, n );
+	nd_array<float> weights( 3, 3 );
+	weights.fill( 1.0f / 9.0f );
+	for( auto _: t_state )
+	{
+		correlate( image, weights, out, boundary_mode::nearest );
+		benchmark::DoNotOptimize( out.data( ) );
+	}
+	t_state.SetItemsProcessed( static_cast<int64_t>( t_state.iterations( ) * n * n ) );
+	set_simd_isa( previous );
+}
+BENCHMARK( bm_simd_correlate )->Apply( isa_args );
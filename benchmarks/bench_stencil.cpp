@@ -0,0 +1,128 @@
+#include "nd_array/nd_stencil.hpp"
+
+#include <benchmark/benchmark.h>
+
+using namespace cppa;
+
+// 3x3 box filters through a subspan per output pixel, sliding_window views, stencil() and correlate()
+
+static nd_array<float> make_image( size_t t_n )
+{
+	nd_array<float> image( t_n, t_n );
+	for( size_t i = 0; i < image.size( ); ++i )
+	{
+		image.data( )[i] = static_cast<float>( i % 17 );
+	}
+	return image;
+}
+
+static void set_pixels( benchmark::State& t_state, size_t t_n ) { t_state.SetItemsProcessed( static_cast<int64_t>( t_state.iterations( ) * t_n * t_n ) ); }
+
+// What the filters did before: a range-checked subspan per interior pixel
+static void bm_box_subspan( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	auto image   = make_image( n );
+	nd_array<float> out( n, n );
+	for( auto _: t_state )
+	{
+		for( size_t i = 1; i + 1 < n; ++i )
+		{
+			for( size_t j = 1; j + 1 < n; ++j )
+			{
+				auto window = image.subspan( 0, { i - 1, i + 2 } ).subspan( 1, { j - 1, j + 2 } );
+				float sum   = 0.0f;
+				for( size_t a = 0; a < 3; ++a )
+				{
+					for( size_t b = 0; b < 3; ++b )
+					{
+						sum += window( a, b );
+					}
+				}
+				out( i, j ) = sum;
+			}
+		}
+		benchmark::DoNotOptimize( out.data( ) );
+	}
+	set_pixels( t_state, n );
+}
+BENCHMARK( bm_box_subspan )->RangeMultiplier( 4 )->Range( 64, 1024 );
+
+static void bm_box_sliding_window( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	auto image   = make_image( n );
+	nd_array<float> out( n - 2, n - 2 );
+	for( auto _: t_state )
+	{
+		const auto windows = image.sliding_window( { 3, 3 } );
+		for( size_t i = 0; i < n - 2; ++i )
+		{
+			for( size_t j = 0; j < n - 2; ++j )
+			{
+				float sum = 0.0f;
+				for( size_t a = 0; a < 3; ++a )
+				{
+					for( size_t b = 0; b < 3; ++b )
+					{
+						sum += windows.unchecked( i, j, a, b );
+					}
+				}
+				out.unchecked( i, j ) = sum;
+			}
+		}
+		benchmark::DoNotOptimize( out.data( ) );
+	}
+	set_pixels( t_state, n );
+}
+BENCHMARK( bm_box_sliding_window )->RangeMultiplier( 4 )->Range( 64, 1024 );
+
+static void bm_box_stencil( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	auto image   = make_image( n );
+	nd_array<float> out( n, n );
+	const auto box = []( const auto& t_w )
+	{
+		return t_w( -1, -1 ) + t_w( -1, 0 ) + t_w( -1, 1 ) + t_w( 0, -1 ) + t_w( 0, 0 ) + t_w( 0, 1 ) + t_w( 1, -1 ) + t_w( 1, 0 ) + t_w( 1, 1 );
+	};
+	for( auto _: t_state )
+	{
+		stencil( image, out, { 1, 1 }, boundary_mode::nearest, box );
+		benchmark::DoNotOptimize( out.data( ) );
+	}
+	set_pixels( t_state, n );
+}
+BENCHMARK( bm_box_stencil )->RangeMultiplier( 4 )->Range( 64, 1024 );
+
+static void bm_box_correlate( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	auto image   = make_image( n );
+	nd_array<float> out( n, n );
+	nd_array<float> weights( 3, 3 );
+	weights.fill( 1.0f );
+	for( auto _: t_state )
+	{
+		correlate( image, weights, out, boundary_mode::nearest );
+		benchmark::DoNotOptimize( out.data( ) );
+	}
+	set_pixels( t_state, n );
+}
+BENCHMARK( bm_box_correlate )->RangeMultiplier( 4 )->Range( 64, 1024 );
+
+static void bm_box_correlate_parallel( benchmark::State& t_state )
+{
+	const auto n = static_cast<size_t>( t_state.range( 0 ) );
+	auto image   = make_image( n );
+	nd_array<float> out( n, n );
+	nd_array<float> weights( 3, 3 );
+	weights.fill( 1.0f );
+	for( auto _: t_state )
+	{
+		correlate( par, image, weights, out, boundary_mode::nearest );
+		benchmark::DoNotOptimize( out.data( ) );
+	}
+	set_pixels( t_state, n );
+}
+BENCHMARK( bm_box_correlate_parallel )->RangeMultiplier( 4 )->Range( 256, 1024 )->UseRealTime( );
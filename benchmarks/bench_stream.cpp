@@ -0,0 +1,64 @@
+#include "nd_array/nd_stream.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <functional>
+
+using namespace cppa;
+
+// Loading and processing batches one after the other, against batch_stream overlapping both stages
+
+static constexpr size_t batch_rows = 64;
+static constexpr size_t batch_cols = 4096;
+
+// Stand-in for decoding records: a few arithmetic operations per element
+static size_t load_batch( nd_span<float> t_batch, size_t t_index )
+{
+	float seed = static_cast<float>( t_index );
+	for( auto& value: t_batch )
+	{
+		seed  = std::fmod( seed * 1.000173f + 0.5f, 97.0f );
+		value = seed;
+	}
+	return t_batch.extent( 0 );
+}
+
+static double process_batch( const nd_span<float>& t_batch ) { return t_batch.transform_reduce( 0.0, std::plus<>( ), []( float t_x ) { return std::sqrt( double( t_x ) ); } ); }
+
+static void bm_batches_synchronous( benchmark::State& t_state )
+{
+	const auto batches = static_cast<size_t>( t_state.range( 0 ) );
+	nd_array<float> buffer( batch_rows, batch_cols );
+	for( auto _: t_state )
+	{
+		double total = 0.0;
+		for( size_t i = 0; i < batches; ++i )
+		{
+			load_batch( buffer.as_span( ), i );
+			total += process_batch( buffer.as_span( ) );
+		}
+		benchmark::DoNotOptimize( total );
+	}
+	t_state.SetItemsProcessed( static_cast<int64_t>( t_state.iterations( ) * batches ) );
+}
+BENCHMARK( bm_batches_synchronous )->Arg( 64 )->UseRealTime( );
+
+static void bm_batches_streamed( benchmark::State& t_state )
+{
+	const auto batches = static_cast<size_t>( t_state.range( 0 ) );
+	const auto buffers = static_cast<size_t>( t_state.range( 1 ) );
+	for( auto _: t_state )
+	{
+		size_t next = 0;
+		batch_stream<float> stream(
+		    { batch_rows, batch_cols }, [&next, batches]( nd_span<float> t_batch ) { return next < batches ? load_batch( t_batch, next++ ) : 0; }, buffers );
+		double total = 0.0;
+		while( auto batch = stream.next( ) )
+		{
+			total += process_batch( batch.view( ) );
+		}
+		benchmark::DoNotOptimize( total );
+	}
+	t_state.SetItemsProcessed( static_cast<int64_t>( t_state.iterations( ) * batches ) );
+}
+BENCHMARK( bm_batches_streamed )->Args( { 64, 2 } )->Args( { 64, 3 } )->UseRealTime( );
@@ -0,0 +1,693 @@
+#pragma once
+
+#include "nd_array.hpp"
+
+#include <vector>
+
+/// \file chunked_nd_array.hpp
+/// \brief N-dimensional array stored as separately allocated fixed-size chunks
+///
+/// chunked_nd_array splits its index space into a grid of equally sized N-D chunks (edge chunks are
+/// clipped to the array extents). Each chunk is its own row-major nd_array, allocated the first time
+/// it is written, so sparse volumes only pay for the chunks that are used and region-of-interest
+/// reads touch only the chunks intersecting the region. Unallocated chunks read as the fill value.
+///
+/// \code
+/// // 4096^3 volume in 64^3 chunks; nothing is allocated yet
+/// chunked_nd_array<float> volume({4096, 4096, 4096}, {64, 64, 64});
+/// volume(10, 20, 30) = 1.0f;           // Allocates one 64^3 chunk
+///
+/// auto roi = volume.subspan({{0, 128}, {0, 128}, {0, 64}});
+/// nd_array<float> dense(128, 128, 64);
+/// roi.copy_to(dense.as_span());         // Reads only the chunks under the region
+///
+/// volume.slice(0, 10).for_each_chunk([](const auto& origin, nd_span<float> part) { ... });
+/// \endcode
+///
+/// \note Lazy allocation is not synchronized: writing concurrently to elements of the same unallocated
+///       chunk is a data race. Chunks that are already allocated may be written from several threads.
+
+namespace cppa
+{
+	template<typename Ty, size_t MaxRank, typename Allocator>
+	class chunked_nd_array;
+
+	/// \class chunked_nd_span
+	/// \brief Non-owning view of a rectangular region of a chunked_nd_array
+	/// \tparam Ty Element type; const-qualified for read-only views
+	/// \tparam MaxRank Maximum number of dimensions supported
+	/// \tparam Allocator Allocator of the viewed array
+	///
+	/// Obtained from chunked_nd_array::as_view(), subspan() and slice(). The view stays valid as long as
+	/// the array lives; it does not pin individual chunks.
+	template<typename Ty, size_t MaxRank = 8, typename Allocator = std::allocator<std::remove_const_t<Ty>>>
+	class chunked_nd_span
+	{
+	public:
+		using value_type    = std::remove_const_t<Ty>;                                                    ///< Element type without const
+		using size_type     = size_t;                                                                     ///< Type for sizes and indices
+		using reference     = Ty&;                                                                        ///< Reference to element
+		using array_type    = chunked_nd_array<value_type, MaxRank, Allocator>;                           ///< Viewed array type
+		using array_pointer = std::conditional_t<std::is_const_v<Ty>, const array_type*, array_type*>; ///< Pointer to the viewed array
+
+		/// \brief Constructs a view of a region of t_array
+		/// \param t_array Viewed array
+		/// \param t_origin First element of the region, in array coordinates (all array dimensions)
+		/// \param t_dims Array dimension of each view dimension; the remaining array dimensions are fixed at t_origin
+		/// \param t_extents Extent of each view dimension
+		/// \param t_rank Number of view dimensions
+		/// \note This is the internal constructor used by subspan/slice operations
+		chunked_nd_span( array_pointer t_array, const std::array<size_type, MaxRank>& t_origin, const std::array<size_type, MaxRank>& t_dims,
+		                 const std::array<size_type, MaxRank>& t_extents, size_type t_rank ) noexcept
+		    : m_array( t_array )
+		    , m_origin( t_origin )
+		    , m_dims( t_dims )
+		    , m_extents( t_extents )
+		    , m_rank( t_rank )
+		{
+		}
+
+		/// \brief Converts a mutable view to a read-only view
+		template<typename OtherTy, std::enable_if_t<std::is_const_v<Ty> && std::is_same_v<const OtherTy, Ty>, int> = 0>
+		chunked_nd_span( const chunked_nd_span<OtherTy, MaxRank, Allocator>& t_other ) noexcept
+		    : chunked_nd_span( t_other.m_array, t_other.m_origin, t_other.m_dims, t_other.m_extents, t_other.m_rank )
+		{
+		}
+
+		/// \brief Accesses an element of the region
+		/// \param t_indices Indices in view coordinates, one per view dimension
+		/// \return Reference to the element; mutable views allocate its chunk if needed
+		/// \throws std::out_of_range if any index is out of bounds
+		template<typename... Indices>
+		[[nodiscard]] reference operator( )( Indices... t_indices ) const
+		{
+			static_assert( sizeof...( t_indices ) <= MaxRank, "Too many indices" );
+			const std::array<size_type, sizeof...( t_indices )> idx = { static_cast<size_type>( t_indices )... };
+			std::array<size_type, MaxRank> position                 = m_origin;
+			for( size_t i = 0; i < sizeof...( t_indices ); ++i )
+			{
+				if( i >= m_rank || idx[i] >= m_extents[i] )
+				{
+					throw std::out_of_range( "Index out of bounds" );
+				}
+				position[m_dims[i]] += idx[i];
+			}
+			return m_array->element( position );
+		}
+
+		/// \brief Creates a view restricted to a range along one dimension
+		/// \param t_dim Dimension to restrict (0-based)
+		/// \param t_range Pair of {start (inclusive), end (exclusive)} indices for that dimension
+		/// \throws std::out_of_range if dimension or range is invalid
+		[[nodiscard]] chunked_nd_span subspan( size_type t_dim, std::pair<size_type, size_type> t_range ) const
+		{
+			if( t_dim >= m_rank )
+			{
+				throw std::out_of_range( "Dimension out of range" );
+			}
+			if( t_range.first >= m_extents[t_dim] || t_range.second > m_extents[t_dim] || t_range.first >= t_range.second )
+			{
+				throw std::out_of_range( "Invalid range for subspan" );
+			}
+
+			chunked_nd_span result = *this;
+			result.m_origin[m_dims[t_dim]] += t_range.first;
+			result.m_extents[t_dim] = t_range.second - t_range.first;
+			return result;
+		}
+
+		/// \brief Creates a view restricted along the leading dimensions
+		/// \param t_ranges One {start, end} pair per leading dimension
+		/// \throws std::out_of_range if more ranges than dimensions are given or a range is invalid
+		[[nodiscard]] chunked_nd_span subspan( std::initializer_list<std::pair<size_type, size_type>> t_ranges ) const
+		{
+			if( t_ranges.size( ) > m_rank )
+			{
+				throw std::out_of_range( "Too many ranges for subspan" );
+			}
+			chunked_nd_span result = *this;
+			size_type dim          = 0;
+			for( const auto& range: t_ranges )
+			{
+				result = result.subspan( dim++, range );
+			}
+			return result;
+		}
+
+		/// \brief Creates a lower-dimensional view by fixing one dimension's index
+		/// \param t_dim Dimension to slice (0-based)
+		/// \param t_index Index value to fix for that dimension
+		/// \return View with rank reduced by 1
+		/// \throws std::out_of_range if dimension or index is invalid
+		[[nodiscard]] chunked_nd_span slice( size_type t_dim, size_type t_index ) const
+		{
+			if( t_dim >= m_rank )
+			{
+				throw std::out_of_range( "Dimension out of range" );
+			}
+			if( t_index >= m_extents[t_dim] )
+			{
+				throw std::out_of_range( "Index out of bounds" );
+			}
+
+			chunked_nd_span result = *this;
+			result.m_origin[m_dims[t_dim]] += t_index;
+			for( size_t i = t_dim; i + 1 < m_rank; ++i )
+			{
+				result.m_dims[i]    = m_dims[i + 1];
+				result.m_extents[i] = m_extents[i + 1];
+			}
+			--result.m_rank;
+			result.m_dims[result.m_rank]    = 0;
+			result.m_extents[result.m_rank] = 0;
+			return result;
+		}
+
+		/// \brief Calls t_func for the part of every allocated chunk that lies inside the region
+		/// \tparam Func Callable as func(const std::array<size_t, MaxRank>& origin, nd_span<Ty, MaxRank> part)
+		/// \param t_func Receives the position of the part in view coordinates and a strided view of it
+		///               with the same rank as this view
+		/// \note Unallocated chunks are skipped (they hold the fill value) and nothing is allocated.
+		///       Chunks are visited in row-major order of the chunk grid.
+		template<typename Func>
+		void for_each_chunk( Func&& t_func ) const
+		{
+			for_each_region( [&]( const std::array<size_type, MaxRank>& t_view_origin, size_type t_chunk, const std::array<size_type, MaxRank>& t_lo,
+			                      const std::array<size_type, MaxRank>& t_hi )
+			                 {
+				                 if( m_array->is_allocated( t_chunk ) )
+				                 {
+					                 t_func( t_view_origin, part_of( m_array->m_chunks[t_chunk].as_span( ), t_lo, t_hi ) );
+				                 }
+			                 } );
+		}
+
+		/// \brief Copies the region into a dense view with the same extents
+		/// \param t_dst Destination view; any strides are accepted
+		/// \throws std::invalid_argument if the extents differ
+		/// \note Parts of the region in unallocated chunks are written as the fill value.
+		void copy_to( const nd_span<value_type, MaxRank>& t_dst ) const
+		{
+			check_same_extents( t_dst.rank( ), [&t_dst]( size_type t_dim ) { return t_dst.extent( t_dim ); } );
+			for_each_region(
+			    [&]( const std::array<size_type, MaxRank>& t_view_origin, size_type t_chunk, const std::array<size_type, MaxRank>& t_lo,
+			         const std::array<size_type, MaxRank>& t_hi )
+			    {
+				    auto dst = dst_part( t_dst, t_view_origin, t_lo, t_hi );
+				    if( m_array->is_allocated( t_chunk ) )
+				    {
+					    const auto& chunk = m_array->m_chunks[t_chunk];
+					    dst.copy_from( part_of( chunk.as_span( ), t_lo, t_hi ) );
+				    }
+				    else
+				    {
+					    dst.fill( m_array->m_fill );
+				    }
+			    } );
+		}
+
+		/// \brief Copies a dense view with the same extents into the region, allocating chunks as needed
+		/// \param t_src Source view; any strides are accepted
+		/// \throws std::invalid_argument if the extents differ
+		template<typename OtherTy, typename SelfTy = Ty, std::enable_if_t<!std::is_const_v<SelfTy>, int> = 0>
+		void copy_from( const nd_span<OtherTy, MaxRank>& t_src ) const
+		{
+			check_same_extents( t_src.rank( ), [&t_src]( size_type t_dim ) { return t_src.extent( t_dim ); } );
+			for_each_region(
+			    [&]( const std::array<size_type, MaxRank>& t_view_origin, size_type t_chunk, const std::array<size_type, MaxRank>& t_lo,
+			         const std::array<size_type, MaxRank>& t_hi )
+			    {
+				    auto& chunk = m_array->chunk( t_chunk );
+				    part_of( chunk.as_span( ), t_lo, t_hi ).copy_from( dst_part( t_src, t_view_origin, t_lo, t_hi ) );
+			    } );
+		}
+
+		/// \brief Returns the number of view dimensions
+		[[nodiscard]] size_type rank( ) const noexcept { return m_rank; }
+
+		/// \brief Returns the extent of view dimension t_dim
+		/// \throws std::out_of_range if t_dim >= rank()
+		[[nodiscard]] size_type extent( size_type t_dim ) const
+		{
+			if( t_dim >= m_rank )
+			{
+				throw std::out_of_range( "Dimension out of range" );
+			}
+			return m_extents[t_dim];
+		}
+
+		/// \brief Returns the extents of all view dimensions
+		[[nodiscard]] detail::extents_view<size_type> extents( ) const noexcept { return { m_extents.data( ), m_rank }; }
+
+		/// \brief Returns the number of elements in the region
+		[[nodiscard]] size_type size( ) const noexcept { return detail::compute_size<MaxRank>( m_extents, m_rank ); }
+
+	private:
+		template<typename, size_t, typename>
+		friend class chunked_nd_span;
+
+		/// \brief Calls t_func for every chunk intersecting the region, allocated or not
+		///
+		/// t_func receives the view coordinates of the intersection, the chunk index and the
+		/// intersection as [lo, hi) in chunk-local coordinates along every array dimension.
+		template<typename Func>
+		void for_each_region( Func&& t_func ) const
+		{
+			if( size( ) == 0 )
+				return;
+
+			const size_type array_rank = m_array->m_rank;
+			std::array<size_type, MaxRank> hi_element { };
+			std::array<size_type, MaxRank> first_chunk { };
+			std::array<size_type, MaxRank> last_chunk { };
+			for( size_type p = 0; p < array_rank; ++p )
+			{
+				hi_element[p] = m_origin[p] + 1;
+			}
+			for( size_type d = 0; d < m_rank; ++d )
+			{
+				hi_element[m_dims[d]] = m_origin[m_dims[d]] + m_extents[d];
+			}
+			for( size_type p = 0; p < array_rank; ++p )
+			{
+				first_chunk[p] = m_origin[p] / m_array->m_chunk_extents[p];
+				last_chunk[p]  = ( hi_element[p] - 1 ) / m_array->m_chunk_extents[p];
+			}
+
+			std::array<size_type, MaxRank> grid = first_chunk;
+			std::array<size_type, MaxRank> lo { };
+			std::array<size_type, MaxRank> hi { };
+			std::array<size_type, MaxRank> view_origin { };
+			while( true )
+			{
+				for( size_type p = 0; p < array_rank; ++p )
+				{
+					const size_type chunk_start = grid[p] * m_array->m_chunk_extents[p];
+					const size_type chunk_end   = std::min( chunk_start + m_array->m_chunk_extents[p], m_array->m_extents[p] );
+					lo[p]                       = std::max( m_origin[p], chunk_start ) - chunk_start;
+					hi[p]                       = std::min( hi_element[p], chunk_end ) - chunk_start;
+				}
+				for( size_type d = 0; d < m_rank; ++d )
+				{
+					const size_type p = m_dims[d];
+					view_origin[d]    = lo[p] + grid[p] * m_array->m_chunk_extents[p] - m_origin[p];
+				}
+				t_func( view_origin, m_array->chunk_index( grid ), lo, hi );
+
+				size_type p = array_rank;
+				while( p > 0 )
+				{
+					--p;
+					if( grid[p] < last_chunk[p] )
+					{
+						++grid[p];
+						break;
+					}
+					grid[p] = first_chunk[p];
+					if( p == 0 )
+						return;
+				}
+			}
+		}
+
+		/// \brief Restricts a chunk view to [t_lo, t_hi) and drops the array dimensions fixed by slicing
+		template<typename SpanTy>
+		[[nodiscard]] nd_span<SpanTy, MaxRank> part_of( nd_span<SpanTy, MaxRank> t_chunk, const std::array<size_type, MaxRank>& t_lo,
+		                                                const std::array<size_type, MaxRank>& t_hi ) const
+		{
+			const size_type array_rank = m_array->m_rank;
+			for( size_type p = 0; p < array_rank; ++p )
+			{
+				t_chunk = t_chunk.subspan( p, { t_lo[p], t_hi[p] } );
+			}
+
+			// Drop fixed dimensions from the back so earlier dimension numbers stay valid; the kept
+			// dimensions are then in view order, as slicing and subspan never reorder m_dims
+			std::array<bool, MaxRank> kept { };
+			for( size_type d = 0; d < m_rank; ++d )
+			{
+				kept[m_dims[d]] = true;
+			}
+			for( size_type p = array_rank; p > 0; --p )
+			{
+				if( !kept[p - 1] )
+				{
+					t_chunk = t_chunk.slice( p - 1, 0 );
+				}
+			}
+
+			return t_chunk;
+		}
+
+		/// \brief Returns the part of a dense view matching one chunk intersection
+		template<typename SpanTy>
+		[[nodiscard]] nd_span<SpanTy, MaxRank> dst_part( nd_span<SpanTy, MaxRank> t_span, const std::array<size_type, MaxRank>& t_view_origin,
+		                                                 const std::array<size_type, MaxRank>& t_lo, const std::array<size_type, MaxRank>& t_hi ) const
+		{
+			for( size_type d = 0; d < m_rank; ++d )
+			{
+				const size_type p = m_dims[d];
+				t_span            = t_span.subspan( d, { t_view_origin[d], t_view_origin[d] + t_hi[p] - t_lo[p] } );
+			}
+			return t_span;
+		}
+
+		template<typename ExtentOf>
+		void check_same_extents( size_type t_rank, ExtentOf&& t_extent_of ) const
+		{
+			if( t_rank != m_rank )
+			{
+				throw std::invalid_argument( "Shape mismatch" );
+			}
+			for( size_type d = 0; d < m_rank; ++d )
+			{
+				if( t_extent_of( d ) != m_extents[d] )
+				{
+					throw std::invalid_argument( "Shape mismatch" );
+				}
+			}
+		}
+
+		array_pointer m_array = nullptr;
+		std::array<size_type, MaxRank> m_origin { };
+		std::array<size_type, MaxRank> m_dims { };
+		std::array<size_type, MaxRank> m_extents { };
+		size_type m_rank = 0;
+	};
+
+	/// \class chunked_nd_array
+	/// \brief Owning N-dimensional array stored as a grid of lazily allocated chunks
+	/// \tparam Ty Element type
+	/// \tparam MaxRank Maximum number of dimensions supported
+	/// \tparam Allocator Allocator used for every chunk buffer
+	///
+	/// Elements are addressed like an nd_array, but storage is split into chunks of chunk_extent()
+	/// elements per dimension, each a separate row-major allocation. A chunk is allocated (and filled
+	/// with the fill value) when one of its elements is first written through a mutable accessor.
+	/// Views from as_view(), subspan() and slice() support element access, per-chunk traversal and
+	/// bulk copies to and from dense nd_span views.
+	///
+	/// \example
+	/// \code
+	/// chunked_nd_array<std::uint8_t> mask({2048, 2048, 512}, {128, 128, 64});
+	/// mask(100, 200, 300) = 1;
+	/// size_t used = mask.allocated_chunk_count();  // 1
+	/// \endcode
+	template<typename Ty, size_t MaxRank = 8, typename Allocator = std::allocator<Ty>>
+	class chunked_nd_array
+	{
+	public:
+		using value_type      = Ty;                                            ///< Element type
+		using size_type       = size_t;                                        ///< Type for sizes and indices
+		using reference       = Ty&;                                           ///< Reference to element
+		using const_reference = const Ty&;                                     ///< Const reference to element
+		using allocator_type  = Allocator;                                     ///< Allocator of the chunk buffers
+		using chunk_type      = nd_array<Ty, MaxRank, Allocator>;              ///< Storage of one chunk
+		using view_type       = chunked_nd_span<Ty, MaxRank, Allocator>;       ///< Mutable region view
+		using const_view_type = chunked_nd_span<const Ty, MaxRank, Allocator>; ///< Read-only region view
+
+		/// \brief Constructs an array without allocating any chunk
+		/// \param t_extents Array extents {dim0, dim1, ...}
+		/// \param t_chunk_extents Chunk extents, one per dimension
+		/// \param t_fill Value of elements in unallocated chunks and of freshly allocated chunks
+		/// \param t_alloc Allocator for the chunk buffers
+		/// \throws std::invalid_argument if the ranks differ, exceed MaxRank or a chunk extent is zero
+		chunked_nd_array( std::initializer_list<size_type> t_extents, std::initializer_list<size_type> t_chunk_extents, const Ty& t_fill = Ty( ),
+		                  const Allocator& t_alloc = Allocator( ) )
+		    : chunked_nd_array( std::vector<size_type>( t_extents ), std::vector<size_type>( t_chunk_extents ), t_fill, t_alloc )
+		{
+		}
+
+		/// \brief Constructs an array from containers of extents without allocating any chunk
+		/// \tparam Container Type of container holding extents (e.g., std::vector<size_t>)
+		/// \param t_extents Array extents
+		/// \param t_chunk_extents Chunk extents, one per dimension
+		/// \param t_fill Value of elements in unallocated chunks and of freshly allocated chunks
+		/// \param t_alloc Allocator for the chunk buffers
+		/// \throws std::invalid_argument if the ranks differ, exceed MaxRank or a chunk extent is zero
+		template<typename Container, typename ChunkContainer, std::enable_if_t<!std::is_integral_v<Container> && !std::is_integral_v<ChunkContainer>, int> = 0>
+		chunked_nd_array( const Container& t_extents, const ChunkContainer& t_chunk_extents, const Ty& t_fill = Ty( ), const Allocator& t_alloc = Allocator( ) )
+		    : m_fill( t_fill )
+		    , m_alloc( t_alloc )
+		{
+			m_rank = static_cast<size_type>( std::distance( std::begin( t_extents ), std::end( t_extents ) ) );
+			if( m_rank > MaxRank )
+			{
+				throw std::invalid_argument( "Rank exceeds MaxRank" );
+			}
+			if( static_cast<size_type>( std::distance( std::begin( t_chunk_extents ), std::end( t_chunk_extents ) ) ) != m_rank )
+			{
+				throw std::invalid_argument( "Chunk rank must match array rank" );
+			}
+
+			std::copy( std::begin( t_extents ), std::end( t_extents ), m_extents.begin( ) );
+			std::copy( std::begin( t_chunk_extents ), std::end( t_chunk_extents ), m_chunk_extents.begin( ) );
+			size_type chunk_count = m_rank == 0 ? 0 : 1;
+			for( size_type i = 0; i < m_rank; ++i )
+			{
+				if( m_chunk_extents[i] == 0 )
+				{
+					throw std::invalid_argument( "Chunk extents must be non-zero" );
+				}
+				m_grid[i] = ( m_extents[i] + m_chunk_extents[i] - 1 ) / m_chunk_extents[i];
+				chunk_count *= m_grid[i];
+			}
+			m_chunks.resize( chunk_count, chunk_type( m_alloc ) );
+		}
+
+		/// \brief Accesses an element, allocating its chunk if needed
+		/// \param t_indices Multi-dimensional indices (i, j, k, ...)
+		/// \throws std::out_of_range if any index is out of bounds
+		template<typename... Indices>
+		[[nodiscard]] reference operator( )( Indices... t_indices )
+		{
+			return element( position_of( t_indices... ) );
+		}
+
+		/// \brief Reads an element without allocating
+		/// \param t_indices Multi-dimensional indices (i, j, k, ...)
+		/// \return The element, or the fill value if its chunk is not allocated
+		/// \throws std::out_of_range if any index is out of bounds
+		template<typename... Indices>
+		[[nodiscard]] const_reference operator( )( Indices... t_indices ) const
+		{
+			return element( position_of( t_indices... ) );
+		}
+
+		/// \brief Returns a mutable view of the whole array
+		[[nodiscard]] view_type as_view( ) noexcept { return view_type( this, { }, identity_dims( ), m_extents, m_rank ); }
+
+		/// \brief Returns a read-only view of the whole array
+		[[nodiscard]] const_view_type as_view( ) const noexcept { return const_view_type( this, { }, identity_dims( ), m_extents, m_rank ); }
+
+		/// \brief Creates a view restricted to a range along one dimension
+		/// \see chunked_nd_span::subspan
+		[[nodiscard]] view_type subspan( size_type t_dim, std::pair<size_type, size_type> t_range ) { return as_view( ).subspan( t_dim, t_range ); }
+
+		/// \brief Creates a read-only view restricted to a range along one dimension
+		/// \see chunked_nd_span::subspan
+		[[nodiscard]] const_view_type subspan( size_type t_dim, std::pair<size_type, size_type> t_range ) const { return as_view( ).subspan( t_dim, t_range ); }
+
+		/// \brief Creates a view restricted along the leading dimensions
+		/// \see chunked_nd_span::subspan
+		[[nodiscard]] view_type subspan( std::initializer_list<std::pair<size_type, size_type>> t_ranges ) { return as_view( ).subspan( t_ranges ); }
+
+		/// \brief Creates a read-only view restricted along the leading dimensions
+		/// \see chunked_nd_span::subspan
+		[[nodiscard]] const_view_type subspan( std::initializer_list<std::pair<size_type, size_type>> t_ranges ) const { return as_view( ).subspan( t_ranges ); }
+
+		/// \brief Creates a lower-dimensional view by fixing one dimension's index
+		/// \see chunked_nd_span::slice
+		[[nodiscard]] view_type slice( size_type t_dim, size_type t_index ) { return as_view( ).slice( t_dim, t_index ); }
+
+		/// \brief Creates a read-only lower-dimensional view by fixing one dimension's index
+		/// \see chunked_nd_span::slice
+		[[nodiscard]] const_view_type slice( size_type t_dim, size_type t_index ) const { return as_view( ).slice( t_dim, t_index ); }
+
+		/// \brief Calls t_func(origin, nd_span part) for every allocated chunk
+		/// \see chunked_nd_span::for_each_chunk
+		template<typename Func>
+		void for_each_chunk( Func&& t_func )
+		{
+			as_view( ).for_each_chunk( std::forward<Func>( t_func ) );
+		}
+
+		/// \brief Calls t_func(origin, nd_span<const Ty> part) for every allocated chunk
+		/// \see chunked_nd_span::for_each_chunk
+		template<typename Func>
+		void for_each_chunk( Func&& t_func ) const
+		{
+			as_view( ).for_each_chunk( std::forward<Func>( t_func ) );
+		}
+
+		/// \brief Frees every chunk; all elements read as the fill value afterwards
+		void clear( ) noexcept
+		{
+			for( auto& chunk: m_chunks )
+			{
+				chunk = chunk_type( m_alloc );
+			}
+		}
+
+		/// \brief Returns the number of dimensions
+		[[nodiscard]] size_type rank( ) const noexcept { return m_rank; }
+
+		/// \brief Returns the extent of dimension t_dim
+		/// \throws std::out_of_range if t_dim >= rank()
+		[[nodiscard]] size_type extent( size_type t_dim ) const
+		{
+			if( t_dim >= m_rank )
+			{
+				throw std::out_of_range( "Dimension out of range" );
+			}
+			return m_extents[t_dim];
+		}
+
+		/// \brief Returns the extents of all dimensions
+		[[nodiscard]] detail::extents_view<size_type> extents( ) const noexcept { return { m_extents.data( ), m_rank }; }
+
+		/// \brief Returns the total number of elements, allocated or not
+		[[nodiscard]] size_type size( ) const noexcept { return detail::compute_size<MaxRank>( m_extents, m_rank ); }
+
+		/// \brief Returns the chunk extent along dimension t_dim
+		/// \throws std::out_of_range if t_dim >= rank()
+		[[nodiscard]] size_type chunk_extent( size_type t_dim ) const
+		{
+			if( t_dim >= m_rank )
+			{
+				throw std::out_of_range( "Dimension out of range" );
+			}
+			return m_chunk_extents[t_dim];
+		}
+
+		/// \brief Returns the total number of chunks in the grid
+		[[nodiscard]] size_type chunk_count( ) const noexcept { return m_chunks.size( ); }
+
+		/// \brief Returns the number of chunks that are currently allocated
+		[[nodiscard]] size_type allocated_chunk_count( ) const noexcept
+		{
+			size_type count = 0;
+			for( const auto& chunk: m_chunks )
+			{
+				count += chunk.size( ) != 0 ? 1 : 0;
+			}
+			return count;
+		}
+
+		/// \brief Returns the value of elements in unallocated chunks
+		[[nodiscard]] const_reference fill_value( ) const noexcept { return m_fill; }
+
+		/// \brief Returns a copy of the chunk allocator
+		[[nodiscard]] allocator_type get_allocator( ) const noexcept { return m_alloc; }
+
+	private:
+		template<typename, size_t, typename>
+		friend class chunked_nd_span;
+
+		template<typename... Indices>
+		[[nodiscard]] std::array<size_type, MaxRank> position_of( Indices... t_indices ) const
+		{
+			static_assert( sizeof...( t_indices ) <= MaxRank, "Too many indices" );
+			const std::array<size_type, sizeof...( t_indices )> idx = { static_cast<size_type>( t_indices )... };
+			std::array<size_type, MaxRank> position { };
+			for( size_t i = 0; i < sizeof...( t_indices ); ++i )
+			{
+				if( i >= m_rank || idx[i] >= m_extents[i] )
+				{
+					throw std::out_of_range( "Index out of bounds" );
+				}
+				position[i] = idx[i];
+			}
+			return position;
+		}
+
+		[[nodiscard]] std::array<size_type, MaxRank> identity_dims( ) const noexcept
+		{
+			std::array<size_type, MaxRank> dims { };
+			for( size_type i = 0; i < MaxRank; ++i )
+			{
+				dims[i] = i;
+			}
+			return dims;
+		}
+
+		[[nodiscard]] size_type chunk_index( const std::array<size_type, MaxRank>& t_grid ) const noexcept
+		{
+			size_type index = 0;
+			for( size_type i = 0; i < m_rank; ++i )
+			{
+				index = index * m_grid[i] + t_grid[i];
+			}
+			return index;
+		}
+
+		[[nodiscard]] bool is_allocated( size_type t_chunk ) const noexcept { return m_chunks[t_chunk].size( ) != 0; }
+
+		/// \brief Returns chunk t_chunk, allocating and filling it on first use
+		chunk_type& chunk( size_type t_chunk )
+		{
+			auto& chunk = m_chunks[t_chunk];
+			if( chunk.size( ) == 0 )
+			{
+				std::array<size_type, MaxRank> extents { };
+				size_type remaining = t_chunk;
+				for( size_type i = m_rank; i > 0; --i )
+				{
+					const size_type grid = remaining % m_grid[i - 1];
+					remaining /= m_grid[i - 1];
+					extents[i - 1] = std::min( m_chunk_extents[i - 1], m_extents[i - 1] - grid * m_chunk_extents[i - 1] );
+				}
+				chunk = chunk_type( std::vector<size_type>( extents.begin( ), extents.begin( ) + m_rank ), m_alloc );
+				chunk.fill( m_fill );
+			}
+			return chunk;
+		}
+
+		/// \brief Returns the index of the chunk holding an element given in array coordinates
+		[[nodiscard]] size_type chunk_of( const std::array<size_type, MaxRank>& t_position ) const noexcept
+		{
+			std::array<size_type, MaxRank> grid { };
+			for( size_type i = 0; i < m_rank; ++i )
+			{
+				grid[i] = t_position[i] / m_chunk_extents[i];
+			}
+			return chunk_index( grid );
+		}
+
+		/// \brief Returns the offset of an element given in array coordinates inside its chunk
+		[[nodiscard]] size_type offset_in( const chunk_type& t_chunk, const std::array<size_type, MaxRank>& t_position ) const
+		{
+			size_type offset = 0;
+			for( size_type i = 0; i < m_rank; ++i )
+			{
+				offset += ( t_position[i] % m_chunk_extents[i] ) * static_cast<size_type>( t_chunk.stride( i ) );
+			}
+			return offset;
+		}
+
+		[[nodiscard]] reference element( const std::array<size_type, MaxRank>& t_position )
+		{
+			auto& target = chunk( chunk_of( t_position ) );
+			return target.data( )[offset_in( target, t_position )];
+		}
+
+		[[nodiscard]] const_reference element( const std::array<size_type, MaxRank>& t_position ) const
+		{
+			const size_type index = chunk_of( t_position );
+			if( !is_allocated( index ) )
+			{
+				return m_fill;
+			}
+			const auto& target = m_chunks[index];
+			return target.data( )[offset_in( target, t_position )];
+		}
+
+		std::array<size_type, MaxRank> m_extents { };
+		std::array<size_type, MaxRank> m_chunk_extents { };
+		std::array<size_type, MaxRank> m_grid { };
+		size_type m_rank = 0;
+		Ty m_fill;
+		Allocator m_alloc;
+		std::vector<chunk_type> m_chunks;
+	};
+} // namespace cppa
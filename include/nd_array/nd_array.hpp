@@ -2,14 +2,38 @@
 
 #include <algorithm>
 #include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <exception>
 #include <initializer_list>
 #include <iterator>
+#include <limits>
 #include <memory>
+#include <new>
+#if __has_include( <memory_resource> )
+#	include <memory_resource>
+#endif
 #include <numeric>
+#include <optional>
 #include <stdexcept>
+#include <thread>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "nd_simd.hpp"
+#include "nd_stats.hpp"
+
+/// \def ND_ARRAY_ASSERT
+/// \brief Debug-only check used by the unchecked access paths
+///
+/// Expands to `assert` by default, so the checks are active unless `NDEBUG` is defined.
+/// Define it before including this header to route failures to a custom handler.
+#ifndef ND_ARRAY_ASSERT
+#	define ND_ARRAY_ASSERT( condition, message ) assert( ( condition ) && ( message ) )
+#endif
+
 /// \namespace cppa
 /// \brief C++ Array namespace containing n-dimensional array and span classes
 namespace cppa
@@ -24,31 +48,60 @@ namespace cppa
 		template<size_t MaxRank>
 		struct offset_computer
 		{
-			using size_type = size_t;
+			using size_type   = size_t;
+			using stride_type = std::ptrdiff_t;
 
 			/// \brief Computes the linear offset from multi-dimensional indices
 			/// \tparam Indices Variadic index types (typically size_t)
 			/// \param t_extents Array of dimension sizes
 			/// \param t_strides Array of stride values for each dimension
 			/// \param t_indices Variable number of indices, one per dimension
-			/// \return Linear offset into contiguous memory
+			/// \return Linear offset from the first element (negative along reversed dimensions)
 			/// \throws std::out_of_range if any index is out of bounds
 			template<typename... Indices>
-			[[nodiscard]] static constexpr size_type compute( const std::array<size_type, MaxRank>& t_extents, const std::array<size_type, MaxRank>& t_strides,
-			                                                  Indices... t_indices )
+			[[nodiscard]] static constexpr stride_type compute( const std::array<size_type, MaxRank>& t_extents, const std::array<stride_type, MaxRank>& t_strides,
+			                                                    Indices... t_indices )
 			{
 				std::array<size_type, sizeof...( t_indices )> idx = { static_cast<size_type>( t_indices )... };
-				size_type offset                                  = 0;
+				stride_type offset                                = 0;
 				for( size_t i = 0; i < sizeof...( t_indices ); ++i )
 				{
 					if( idx[i] >= t_extents[i] )
 					{
 						throw std::out_of_range( "Index out of bounds" );
 					}
-					offset += idx[i] * t_strides[i];
+					offset += static_cast<stride_type>( idx[i] ) * t_strides[i];
 				}
 				return offset;
 			}
+
+			/// \brief Computes the linear offset without bounds checking
+			/// \tparam Indices Variadic index types (typically size_t)
+			/// \param t_extents Array of dimension sizes (only inspected by ND_ARRAY_ASSERT)
+			/// \param t_strides Array of stride values for each dimension
+			/// \param t_indices Variable number of indices, one per dimension
+			/// \return Linear offset from the first element (negative along reversed dimensions)
+			/// \note Expands to a plain sum of index-stride products, so it can be inlined and vectorized
+			template<typename... Indices>
+			[[nodiscard]] static constexpr stride_type compute_unchecked( [[maybe_unused]] const std::array<size_type, MaxRank>& t_extents,
+			                                                              const std::array<stride_type, MaxRank>& t_strides, Indices... t_indices ) noexcept
+			{
+				return compute_unchecked_impl( t_extents, t_strides, std::index_sequence_for<Indices...> { }, t_indices... );
+			}
+
+		private:
+			template<size_t... Is, typename... Indices>
+			[[nodiscard]] static constexpr stride_type compute_unchecked_impl( [[maybe_unused]] const std::array<size_type, MaxRank>& t_extents,
+			                                                                   const std::array<stride_type, MaxRank>& t_strides, std::index_sequence<Is...>,
+			                                                                   Indices... t_indices ) noexcept
+			{
+				[[maybe_unused]] const std::array<size_type, sizeof...( t_indices )> idx = { static_cast<size_type>( t_indices )... };
+				for( size_t i = 0; i < sizeof...( t_indices ); ++i )
+				{
+					ND_ARRAY_ASSERT( idx[i] < t_extents[i], "Index out of bounds" );
+				}
+				return ( stride_type { 0 } + ... + ( static_cast<stride_type>( t_indices ) * t_strides[Is] ) );
+			}
 		};
 
 		/// \brief Helper struct for computing stride values from extents
@@ -56,14 +109,15 @@ namespace cppa
 		template<size_t MaxRank>
 		struct stride_computer
 		{
-			using size_type = size_t;
+			using size_type   = size_t;
+			using stride_type = std::ptrdiff_t;
 
 			/// \brief Computes row-major strides from dimension extents
 			/// \param t_strides Output array to store computed strides
 			/// \param t_extents Array of dimension sizes
 			/// \param t_rank Actual number of dimensions in use
 			/// \note Uses row-major (C-style) ordering where last dimension varies fastest
-			static constexpr void compute( std::array<size_type, MaxRank>& t_strides, const std::array<size_type, MaxRank>& t_extents, size_type t_rank ) noexcept
+			static constexpr void compute( std::array<stride_type, MaxRank>& t_strides, const std::array<size_type, MaxRank>& t_extents, size_type t_rank ) noexcept
 			{
 				if( t_rank == 0 )
 					return;
@@ -71,7 +125,7 @@ namespace cppa
 				t_strides[t_rank - 1] = 1;
 				for( size_t i = t_rank - 1; i > 0; --i )
 				{
-					t_strides[i - 1] = t_strides[i] * t_extents[i];
+					t_strides[i - 1] = t_strides[i] * static_cast<stride_type>( t_extents[i] );
 				}
 
 				for( size_t i = t_rank; i < MaxRank; ++i )
@@ -91,6 +145,19 @@ namespace cppa
 			[[nodiscard]] const SizeType* end( ) const noexcept { return data + size; }
 		};
 
+		/// \brief Range of raw pointers over contiguous elements, as returned by nd_span::as_contiguous()
+		template<typename Ty>
+		struct pointer_range
+		{
+			Ty* first   = nullptr; ///< First element
+			size_t size = 0;       ///< Number of elements
+
+			[[nodiscard]] Ty* begin( ) const noexcept { return first; }
+			[[nodiscard]] Ty* end( ) const noexcept { return first + size; }
+			[[nodiscard]] Ty* data( ) const noexcept { return first; }
+			[[nodiscard]] bool empty( ) const noexcept { return size == 0; }
+		};
+
 		/// \brief Computes total number of elements from extents
 		/// \tparam MaxRank Maximum number of dimensions supported
 		/// \param t_extents Extents array
@@ -116,17 +183,137 @@ namespace cppa
 		/// \param t_rank Number of active dimensions
 		/// \return True if the view is contiguous
 		template<size_t MaxRank>
-		[[nodiscard]] constexpr bool is_contiguous( const std::array<size_t, MaxRank>& t_extents, const std::array<size_t, MaxRank>& t_strides, size_t t_rank ) noexcept
+		[[nodiscard]] constexpr bool is_contiguous( const std::array<size_t, MaxRank>& t_extents, const std::array<std::ptrdiff_t, MaxRank>& t_strides, size_t t_rank ) noexcept
 		{
 			if( t_rank == 0 )
 				return true;
 			if( compute_size<MaxRank>( t_extents, t_rank ) == 0 )
 				return true;
-			if( t_strides[t_rank - 1] != 1 )
+			// Singleton dimensions are never stepped over, so their stride (possibly 0) does not matter
+			std::ptrdiff_t expected = 1;
+			for( size_t i = t_rank; i-- > 0; )
+			{
+				if( t_extents[i] == 1 )
+					continue;
+				if( t_strides[i] != expected )
+				{
+					return false;
+				}
+				expected *= static_cast<std::ptrdiff_t>( t_extents[i] );
+			}
+			return true;
+		}
+
+		/// \brief Checks if the last dimension of a span is unit-stride, i.e. every row is contiguous
+		/// \tparam MaxRank Maximum number of dimensions supported
+		/// \param t_extents Extents array
+		/// \param t_strides Strides array
+		/// \param t_rank Number of active dimensions
+		/// \return True if each row along the last dimension is contiguous (rows may be padded)
+		template<size_t MaxRank>
+		[[nodiscard]] constexpr bool has_contiguous_rows( const std::array<size_t, MaxRank>& t_extents, const std::array<std::ptrdiff_t, MaxRank>& t_strides,
+		                                                  size_t t_rank ) noexcept
+		{
+			if( t_rank == 0 || compute_size<MaxRank>( t_extents, t_rank ) == 0 )
+				return true;
+			return t_strides[t_rank - 1] == 1 || t_extents[t_rank - 1] == 1;
+		}
+
+		/// \brief Checks if a span is contiguous in column-major order
+		/// \tparam MaxRank Maximum number of dimensions supported
+		/// \param t_extents Extents array
+		/// \param t_strides Strides array
+		/// \param t_rank Number of active dimensions
+		/// \return True if the view is contiguous with the first dimension varying fastest
+		template<size_t MaxRank>
+		[[nodiscard]] constexpr bool is_column_major_contiguous( const std::array<size_t, MaxRank>& t_extents, const std::array<std::ptrdiff_t, MaxRank>& t_strides,
+		                                                         size_t t_rank ) noexcept
+		{
+			if( t_rank == 0 || compute_size<MaxRank>( t_extents, t_rank ) == 0 )
+				return true;
+			std::ptrdiff_t expected = 1;
+			for( size_t i = 0; i < t_rank; ++i )
+			{
+				if( t_extents[i] == 1 )
+					continue;
+				if( t_strides[i] != expected )
+				{
+					return false;
+				}
+				expected *= static_cast<std::ptrdiff_t>( t_extents[i] );
+			}
+			return true;
+		}
+
+		/// \brief Checks if a span covers a dense block of memory in any dimension order
+		/// \tparam MaxRank Maximum number of dimensions supported
+		/// \param t_extents Extents array
+		/// \param t_strides Strides array
+		/// \param t_rank Number of active dimensions
+		/// \return True if the strides are a permutation of dense strides (singleton dimensions are ignored)
+		template<size_t MaxRank>
+		[[nodiscard]] constexpr bool is_exhaustive( const std::array<size_t, MaxRank>& t_extents, const std::array<std::ptrdiff_t, MaxRank>& t_strides, size_t t_rank ) noexcept
+		{
+			if( t_rank == 0 || compute_size<MaxRank>( t_extents, t_rank ) == 0 )
+				return true;
+
+			// Insertion sort of the non-singleton dimensions by increasing stride
+			std::array<size_t, MaxRank> order { };
+			size_t count = 0;
+			for( size_t i = 0; i < t_rank; ++i )
+			{
+				if( t_extents[i] == 1 )
+					continue;
+				size_t pos = count++;
+				while( pos > 0 && t_strides[order[pos - 1]] > t_strides[i] )
+				{
+					order[pos] = order[pos - 1];
+					--pos;
+				}
+				order[pos] = i;
+			}
+
+			std::ptrdiff_t expected = 1;
+			for( size_t k = 0; k < count; ++k )
+			{
+				if( t_strides[order[k]] != expected )
+				{
+					return false;
+				}
+				expected *= static_cast<std::ptrdiff_t>( t_extents[order[k]] );
+			}
+			return true;
+		}
+
+		/// \brief Computes the strides of a view broadcast to a shape of equal or higher rank
+		/// \tparam MaxRank Maximum number of dimensions supported
+		/// \param t_extents Extents array of the view
+		/// \param t_strides Strides array of the view
+		/// \param t_rank Number of active dimensions of the view
+		/// \param t_target Target extents
+		/// \param t_target_rank Number of target dimensions
+		/// \param t_result Receives the strides of the broadcast view
+		/// \return False if the target rank is too small or too large, or a dimension is neither equal to the target nor 1
+		///
+		/// Dimensions are aligned at the end, as in NumPy. Leading dimensions and dimensions of extent 1
+		/// that are stretched get stride 0, so every index along them addresses the same elements.
+		template<size_t MaxRank>
+		[[nodiscard]] constexpr bool broadcast_strides( const std::array<size_t, MaxRank>& t_extents, const std::array<std::ptrdiff_t, MaxRank>& t_strides, size_t t_rank,
+		                                                const size_t* t_target, size_t t_target_rank, std::array<std::ptrdiff_t, MaxRank>& t_result ) noexcept
+		{
+			if( t_target_rank < t_rank || t_target_rank > MaxRank )
+			{
 				return false;
-			for( size_t i = t_rank - 1; i > 0; --i )
+			}
+			t_result          = { };
+			const size_t lead = t_target_rank - t_rank;
+			for( size_t i = 0; i < t_rank; ++i )
 			{
-				if( t_strides[i - 1] != t_strides[i] * t_extents[i] )
+				if( t_extents[i] == t_target[lead + i] )
+				{
+					t_result[lead + i] = t_strides[i];
+				}
+				else if( t_extents[i] != 1 )
 				{
 					return false;
 				}
@@ -160,7 +347,9 @@ namespace cppa
 		/// \brief Stride-aware random access iterator for nd_span
 		/// \tparam ElementType Element type (use const-qualified type for a const iterator)
 		/// \tparam MaxRank Maximum number of dimensions
-		template<typename ElementType, size_t MaxRank>
+		/// \tparam FirstIndexFastest Visit elements with the first index varying fastest (column-major order)
+		///                           instead of the last (row-major order)
+		template<typename ElementType, size_t MaxRank, bool FirstIndexFastest = false>
 		class nd_iterator
 		{
 		public:
@@ -179,7 +368,7 @@ namespace cppa
 			/// \param t_strides Stride of each dimension
 			/// \param t_rank Number of active dimensions
 			/// \param t_flat_start Starting flat index (0 = begin, total_size = end)
-			nd_iterator( pointer t_data, const std::array<size_type, MaxRank>& t_extents, const std::array<size_type, MaxRank>& t_strides, size_type t_rank,
+			nd_iterator( pointer t_data, const std::array<size_type, MaxRank>& t_extents, const std::array<difference_type, MaxRank>& t_strides, size_type t_rank,
 			             size_type t_flat_start = 0 )
 			    : m_data( t_data )
 			    , m_extents( t_extents )
@@ -197,7 +386,7 @@ namespace cppa
 
 			/// \brief Allow implicit conversion from non-const to const iterator
 			template<typename OtherTy, std::enable_if_t<std::is_const_v<ElementType> && !std::is_const_v<OtherTy>, int> = 0>
-			nd_iterator( const nd_iterator<OtherTy, MaxRank>& t_other )
+			nd_iterator( const nd_iterator<OtherTy, MaxRank, FirstIndexFastest>& t_other )
 			    : m_data( t_other.m_data )
 			    , m_ptr( t_other.m_ptr )
 			    , m_extents( t_other.m_extents )
@@ -226,27 +415,27 @@ namespace cppa
 
 			nd_iterator& operator++( )
 			{
-				advance( 1 );
+				increment( );
 				return *this;
 			}
 
 			nd_iterator operator++( int )
 			{
 				nd_iterator tmp = *this;
-				advance( 1 );
+				increment( );
 				return tmp;
 			}
 
 			nd_iterator& operator--( )
 			{
-				advance( -1 );
+				decrement( );
 				return *this;
 			}
 
 			nd_iterator operator--( int )
 			{
 				nd_iterator tmp = *this;
-				advance( -1 );
+				decrement( );
 				return tmp;
 			}
 
@@ -299,14 +488,17 @@ namespace cppa
 			pointer                        m_data       = nullptr;
 			pointer                        m_ptr        = nullptr;
 			std::array<size_type, MaxRank> m_extents{ };
-			std::array<size_type, MaxRank> m_strides{ };
+			std::array<difference_type, MaxRank> m_strides{ };
 			std::array<size_type, MaxRank> m_indices{ };
 			size_type                      m_rank       = 0;
 			size_type                      m_flat_size  = 0;
 			size_type                      m_flat_index = 0;
 
 			// Grant access to the opposite const-ness specialisation for the converting constructor
-			friend class nd_iterator<std::conditional_t<std::is_const_v<ElementType>, std::remove_const_t<ElementType>, const ElementType>, MaxRank>;
+			friend class nd_iterator<std::conditional_t<std::is_const_v<ElementType>, std::remove_const_t<ElementType>, const ElementType>, MaxRank, FirstIndexFastest>;
+
+			/// \brief Returns the dimension that varies t_n-th fastest in iteration order
+			[[nodiscard]] size_type dim_at( size_type t_n ) const noexcept { return FirstIndexFastest ? t_n : m_rank - 1 - t_n; }
 
 			/// \brief Updates the multi-dimensional indices and element pointer from the current flat index
 			void update_from_flat_index( )
@@ -316,26 +508,87 @@ namespace cppa
 					m_ptr = nullptr;
 					return;
 				}
-				// Decompose flat index into per-dimension indices (row-major)
+				// Decompose flat index into per-dimension indices, fastest varying dimension first
 				size_type f = m_flat_index;
-				for( int i = static_cast<int>( m_rank ) - 1; i >= 0; --i )
+				for( size_type n = 0; n < m_rank; ++n )
 				{
-					m_indices[i] = f % m_extents[i];
+					const size_type i = dim_at( n );
+					m_indices[i]      = f % m_extents[i];
 					f /= m_extents[i];
 				}
 				// Compute element pointer using strides
 				m_ptr = m_data;
 				for( size_type i = 0; i < m_rank; ++i )
 				{
-					m_ptr += m_indices[i] * m_strides[i];
+					m_ptr += static_cast<difference_type>( m_indices[i] ) * m_strides[i];
+				}
+			}
+
+			/// \brief Steps forward by one element, carrying over the indices like an odometer
+			/// \note Only the dimensions that wrap around are touched, no division is required
+			void increment( )
+			{
+				if( m_flat_index >= m_flat_size )
+					return;
+				if( ++m_flat_index == m_flat_size )
+				{
+					m_ptr = nullptr;
+					return;
+				}
+				for( size_type n = 0; n < m_rank; ++n )
+				{
+					const size_type i = dim_at( n );
+					if( ++m_indices[i] < m_extents[i] )
+					{
+						m_ptr += m_strides[i];
+						return;
+					}
+					m_ptr -= static_cast<difference_type>( m_extents[i] - 1 ) * m_strides[i];
+					m_indices[i] = 0;
+				}
+			}
+
+			/// \brief Steps backward by one element, borrowing from the outer indices like an odometer
+			void decrement( )
+			{
+				if( m_flat_index == 0 )
+					return;
+				if( m_flat_index-- == m_flat_size )
+				{
+					// The past-the-end state carries no indices, recompute them once
+					update_from_flat_index( );
+					return;
+				}
+				for( size_type n = 0; n < m_rank; ++n )
+				{
+					const size_type i = dim_at( n );
+					if( m_indices[i] > 0 )
+					{
+						--m_indices[i];
+						m_ptr -= m_strides[i];
+						return;
+					}
+					m_indices[i] = m_extents[i] - 1;
+					m_ptr += static_cast<difference_type>( m_extents[i] - 1 ) * m_strides[i];
 				}
 			}
 
 			/// \brief Moves the iterator by t_n positions (positive = forward, negative = backward)
+			/// \note Unit steps use the incremental path, larger jumps recompute the indices from the flat index
 			void advance( difference_type t_n )
 			{
 				if( t_n == 0 )
 					return;
+				if( t_n == 1 )
+				{
+					increment( );
+					return;
+				}
+				if( t_n == -1 )
+				{
+					decrement( );
+					return;
+				}
 				const auto signed_index = static_cast<difference_type>( m_flat_index ) + t_n;
 				if( signed_index < 0 )
 				{
@@ -353,119 +606,1419 @@ namespace cppa
 			}
 		};
 
-	} // namespace detail
+		/// \brief Uninitialized in-object storage for up to Capacity elements
+		template<typename Ty, size_t Capacity>
+		struct inline_buffer
+		{
+			alignas( Ty ) unsigned char m_bytes[sizeof( Ty ) * Capacity]; ///< Raw element storage
 
-	/// \class nd_span
-	/// \brief Non-owning view over multi-dimensional data with dynamic rank
-	/// \tparam T Element type
-	/// \tparam MaxRank Maximum number of dimensions (default: 8)
-	///
-	/// nd_span provides a lightweight, non-owning reference to multi-dimensional data.
-	/// It's similar to std::span but for multiple dimensions, like C++23's std::mdspan.
-	/// The actual rank is determined at runtime but cannot exceed MaxRank.
-	///
-	/// <b>Memory Layout</b>
-	///
-	/// Data is assumed to be in row-major (C-style) order where the last dimension
-	/// varies fastest in memory.
-	///
-	/// <b>Typical Usage</b>
-	///
-	/// \code
-	/// double data[12];
-	/// nd_span<double> span(data, 3, 4);  // 3x4 matrix
-	/// span(1, 2) = 5.0;  // Access element at row 1, column 2
-	/// \endcode
-	template<typename Ty, size_t MaxRank = 8>
-	class nd_span
-	{
-	public:
-		using value_type      = Ty;        ///< Type of elements
-		using size_type       = size_t;    ///< Type for sizes and indices
-		using reference       = Ty&;       ///< Reference to element
-		using const_reference = const Ty&; ///< Const reference to element
-		using pointer         = Ty*;       ///< Pointer to element
-		using const_pointer   = const Ty*; ///< Const pointer to element
+			[[nodiscard]] Ty* inline_data( ) noexcept { return reinterpret_cast<Ty*>( m_bytes ); }
+			[[nodiscard]] const Ty* inline_data( ) const noexcept { return reinterpret_cast<const Ty*>( m_bytes ); }
+		};
 
-		/// \brief Constructs a span from raw data with explicit extents and strides
-		/// \param t_data Pointer to the first element
-		/// \param t_extents Sizes of each dimension
-		/// \param t_strides Stride values for each dimension
-		/// \param t_rank Number of dimensions (must be <= MaxRank)
-		/// \note This is the primary constructor used by subspan/slice operations
-		constexpr nd_span( pointer t_data, const std::array<size_type, MaxRank>& t_extents, const std::array<size_type, MaxRank>& t_strides, size_type t_rank ) noexcept
-		    : m_data( t_data )
-		    , m_extents( t_extents )
-		    , m_strides( t_strides )
-		    , m_rank( t_rank )
+		/// \brief Empty specialization so arrays without inline storage keep their size
+		template<typename Ty>
+		struct inline_buffer<Ty, 0>
 		{
-		}
+			[[nodiscard]] Ty* inline_data( ) noexcept { return nullptr; }
+			[[nodiscard]] const Ty* inline_data( ) const noexcept { return nullptr; }
+		};
 
-		/// \brief Constructs a span from raw data with dimension sizes
-		/// \param t_data Pointer to the first element
-		/// \param t_extents Initializer list of dimension sizes {dim0, dim1, ...}
-		/// \throws std::invalid_argument if number of dimensions exceeds MaxRank
-		/// \example
-		/// \code
-		/// double data[12];
-		/// nd_span<double> span(data, {3, 4});  // 3x4 matrix
-		/// \endcode
-		nd_span( pointer t_data, std::initializer_list<size_type> t_extents ) : m_data( t_data ), m_rank( t_extents.size( ) )
+		/// \brief Owning element buffer obtained from an allocator
+		/// \tparam Ty Element type
+		/// \tparam Allocator Allocator used for the single allocation (stored via empty base optimization)
+		/// \tparam InlineCapacity Buffers of up to this many elements live inside the object (default: 0)
+		///
+		/// Elements are constructed and destroyed through std::allocator_traits, so scoped and
+		/// polymorphic allocators behave as they do for standard containers. Heap buffers change
+		/// hands on move, inline buffers move their elements one by one.
+		template<typename Ty, typename Allocator, size_t InlineCapacity = 0>
+		class array_storage : private Allocator, private inline_buffer<Ty, InlineCapacity>
 		{
-			if( m_rank > MaxRank )
+		public:
+			using allocator_type = Allocator;
+			using traits         = std::allocator_traits<Allocator>;
+			using size_type      = size_t;
+			using pointer        = Ty*;
+
+			static_assert( std::is_same_v<typename traits::value_type, Ty>, "Allocator value_type must match the element type" );
+			static_assert( std::is_same_v<typename traits::pointer, Ty*>, "Allocator must use raw pointers" );
+			static_assert( InlineCapacity == 0 || std::is_nothrow_move_constructible_v<Ty>, "Inline storage requires nothrow move constructible elements" );
+
+			array_storage( ) = default;
+
+			explicit array_storage( const allocator_type& t_alloc ) noexcept : Allocator( t_alloc ) {}
+
+			array_storage( const array_storage& ) = delete;
+
+			array_storage( array_storage&& t_other ) noexcept : Allocator( std::move( t_other.allocator( ) ) )
 			{
-				throw std::invalid_argument( "Rank exceeds MaxRank" );
+				if( t_other.holds_inline( ) )
+				{
+					adopt_inline( t_other );
+				}
+				else
+				{
+					m_data     = std::exchange( t_other.m_data, nullptr );
+					m_count    = std::exchange( t_other.m_count, 0 );
+					m_capacity = std::exchange( t_other.m_capacity, 0 );
+				}
 			}
 
-			size_t idx = 0;
-			for( auto extent: t_extents )
+			array_storage& operator=( const array_storage& ) = delete;
+
+			array_storage& operator=( array_storage&& t_other ) noexcept( traits::propagate_on_container_move_assignment::value || traits::is_always_equal::value )
 			{
-				m_extents[idx++] = extent;
+				if( this == &t_other )
+				{
+					return *this;
+				}
+				if constexpr( traits::propagate_on_container_move_assignment::value )
+				{
+					reset( );
+					allocator( ) = std::move( t_other.allocator( ) );
+				}
+				else if( !traits::is_always_equal::value && allocator( ) != t_other.allocator( ) )
+				{
+					// The buffer cannot change hands, move the elements into our own allocation
+					allocate_from( std::make_move_iterator( t_other.m_data ), t_other.m_count );
+					t_other.reset( );
+					return *this;
+				}
+				else
+				{
+					reset( );
+				}
+				if( t_other.holds_inline( ) )
+				{
+					adopt_inline( t_other );
+					return *this;
+				}
+				m_data     = std::exchange( t_other.m_data, nullptr );
+				m_count    = std::exchange( t_other.m_count, 0 );
+				m_capacity = std::exchange( t_other.m_capacity, 0 );
+				return *this;
 			}
-			for( size_t i = m_rank; i < MaxRank; ++i )
+
+			~array_storage( ) { reset( ); }
+
+			[[nodiscard]] allocator_type& allocator( ) noexcept { return *this; }
+			[[nodiscard]] const allocator_type& allocator( ) const noexcept { return *this; }
+
+			[[nodiscard]] pointer get( ) const noexcept { return m_data; }
+			[[nodiscard]] Ty& operator[]( size_type t_index ) const noexcept { return m_data[t_index]; }
+			[[nodiscard]] size_type count( ) const noexcept { return m_count; }
+
+			/// \brief Number of elements the buffer can hold without reallocating
+			[[nodiscard]] size_type capacity( ) const noexcept { return m_data == nullptr ? InlineCapacity : m_capacity; }
+
+			/// \brief True if the elements live in the in-object buffer
+			[[nodiscard]] bool holds_inline( ) const noexcept
 			{
-				m_extents[i] = 0;
+				if constexpr( InlineCapacity > 0 )
+				{
+					return m_data != nullptr && m_data == this->inline_data( );
+				}
+				else
+				{
+					return false;
+				}
 			}
 
-			compute_strides( );
-		}
+			/// \brief Replaces the buffer with t_count value-initialized elements
+			void allocate( size_type t_count )
+			{
+				allocate_with( t_count, [this]( pointer t_ptr, size_type /*t_index*/ ) { traits::construct( allocator( ), t_ptr ); } );
+			}
 
-		/// \brief Constructs a span from raw data with a container of dimension sizes
-		/// \tparam Container Type of container holding extents (e.g., std::vector<size_t>)
-		/// \param t_data Pointer to the first element
-		/// \param t_extents Container with dimension sizes
-		/// \throws std::invalid_argument if number of dimensions exceeds MaxRank
-		/// \example
-		/// \code
-		/// double data[24];
-		/// std::vector<size_t> dims = {2, 3, 4};
-		/// nd_span<double> span(data, dims);  // 2x3x4 array
-		/// \endcode
-		template<typename Container>
-		nd_span( pointer t_data, const Container& t_extents, std::enable_if_t<!std::is_integral_v<Container> && !std::is_same_v<Container, nd_span>>* = nullptr )
-		    : m_data( t_data )
-		    , m_rank( t_extents.size( ) )
-		{
-			if( m_rank > MaxRank )
+			/// \brief Replaces the buffer with t_count default-initialized elements
+			/// \note Trivially default constructible elements are left untouched, others are value-initialized
+			void allocate_for_overwrite( size_type t_count )
 			{
-				throw std::invalid_argument( "Rank exceeds MaxRank" );
+				if constexpr( std::is_trivially_default_constructible_v<Ty> )
+				{
+					allocate_with( t_count, []( pointer /*t_ptr*/, size_type /*t_index*/ ) { } );
+				}
+				else
+				{
+					allocate( t_count );
+				}
 			}
 
-			size_t idx = 0;
-			for( auto extent: t_extents )
+			/// \brief Replaces the buffer with t_count elements constructed from a source range
+			template<typename InputIt>
+			void allocate_from( InputIt t_first, size_type t_count )
 			{
-				m_extents[idx++] = static_cast<size_type>( extent );
+				allocate_with( t_count, [this, &t_first]( pointer t_ptr, size_type /*t_index*/ ) { traits::construct( allocator( ), t_ptr, *t_first++ ); } );
 			}
-			for( size_t i = m_rank; i < MaxRank; ++i )
+
+			/// \brief Replaces the elements with copies of [t_first, t_first + t_count), reusing the buffer if it is large enough
+			/// \note Only a reallocation gives the strong guarantee; in place the basic guarantee applies, as for std::vector
+			void assign( const Ty* t_first, size_type t_count )
 			{
-				m_extents[i] = 0;
+				if( t_count > capacity( ) )
+				{
+					allocate_from( t_first, t_count );
+					return;
+				}
+				bind_inline( );
+				std::copy( t_first, t_first + std::min( m_count, t_count ), m_data );
+				for( ; m_count < t_count; ++m_count )
+				{
+					traits::construct( allocator( ), m_data + m_count, t_first[m_count] );
+				}
+				truncate( t_count );
 			}
 
-			compute_strides( );
-		}
+			/// \brief Keeps the first t_count elements, value-initializing new ones; the buffer only grows
+			void resize( size_type t_count )
+			{
+				reserve( t_count );
+				bind_inline( );
+				for( ; m_count < t_count; ++m_count )
+				{
+					traits::construct( allocator( ), m_data + m_count );
+				}
+				truncate( t_count );
+			}
 
-		/// \brief Constructs a span from raw data with variadic dimension sizes
-		/// \tparam Indices Variadic index types (typically size_t or convertible to size_t)
+			/// \brief Grows the buffer to hold at least t_count elements, moving the existing ones (strong guarantee)
+			void reserve( size_type t_count )
+			{
+				if( t_count <= capacity( ) )
+				{
+					return;
+				}
+				pointer data          = traits::allocate( allocator( ), t_count );
+				size_type constructed = 0;
+				ND_ARRAY_COUNT( allocations, 1 );
+				ND_ARRAY_COUNT( allocated_bytes, t_count * sizeof( Ty ) );
+				try
+				{
+					for( ; constructed < m_count; ++constructed )
+					{
+						traits::construct( allocator( ), data + constructed, std::move_if_noexcept( m_data[constructed] ) );
+					}
+				}
+				catch( ... )
+				{
+					destroy( data, constructed );
+					traits::deallocate( allocator( ), data, t_count );
+					throw;
+				}
+				reset( );
+				m_data     = data;
+				m_count    = constructed;
+				m_capacity = t_count;
+			}
+
+			/// \brief Destroys all elements and releases the buffer
+			void reset( ) noexcept
+			{
+				if( m_data != nullptr )
+				{
+					destroy( m_data, m_count );
+					if( !holds_inline( ) )
+					{
+						traits::deallocate( allocator( ), m_data, m_capacity );
+					}
+					m_data     = nullptr;
+					m_count    = 0;
+					m_capacity = 0;
+				}
+			}
+
+		private:
+			pointer m_data       = nullptr; ///< First element of the buffer
+			size_type m_count    = 0;       ///< Number of constructed elements
+			size_type m_capacity = 0;       ///< Number of elements the buffer has room for
+
+			/// \brief Points an empty storage at its inline buffer, so capacity() elements can be constructed in place
+			void bind_inline( ) noexcept
+			{
+				if( InlineCapacity > 0 && m_data == nullptr )
+				{
+					m_data     = this->inline_data( );
+					m_capacity = InlineCapacity;
+				}
+			}
+
+			/// \brief Destroys the elements past the first t_count
+			void truncate( size_type t_count ) noexcept
+			{
+				if( t_count < m_count )
+				{
+					destroy( m_data + t_count, m_count - t_count );
+					m_count = t_count;
+				}
+			}
+
+			/// \brief Filling the buffer cannot throw, so the inline buffer may be released before it is rebuilt
+			static constexpr bool nothrow_rebuild = std::is_nothrow_default_constructible_v<Ty> && std::is_nothrow_copy_constructible_v<Ty>;
+
+			/// \brief Moves the inline elements of t_other into this (empty) storage and empties t_other
+			void adopt_inline( array_storage& t_other ) noexcept
+			{
+				pointer data = this->inline_data( );
+				for( size_type i = 0; i < t_other.m_count; ++i )
+				{
+					traits::construct( allocator( ), data + i, std::move( t_other.m_data[i] ) );
+				}
+				m_data     = data;
+				m_count    = t_other.m_count;
+				m_capacity = InlineCapacity;
+				t_other.reset( );
+			}
+
+			/// \brief Builds a new buffer and only releases the current one on success (strong guarantee)
+			/// \note Small buffers are built inline. If the inline buffer is in use and rebuilding it could
+			///       throw, the new buffer goes to the heap instead to keep the guarantee.
+			template<typename Construct>
+			void allocate_with( size_type t_count, Construct&& t_construct )
+			{
+				const bool use_inline = t_count > 0 && t_count <= InlineCapacity && ( nothrow_rebuild || !holds_inline( ) );
+				if( use_inline && holds_inline( ) )
+				{
+					reset( );
+				}
+				pointer data          = use_inline ? this->inline_data( ) : t_count > 0 ? traits::allocate( allocator( ), t_count ) : nullptr;
+				size_type constructed = 0;
+				ND_ARRAY_COUNT( allocations, data != nullptr && !use_inline ? 1 : 0 );
+				ND_ARRAY_COUNT( allocated_bytes, data != nullptr && !use_inline ? t_count * sizeof( Ty ) : 0 );
+				try
+				{
+					for( ; constructed < t_count; ++constructed )
+					{
+						t_construct( data + constructed, constructed );
+					}
+				}
+				catch( ... )
+				{
+					destroy( data, constructed );
+					if( !use_inline )
+					{
+						traits::deallocate( allocator( ), data, t_count );
+					}
+					throw;
+				}
+				reset( );
+				m_data     = data;
+				m_count    = t_count;
+				m_capacity = use_inline ? InlineCapacity : t_count;
+			}
+
+			void destroy( pointer t_data, size_type t_count ) noexcept
+			{
+				if constexpr( !std::is_trivially_destructible_v<Ty> )
+				{
+					for( size_type i = 0; i < t_count; ++i )
+					{
+						traits::destroy( allocator( ), t_data + i );
+					}
+				}
+			}
+		};
+
+		/// \brief Resolves a requested thread count (0 = hardware concurrency, at least 1)
+		[[nodiscard]] inline size_t resolve_thread_count( size_t t_requested ) noexcept
+		{
+			if( t_requested == 0 )
+			{
+				t_requested = std::thread::hardware_concurrency( );
+			}
+			return t_requested == 0 ? 1 : t_requested;
+		}
+
+		/// \brief Number of rows per block when t_rows are split over t_threads workers
+		[[nodiscard]] constexpr size_t row_block_size( size_t t_rows, size_t t_threads ) noexcept { return ( t_rows + t_threads - 1 ) / t_threads; }
+
+		/// \brief Runs t_func over blocks of the outermost dimension on up to t_thread_count threads
+		/// \tparam Func Callable invoked as t_func( first_row, last_row ) for a half-open row range
+		/// \param t_rows Extent of the outermost dimension
+		/// \param t_thread_count Requested number of threads (0 = hardware concurrency)
+		/// \param t_func Work item, the first block runs on the calling thread
+		/// \note Blocks are contiguous and of equal size (up to rounding), so repeated calls with the same
+		///       arguments assign the same rows to the same worker index. The first exception is rethrown.
+		template<typename Func>
+		void parallel_for_rows( size_t t_rows, size_t t_thread_count, Func&& t_func )
+		{
+			const size_t threads = std::min( resolve_thread_count( t_thread_count ), t_rows );
+			if( threads <= 1 )
+			{
+				if( t_rows > 0 )
+				{
+					t_func( size_t { 0 }, t_rows );
+				}
+				return;
+			}
+
+			const size_t block = row_block_size( t_rows, threads );
+			std::vector<std::thread> workers;
+			std::vector<std::exception_ptr> errors( threads );
+			workers.reserve( threads - 1 );
+			for( size_t t = 1; t < threads; ++t )
+			{
+				const size_t first = std::min( t * block, t_rows );
+				const size_t last  = std::min( first + block, t_rows );
+				workers.emplace_back(
+				    [&t_func, &errors, t, first, last]( )
+				    {
+					    try
+					    {
+						    if( first < last )
+						    {
+							    t_func( first, last );
+						    }
+					    }
+					    catch( ... )
+					    {
+						    errors[t] = std::current_exception( );
+					    }
+				    } );
+			}
+			try
+			{
+				t_func( size_t { 0 }, std::min( block, t_rows ) );
+			}
+			catch( ... )
+			{
+				errors[0] = std::current_exception( );
+			}
+			for( auto& worker: workers )
+			{
+				worker.join( );
+			}
+			for( const auto& error: errors )
+			{
+				if( error )
+				{
+					std::rethrow_exception( error );
+				}
+			}
+		}
+
+		/// \brief Reduces blocks of the outermost dimension in parallel and combines the partial results in block order
+		/// \tparam Func Callable invoked as t_func( first_row, last_row, std::optional<Ty>& partial )
+		/// \param t_rows Extent of the outermost dimension
+		/// \param t_thread_count Requested number of threads (0 = hardware concurrency)
+		/// \param t_init Initial value, combined with the partial results from the left
+		/// \param t_reduce Associative binary operation
+		/// \param t_func Work item folding its rows into partial (left empty for an empty block)
+		template<typename Ty, typename Reduce, typename Func>
+		[[nodiscard]] Ty parallel_reduce_rows( size_t t_rows, size_t t_thread_count, Ty t_init, Reduce& t_reduce, Func&& t_func )
+		{
+			const size_t threads = std::max( size_t { 1 }, std::min( resolve_thread_count( t_thread_count ), t_rows ) );
+			const size_t block   = row_block_size( t_rows, threads );
+			std::vector<std::optional<Ty>> partials( threads );
+			parallel_for_rows( t_rows, t_thread_count,
+			                   [&]( size_t t_first, size_t t_last ) { simd_dispatch( [&] { t_func( t_first, t_last, partials[t_first / block] ); } ); } );
+			for( auto& partial: partials )
+			{
+				if( partial )
+				{
+					t_init = t_reduce( std::move( t_init ), std::move( *partial ) );
+				}
+			}
+			return t_init;
+		}
+
+		/// \brief Linear offset of the row starting at t_index, using the first t_count dimensions
+		template<size_t MaxRank>
+		[[nodiscard]] constexpr std::ptrdiff_t row_offset( const std::array<size_t, MaxRank>& t_index, const std::array<std::ptrdiff_t, MaxRank>& t_strides,
+		                                                   size_t t_count ) noexcept
+		{
+			std::ptrdiff_t offset = 0;
+			for( size_t i = 0; i < t_count; ++i )
+			{
+				offset += static_cast<std::ptrdiff_t>( t_index[i] ) * t_strides[i];
+			}
+			return offset;
+		}
+
+		template<typename Func, size_t N, size_t... Is>
+		void for_each_in_row( Func& t_func, const std::array<std::ptrdiff_t, N>& t_base, const std::array<std::ptrdiff_t, N>& t_step, size_t t_count,
+		                      std::index_sequence<Is...> )
+		{
+			const auto count = static_cast<std::ptrdiff_t>( t_count );
+			for( std::ptrdiff_t j = 0; j < count; ++j )
+			{
+				t_func( ( t_base[Is] + j * t_step[Is] )... );
+			}
+		}
+
+		/// \brief Calls t_func( offsets... ) for every element whose outermost index lies in [t_first, t_last)
+		/// \param t_extents Shared extents of all operands
+		/// \param t_rank Number of dimensions
+		/// \param t_first First index of the outermost dimension
+		/// \param t_last One past the last index of the outermost dimension
+		/// \param t_func Callable receiving one linear offset per operand
+		/// \param t_strides Stride array of each operand, offsets are passed in the same order
+		/// \note Elements are visited in row-major order; the innermost dimension is a constant-stride loop
+		template<size_t MaxRank, typename Func, typename... Strides>
+		void for_each_offset( const std::array<size_t, MaxRank>& t_extents, size_t t_rank, size_t t_first, size_t t_last, Func&& t_func,
+		                      const Strides&... t_strides )
+		{
+			constexpr size_t operands = sizeof...( Strides );
+			if( t_rank == 0 || t_first >= t_last )
+			{
+				return;
+			}
+
+			const size_t last_dim                            = t_rank - 1;
+			const std::array<std::ptrdiff_t, operands> steps = { t_strides[last_dim]... };
+			if( t_rank == 1 )
+			{
+				const std::array<std::ptrdiff_t, operands> base = { ( static_cast<std::ptrdiff_t>( t_first ) * t_strides[0] )... };
+				for_each_in_row( t_func, base, steps, t_last - t_first, std::make_index_sequence<operands> { } );
+				return;
+			}
+
+			std::array<size_t, MaxRank> index { };
+			index[0] = t_first;
+			for( ;; )
+			{
+				const std::array<std::ptrdiff_t, operands> base = { row_offset<MaxRank>( index, t_strides, last_dim )... };
+				for_each_in_row( t_func, base, steps, t_extents[last_dim], std::make_index_sequence<operands> { } );
+
+				size_t dim = last_dim;
+				while( dim-- > 0 )
+				{
+					if( ++index[dim] < ( dim == 0 ? t_last : t_extents[dim] ) )
+					{
+						break;
+					}
+					if( dim == 0 )
+					{
+						return;
+					}
+					index[dim] = 0;
+				}
+			}
+		}
+
+		/// \brief Extent and stride of one dimension of a memory-order traversal
+		struct stride_dim
+		{
+			size_t extent;         ///< Number of elements
+			std::ptrdiff_t stride; ///< Stride in elements
+		};
+
+		/// \brief Orders the dimensions of a non-empty view as they are laid out in memory
+		/// \param t_extents Extents of the view
+		/// \param t_strides Strides of the view
+		/// \param t_rank Number of dimensions
+		/// \param t_dims Receives the dimensions, outermost (largest stride) first
+		/// \param t_origin Receives the offset of the lowest-addressed element, where the traversal starts
+		/// \return Number of dimensions written, 0 if the view holds a single element
+		///
+		/// Singleton dimensions are dropped, reversed dimensions are walked forwards from their last element,
+		/// the rest are sorted by decreasing stride and adjacent dimensions that are nested in memory
+		/// (outer stride == inner stride * inner extent) are merged.
+		template<size_t MaxRank>
+		size_t memory_order_dims( const std::array<size_t, MaxRank>& t_extents, const std::array<std::ptrdiff_t, MaxRank>& t_strides, size_t t_rank,
+		                          std::array<stride_dim, MaxRank>& t_dims, std::ptrdiff_t& t_origin ) noexcept
+		{
+			size_t rank = 0;
+			t_origin    = 0;
+			for( size_t i = 0; i < t_rank; ++i )
+			{
+				if( t_extents[i] > 1 )
+				{
+					if( t_strides[i] < 0 )
+					{
+						t_origin += static_cast<std::ptrdiff_t>( t_extents[i] - 1 ) * t_strides[i];
+					}
+					t_dims[rank++] = { t_extents[i], t_strides[i] < 0 ? -t_strides[i] : t_strides[i] };
+				}
+			}
+
+			// Insertion sort, ranks are small and ties must keep the logical order
+			for( size_t i = 1; i < rank; ++i )
+			{
+				const stride_dim dim = t_dims[i];
+				size_t j             = i;
+				for( ; j > 0 && t_dims[j - 1].stride < dim.stride; --j )
+				{
+					t_dims[j] = t_dims[j - 1];
+				}
+				t_dims[j] = dim;
+			}
+
+			size_t merged = 0;
+			for( size_t i = 0; i < rank; ++i )
+			{
+				if( merged > 0 && t_dims[merged - 1].stride == t_dims[i].stride * static_cast<std::ptrdiff_t>( t_dims[i].extent ) )
+				{
+					t_dims[merged - 1] = { t_dims[merged - 1].extent * t_dims[i].extent, t_dims[i].stride };
+				}
+				else
+				{
+					t_dims[merged++] = t_dims[i];
+				}
+			}
+			return merged;
+		}
+
+		/// \brief Merges adjacent dimensions that are nested in every operand, keeping the row-major visit order
+		/// \param t_extents Shared extents, rewritten in place
+		/// \param t_rank Number of dimensions
+		/// \param t_strides Stride arrays of each operand, rewritten in place
+		/// \return New rank; a non-empty view keeps at least one dimension, empty views are left unchanged
+		///
+		/// Singleton dimensions are dropped and dimension i is folded into its outer neighbour k when
+		/// stride[k] == stride[i] * extent[i] holds for all operands. Unused trailing entries are zeroed.
+		template<size_t MaxRank, typename... Strides>
+		size_t coalesce_dims( std::array<size_t, MaxRank>& t_extents, size_t t_rank, Strides&... t_strides ) noexcept
+		{
+			if( t_rank == 0 || compute_size<MaxRank>( t_extents, t_rank ) == 0 )
+			{
+				return t_rank;
+			}
+
+			size_t rank = 0;
+			for( size_t i = 0; i < t_rank; ++i )
+			{
+				if( t_extents[i] == 1 )
+				{
+					continue;
+				}
+				if( rank > 0 && ( ( t_strides[rank - 1] == t_strides[i] * static_cast<std::ptrdiff_t>( t_extents[i] ) ) && ... ) )
+				{
+					t_extents[rank - 1] *= t_extents[i];
+					( ( t_strides[rank - 1] = t_strides[i] ), ... );
+				}
+				else
+				{
+					t_extents[rank] = t_extents[i];
+					( ( t_strides[rank] = t_strides[i] ), ... );
+					++rank;
+				}
+			}
+			if( rank == 0 )
+			{
+				t_extents[0] = 1;
+				( ( t_strides[0] = 1 ), ... );
+				rank = 1;
+			}
+			for( size_t i = rank; i < MaxRank; ++i )
+			{
+				t_extents[i] = 0;
+				( ( t_strides[i] = 0 ), ... );
+			}
+			return rank;
+		}
+
+		/// \brief Calls t_func( offset ) for every element of dimensions from memory_order_dims whose outermost index lies in [t_first, t_last)
+		/// \param t_dims Dimensions, outermost first
+		/// \param t_rank Number of dimensions (0 visits the single element at offset 0 when t_first < t_last)
+		/// \param t_first First index of the outermost dimension
+		/// \param t_last One past the last index of the outermost dimension
+		/// \param t_func Callable receiving the linear offset of each element
+		template<size_t MaxRank, typename Func>
+		void for_each_in_memory_order( const std::array<stride_dim, MaxRank>& t_dims, size_t t_rank, size_t t_first, size_t t_last, Func&& t_func )
+		{
+			if( t_first >= t_last )
+			{
+				return;
+			}
+			if( t_rank == 0 )
+			{
+				t_func( std::ptrdiff_t { 0 } );
+				return;
+			}
+
+			const stride_dim inner = t_dims[t_rank - 1];
+			if( t_rank == 1 )
+			{
+				for( auto j = static_cast<std::ptrdiff_t>( t_first ); j < static_cast<std::ptrdiff_t>( t_last ); ++j )
+				{
+					t_func( j * inner.stride );
+				}
+				return;
+			}
+
+			const auto inner_extent = static_cast<std::ptrdiff_t>( inner.extent );
+			std::array<size_t, MaxRank> index { };
+			index[0]              = t_first;
+			std::ptrdiff_t offset = static_cast<std::ptrdiff_t>( t_first ) * t_dims[0].stride;
+			for( ;; )
+			{
+				for( std::ptrdiff_t j = 0; j < inner_extent; ++j )
+				{
+					t_func( offset + j * inner.stride );
+				}
+
+				size_t dim = t_rank - 1;
+				for( ;; )
+				{
+					--dim;
+					offset += t_dims[dim].stride;
+					if( ++index[dim] < ( dim == 0 ? t_last : t_dims[dim].extent ) )
+					{
+						break;
+					}
+					if( dim == 0 )
+					{
+						return;
+					}
+					offset -= t_dims[dim].stride * static_cast<std::ptrdiff_t>( t_dims[dim].extent );
+					index[dim] = 0;
+				}
+			}
+		}
+
+		/// \brief Extent and strides of one dimension of a strided copy
+		struct copy_dim
+		{
+			size_t extent;             ///< Number of elements
+			std::ptrdiff_t dst_stride; ///< Destination stride
+			std::ptrdiff_t src_stride; ///< Source stride
+		};
+
+		/// \brief Edge length of the square tiles used when source and destination are unit-stride along different dimensions
+		inline constexpr size_t transpose_tile = 32;
+
+		/// \brief Calls t_body( dst_offset, src_offset ) for every index combination of the first t_count copy dimensions
+		template<size_t MaxRank, typename Body>
+		void for_each_copy_position( const std::array<copy_dim, MaxRank>& t_dims, size_t t_count, Body&& t_body )
+		{
+			std::array<size_t, MaxRank> index { };
+			std::ptrdiff_t dst_offset = 0;
+			std::ptrdiff_t src_offset = 0;
+			for( ;; )
+			{
+				t_body( dst_offset, src_offset );
+
+				size_t dim = t_count;
+				for( ;; )
+				{
+					if( dim == 0 )
+					{
+						return;
+					}
+					--dim;
+					dst_offset += t_dims[dim].dst_stride;
+					src_offset += t_dims[dim].src_stride;
+					if( ++index[dim] < t_dims[dim].extent )
+					{
+						break;
+					}
+					dst_offset -= t_dims[dim].dst_stride * static_cast<std::ptrdiff_t>( t_dims[dim].extent );
+					src_offset -= t_dims[dim].src_stride * static_cast<std::ptrdiff_t>( t_dims[dim].extent );
+					index[dim] = 0;
+				}
+			}
+		}
+
+		/// \brief Copies a t_rows x t_cols tile, writing along t_col and reading along t_row
+		template<typename DstTy, typename SrcTy>
+		void copy_tile( DstTy* t_dst, const SrcTy* t_src, const copy_dim& t_row, const copy_dim& t_col, size_t t_rows, size_t t_cols )
+		{
+			constexpr auto tile = static_cast<std::ptrdiff_t>( transpose_tile );
+			if( t_rows == transpose_tile && t_cols == transpose_tile )
+			{
+				// Fixed trip counts let the compiler unroll and vectorize full tiles
+				for( std::ptrdiff_t i = 0; i < tile; ++i )
+				{
+					for( std::ptrdiff_t j = 0; j < tile; ++j )
+					{
+						t_dst[i * t_row.dst_stride + j * t_col.dst_stride] = static_cast<DstTy>( t_src[i * t_row.src_stride + j * t_col.src_stride] );
+					}
+				}
+				return;
+			}
+			for( std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>( t_rows ); ++i )
+			{
+				for( std::ptrdiff_t j = 0; j < static_cast<std::ptrdiff_t>( t_cols ); ++j )
+				{
+					t_dst[i * t_row.dst_stride + j * t_col.dst_stride] = static_cast<DstTy>( t_src[i * t_row.src_stride + j * t_col.src_stride] );
+				}
+			}
+		}
+
+		/// \brief Copies a 2D block tile by tile
+		template<typename DstTy, typename SrcTy>
+		void copy_blocked( DstTy* t_dst, const SrcTy* t_src, const copy_dim& t_row, const copy_dim& t_col )
+		{
+			for( size_t i = 0; i < t_row.extent; i += transpose_tile )
+			{
+				const size_t rows = std::min( transpose_tile, t_row.extent - i );
+				for( size_t j = 0; j < t_col.extent; j += transpose_tile )
+				{
+					const size_t cols        = std::min( transpose_tile, t_col.extent - j );
+					const std::ptrdiff_t row = static_cast<std::ptrdiff_t>( i );
+					const std::ptrdiff_t col = static_cast<std::ptrdiff_t>( j );
+					copy_tile( t_dst + row * t_row.dst_stride + col * t_col.dst_stride, t_src + row * t_row.src_stride + col * t_col.src_stride, t_row, t_col, rows,
+					           cols );
+				}
+			}
+		}
+
+		/// \brief Copies elements between two strided layouts with the same extents
+		/// \param t_dst Destination of the first element
+		/// \param t_dst_strides Destination strides
+		/// \param t_src Source of the first element
+		/// \param t_src_strides Source strides
+		/// \param t_extents Shared extents
+		/// \param t_rank Number of dimensions
+		///
+		/// Singleton dimensions are dropped, dimensions reversed on the destination are walked from their last
+		/// element, the remaining ones are ordered by decreasing destination stride (so the innermost loop
+		/// writes with the smallest stride) and adjacent dimensions that are nested in both layouts are merged.
+		/// Unit-stride rows of the same trivially copyable type use memcpy; when the source is unit-stride
+		/// along another dimension (a transpose) the copy is blocked into square tiles.
+		template<size_t MaxRank, typename DstTy, typename SrcTy>
+		void strided_copy( DstTy* t_dst, const std::array<std::ptrdiff_t, MaxRank>& t_dst_strides, const SrcTy* t_src,
+		                   const std::array<std::ptrdiff_t, MaxRank>& t_src_strides, const std::array<size_t, MaxRank>& t_extents, size_t t_rank )
+		{
+			std::array<copy_dim, MaxRank> dims { };
+			size_t rank = 0;
+			for( size_t i = 0; i < t_rank; ++i )
+			{
+				if( t_extents[i] == 0 )
+				{
+					return;
+				}
+			}
+			for( size_t i = 0; i < t_rank; ++i )
+			{
+				if( t_extents[i] == 1 )
+				{
+					continue;
+				}
+				if( t_dst_strides[i] < 0 )
+				{
+					const auto last = static_cast<std::ptrdiff_t>( t_extents[i] - 1 );
+					t_dst += last * t_dst_strides[i];
+					t_src += last * t_src_strides[i];
+					dims[rank++] = { t_extents[i], -t_dst_strides[i], -t_src_strides[i] };
+				}
+				else
+				{
+					dims[rank++] = { t_extents[i], t_dst_strides[i], t_src_strides[i] };
+				}
+			}
+
+			// Innermost loop gets the smallest destination stride; ties keep the source order. An insertion sort
+			// of at most MaxRank entries stays small when inlined into every instruction set clone
+			for( size_t i = 1; i < rank; ++i )
+			{
+				const copy_dim dim = dims[i];
+				size_t j          = i;
+				for( ; j > 0 && dims[j - 1].dst_stride < dim.dst_stride; --j )
+				{
+					dims[j] = dims[j - 1];
+				}
+				dims[j] = dim;
+			}
+
+			size_t merged = 0;
+			for( size_t i = 0; i < rank; ++i )
+			{
+				const auto extent = static_cast<std::ptrdiff_t>( dims[i].extent );
+				if( merged > 0 && dims[merged - 1].dst_stride == dims[i].dst_stride * extent && dims[merged - 1].src_stride == dims[i].src_stride * extent )
+				{
+					dims[merged - 1] = { dims[merged - 1].extent * dims[i].extent, dims[i].dst_stride, dims[i].src_stride };
+				}
+				else
+				{
+					dims[merged++] = dims[i];
+				}
+			}
+			rank = merged;
+
+			if( rank == 0 )
+			{
+				*t_dst = static_cast<DstTy>( *t_src );
+				return;
+			}
+
+			// A different dimension is unit-stride on the source: walk square tiles so that the source
+			// lines of a tile stay in cache while the destination is written with unit stride
+			const auto src_distance = []( const copy_dim& t_dim ) { return t_dim.src_stride < 0 ? -t_dim.src_stride : t_dim.src_stride; };
+			if( rank >= 2 && src_distance( dims[rank - 1] ) > 1 )
+			{
+				size_t tiled = 0;
+				for( size_t i = 1; i + 1 < rank; ++i )
+				{
+					if( src_distance( dims[i] ) < src_distance( dims[tiled] ) )
+					{
+						tiled = i;
+					}
+				}
+				if( src_distance( dims[tiled] ) < src_distance( dims[rank - 1] ) )
+				{
+					const copy_dim row = dims[tiled];
+					const copy_dim col = dims[rank - 1];
+					std::rotate( dims.begin( ) + tiled, dims.begin( ) + tiled + 1, dims.begin( ) + rank - 1 );
+					ND_ARRAY_COUNT( element_wise_copies, 1 );
+					for_each_copy_position<MaxRank>( dims, rank - 2, [&]( std::ptrdiff_t t_dst_offset, std::ptrdiff_t t_src_offset )
+					                                 { copy_blocked( t_dst + t_dst_offset, t_src + t_src_offset, row, col ); } );
+					return;
+				}
+			}
+
+			const copy_dim inner = dims[rank - 1];
+			ND_ARRAY_COUNT( element_wise_copies, ( std::is_same_v<std::remove_const_t<SrcTy>, DstTy> && std::is_trivially_copyable_v<DstTy> && inner.dst_stride == 1 && inner.src_stride == 1 ) ? 0 : 1 );
+			for_each_copy_position<MaxRank>( dims, rank - 1,
+			                                 [&]( std::ptrdiff_t t_dst_offset, std::ptrdiff_t t_src_offset )
+			                                 {
+				                                 DstTy* to         = t_dst + t_dst_offset;
+				                                 const SrcTy* from = t_src + t_src_offset;
+				                                 if constexpr( std::is_same_v<std::remove_const_t<SrcTy>, DstTy> && std::is_trivially_copyable_v<DstTy> )
+				                                 {
+					                                 if( inner.dst_stride == 1 && inner.src_stride == 1 )
+					                                 {
+						                                 std::memcpy( to, from, inner.extent * sizeof( DstTy ) );
+						                                 return;
+					                                 }
+				                                 }
+				                                 for( std::ptrdiff_t j = 0; j < static_cast<std::ptrdiff_t>( inner.extent ); ++j )
+				                                 {
+					                                 to[j * inner.dst_stride] = static_cast<DstTy>( from[j * inner.src_stride] );
+				                                 }
+			                                 } );
+		}
+
+		/// \brief Transposes a square t_n x t_n matrix in place, swapping tiles across the diagonal
+		/// \param t_data First element
+		/// \param t_n Number of rows and columns
+		/// \param t_row_stride Stride between rows
+		/// \param t_col_stride Stride between columns
+		template<typename Ty>
+		void transpose_square_inplace( Ty* t_data, size_t t_n, std::ptrdiff_t t_row_stride, std::ptrdiff_t t_col_stride )
+		{
+			using std::swap;
+			for( size_t ib = 0; ib < t_n; ib += transpose_tile )
+			{
+				const size_t i_end = std::min( ib + transpose_tile, t_n );
+				for( size_t jb = ib; jb < t_n; jb += transpose_tile )
+				{
+					const size_t j_end = std::min( jb + transpose_tile, t_n );
+					for( size_t i = ib; i < i_end; ++i )
+					{
+						for( size_t j = std::max( jb, i + 1 ); j < j_end; ++j )
+						{
+							const auto row = static_cast<std::ptrdiff_t>( i );
+							const auto col = static_cast<std::ptrdiff_t>( j );
+							swap( t_data[row * t_row_stride + col * t_col_stride], t_data[col * t_row_stride + row * t_col_stride] );
+						}
+					}
+				}
+			}
+		}
+
+	} // namespace detail
+
+	/// \brief Marker value for an extent that is only known at runtime
+	inline constexpr size_t dynamic_extent = std::numeric_limits<size_t>::max( );
+
+	namespace detail
+	{
+		/// \brief Storage for the runtime extents of cppa::extents
+		/// \tparam Count Number of dynamic extents
+		template<size_t Count>
+		struct dynamic_extents_storage
+		{
+			std::array<size_t, Count> m_dynamic { };
+
+			[[nodiscard]] constexpr size_t dynamic( size_t t_index ) const noexcept { return m_dynamic[t_index]; }
+			constexpr void set_dynamic( size_t t_index, size_t t_value ) noexcept { m_dynamic[t_index] = t_value; }
+		};
+
+		/// \brief Empty specialization so fully static extents occupy no space
+		template<>
+		struct dynamic_extents_storage<0>
+		{
+			[[nodiscard]] constexpr size_t dynamic( size_t /*t_index*/ ) const noexcept { return 0; }
+			constexpr void set_dynamic( size_t /*t_index*/, size_t /*t_value*/ ) noexcept {}
+		};
+	} // namespace detail
+
+	/// \class extents
+	/// \brief Multi-dimensional extents where each dimension is either static or dynamic
+	/// \tparam Extents Compile-time size of each dimension, or cppa::dynamic_extent
+	///
+	/// Mirrors C++23's std::extents: only the dynamic extents are stored, so
+	/// `extents<3, 3>` is an empty type and every extent folds to a constant.
+	///
+	/// \code
+	/// extents<3, 3> tile;                          // fully static
+	/// extents<dynamic_extent, 4> rows( 10 );       // 10x4
+	/// dextents<2> image( 480, 640 );               // fully dynamic
+	/// \endcode
+	template<size_t... Extents>
+	class extents : private detail::dynamic_extents_storage<( size_t { 0 } + ... + ( Extents == dynamic_extent ? 1 : 0 ) )>
+	{
+	public:
+		using size_type = size_t; ///< Type for sizes and indices
+
+		/// \brief Constructs extents from either the dynamic extents only or from all extents
+		/// \tparam Sizes Variadic extent types (typically size_t)
+		/// \param t_sizes rank_dynamic() dynamic extents in order, or rank() extents
+		/// \throws std::invalid_argument if a given static extent does not match
+		template<typename... Sizes, std::enable_if_t<( std::is_convertible_v<Sizes, size_type> && ... ), int> = 0>
+		constexpr explicit extents( Sizes... t_sizes )
+		{
+			static_assert( sizeof...( Sizes ) == rank_dynamic( ) || sizeof...( Sizes ) == rank( ), "Provide either all dynamic extents or all extents" );
+
+			const std::array<size_type, sizeof...( Sizes )> values = { static_cast<size_type>( t_sizes )... };
+			size_type dyn                                           = 0;
+			for( size_t i = 0; i < values.size( ); ++i )
+			{
+				if constexpr( sizeof...( Sizes ) != rank_dynamic( ) )
+				{
+					if( s_static[i] != dynamic_extent )
+					{
+						if( values[i] != s_static[i] )
+						{
+							throw std::invalid_argument( "Extent does not match static extent" );
+						}
+						continue;
+					}
+				}
+				this->set_dynamic( dyn++, values[i] );
+			}
+		}
+
+		/// \brief Gets the number of dimensions
+		[[nodiscard]] static constexpr size_type rank( ) noexcept { return sizeof...( Extents ); }
+
+		/// \brief Gets the number of dimensions whose extent is only known at runtime
+		[[nodiscard]] static constexpr size_type rank_dynamic( ) noexcept { return ( size_type { 0 } + ... + ( Extents == dynamic_extent ? 1 : 0 ) ); }
+
+		/// \brief Gets the compile-time extent of a dimension
+		/// \param t_dim Dimension index (0-based)
+		/// \return Static extent, or dynamic_extent for runtime dimensions
+		[[nodiscard]] static constexpr size_type static_extent( size_type t_dim ) noexcept { return s_static[t_dim]; }
+
+		/// \brief Gets the extent of a dimension
+		/// \param t_dim Dimension index (0-based, must be < rank())
+		/// \return Size of the specified dimension
+		[[nodiscard]] constexpr size_type extent( size_type t_dim ) const noexcept
+		{
+			return s_static[t_dim] == dynamic_extent ? this->dynamic( dynamic_index( t_dim ) ) : s_static[t_dim];
+		}
+
+	private:
+		static constexpr std::array<size_type, sizeof...( Extents )> s_static = { Extents... };
+
+		/// \brief Maps a dimension to its slot in the dynamic storage
+		[[nodiscard]] static constexpr size_type dynamic_index( size_type t_dim ) noexcept
+		{
+			size_type index = 0;
+			for( size_t i = 0; i < t_dim; ++i )
+			{
+				if( s_static[i] == dynamic_extent )
+				{
+					++index;
+				}
+			}
+			return index;
+		}
+	};
+
+	namespace detail
+	{
+		template<size_t Rank, size_t... Extents>
+		struct make_dextents
+		{
+			using type = typename make_dextents<Rank - 1, dynamic_extent, Extents...>::type;
+		};
+
+		template<size_t... Extents>
+		struct make_dextents<0, Extents...>
+		{
+			using type = extents<Extents...>;
+		};
+	} // namespace detail
+
+	/// \brief Extents of the given rank where every dimension is dynamic
+	/// \tparam Rank Number of dimensions
+	template<size_t Rank>
+	using dextents = typename detail::make_dextents<Rank>::type;
+
+	/// \brief Tag type selecting default-initialization (no zero-fill) of nd_array elements
+	struct uninitialized_t
+	{
+		explicit uninitialized_t( ) = default;
+	};
+
+	/// \brief Tag requesting nd_array elements to be left uninitialized, for buffers that are overwritten right away
+	inline constexpr uninitialized_t uninitialized { };
+
+	/// \brief Requests that nd_array elements are zero-initialized by several threads
+	///
+	/// Each thread first-touches a contiguous block of the outermost dimension, so on
+	/// first-touch NUMA systems the pages land on the node of the thread that initialized them.
+	/// Consumers partitioning the outermost dimension the same way then read node-local memory.
+	struct first_touch_t
+	{
+		size_t thread_count = 0; ///< Number of threads (0 = std::thread::hardware_concurrency())
+	};
+
+	/// \brief Execution policy running bulk algorithms on the calling thread
+	struct sequential_policy
+	{
+	};
+
+	/// \brief Execution policy splitting bulk algorithms into blocks of the outermost dimension, one per thread
+	///
+	/// Strided views split the same way, so each thread walks whole rows of its block.
+	struct parallel_policy
+	{
+		size_t thread_count = 0; ///< Number of threads (0 = std::thread::hardware_concurrency())
+	};
+
+	/// \brief Sequential execution of bulk algorithms
+	inline constexpr sequential_policy seq { };
+
+	/// \brief Parallel execution of bulk algorithms on all hardware threads; use parallel_policy{ n } for n threads
+	inline constexpr parallel_policy par { };
+
+	/// \brief True if Ty is one of the execution policies accepted by the bulk algorithms
+	template<typename Ty>
+	inline constexpr bool is_execution_policy_v = std::is_same_v<std::decay_t<Ty>, sequential_policy> || std::is_same_v<std::decay_t<Ty>, parallel_policy>;
+
+	namespace detail
+	{
+		/// \brief Runs t_func( first_row, last_row ) over the outermost dimension according to t_policy
+		/// \note Each block runs through simd_dispatch(), compiled for the active instruction set
+		template<typename Policy, typename Func>
+		void run_rows( const Policy& t_policy, size_t t_rows, Func&& t_func )
+		{
+			const auto block = [&t_func]( size_t t_first, size_t t_last ) { simd_dispatch( [&] { t_func( t_first, t_last ); } ); };
+			if constexpr( std::is_same_v<Policy, parallel_policy> )
+			{
+				parallel_for_rows( t_rows, t_policy.thread_count, block );
+			}
+			else if( t_rows > 0 )
+			{
+				block( size_t { 0 }, t_rows );
+			}
+		}
+	} // namespace detail
+
+	/// \brief Row-major (C order) layout policy: the last index varies fastest
+	///
+	/// Default layout of nd_span and the layout of nd_array. Spans built from extents get row-major
+	/// strides; iteration, is_contiguous(), reshape() and flatten() follow row-major order.
+	struct layout_right
+	{
+		/// \brief Iteration visits the last index fastest
+		static constexpr bool first_index_fastest = false;
+
+		/// \brief Computes the default row-major strides for t_extents
+		template<size_t MaxRank>
+		static constexpr void compute_strides( std::array<std::ptrdiff_t, MaxRank>& t_strides, const std::array<size_t, MaxRank>& t_extents, size_t t_rank ) noexcept
+		{
+			detail::stride_computer<MaxRank>::compute( t_strides, t_extents, t_rank );
+		}
+
+		/// \brief Checks whether extents and strides describe a dense row-major block
+		template<size_t MaxRank>
+		[[nodiscard]] static constexpr bool is_contiguous( const std::array<size_t, MaxRank>& t_extents, const std::array<std::ptrdiff_t, MaxRank>& t_strides,
+		                                                   size_t t_rank ) noexcept
+		{
+			return detail::is_contiguous<MaxRank>( t_extents, t_strides, t_rank );
+		}
+	};
+
+	/// \brief Column-major (Fortran / BLAS / LAPACK order) layout policy: the first index varies fastest
+	///
+	/// Spans built from extents get column-major strides; iteration, is_contiguous(), reshape() and
+	/// flatten() follow column-major order, so column-major buffers are traversed and reshaped in
+	/// memory order without a transposed copy.
+	struct layout_left
+	{
+		/// \brief Iteration visits the first index fastest
+		static constexpr bool first_index_fastest = true;
+
+		/// \brief Computes the default column-major strides for t_extents
+		template<size_t MaxRank>
+		static constexpr void compute_strides( std::array<std::ptrdiff_t, MaxRank>& t_strides, const std::array<size_t, MaxRank>& t_extents, size_t t_rank ) noexcept
+		{
+			std::ptrdiff_t stride = 1;
+			for( size_t i = 0; i < t_rank; ++i )
+			{
+				t_strides[i] = stride;
+				stride *= static_cast<std::ptrdiff_t>( t_extents[i] );
+			}
+			for( size_t i = t_rank; i < MaxRank; ++i )
+			{
+				t_strides[i] = 0;
+			}
+		}
+
+		/// \brief Checks whether extents and strides describe a dense column-major block
+		template<size_t MaxRank>
+		[[nodiscard]] static constexpr bool is_contiguous( const std::array<size_t, MaxRank>& t_extents, const std::array<std::ptrdiff_t, MaxRank>& t_strides,
+		                                                   size_t t_rank ) noexcept
+		{
+			return detail::is_column_major_contiguous<MaxRank>( t_extents, t_strides, t_rank );
+		}
+	};
+
+	/// \brief Arbitrary-stride layout policy without a preferred memory order
+	///
+	/// Iteration, reshape() and flatten() use row-major index order like layout_right, and spans built from
+	/// extents alone get row-major strides. is_contiguous() is true whenever the view covers a dense block
+	/// in any dimension order, e.g. a transposed or permuted view of a contiguous buffer.
+	struct layout_stride
+	{
+		/// \brief Iteration visits the last index fastest
+		static constexpr bool first_index_fastest = false;
+
+		/// \brief Computes row-major strides for t_extents
+		template<size_t MaxRank>
+		static constexpr void compute_strides( std::array<std::ptrdiff_t, MaxRank>& t_strides, const std::array<size_t, MaxRank>& t_extents, size_t t_rank ) noexcept
+		{
+			detail::stride_computer<MaxRank>::compute( t_strides, t_extents, t_rank );
+		}
+
+		/// \brief Checks whether extents and strides cover a dense block in some dimension order
+		template<size_t MaxRank>
+		[[nodiscard]] static constexpr bool is_contiguous( const std::array<size_t, MaxRank>& t_extents, const std::array<std::ptrdiff_t, MaxRank>& t_strides,
+		                                                   size_t t_rank ) noexcept
+		{
+			return detail::is_exhaustive<MaxRank>( t_extents, t_strides, t_rank );
+		}
+	};
+
+	template<typename Ty, size_t MaxRank = 8, typename Layout = layout_right>
+	class nd_span;
+
+	namespace detail
+	{
+		/// \brief Base of the lazy element-wise expression nodes declared in nd_expr.hpp
+		struct expression_tag
+		{
+		};
+
+		/// \brief True if Ty is a lazy element-wise expression
+		template<typename Ty>
+		inline constexpr bool is_expression_v = std::is_base_of_v<expression_tag, Ty>;
+
+		/// \brief Evaluates an expression into t_dst in a single fused pass (defined in nd_expr.hpp)
+		template<typename Ty, size_t MaxRank, typename Expr>
+		void assign_expression( nd_span<Ty, MaxRank> t_dst, const Expr& t_expr );
+	} // namespace detail
+
+	/// \class aligned_allocator
+	/// \brief Allocator returning storage aligned to a fixed byte boundary
+	/// \tparam Ty Element type
+	/// \tparam Alignment Alignment in bytes (power of two, e.g. 32 for AVX2 or 64 for AVX-512 / cache lines)
+	template<typename Ty, size_t Alignment = 64>
+	class aligned_allocator
+	{
+		static_assert( Alignment != 0 && ( Alignment & ( Alignment - 1 ) ) == 0, "Alignment must be a power of two" );
+		static_assert( Alignment >= alignof( Ty ), "Alignment must not be weaker than the element alignment" );
+
+	public:
+		using value_type      = Ty;
+		using size_type       = size_t;
+		using difference_type = std::ptrdiff_t;
+		using is_always_equal = std::true_type;
+
+		/// \brief Rebinds the allocator to another element type with the same alignment
+		template<typename Other>
+		struct rebind
+		{
+			using other = aligned_allocator<Other, Alignment>;
+		};
+
+		/// \brief Gets the alignment in bytes
+		[[nodiscard]] static constexpr size_type alignment( ) noexcept { return Alignment; }
+
+		aligned_allocator( ) noexcept = default;
+
+		template<typename Other>
+		aligned_allocator( const aligned_allocator<Other, Alignment>& /*t_other*/ ) noexcept // NOLINT(google-explicit-constructor)
+		{
+		}
+
+		/// \brief Allocates uninitialized storage for t_count elements
+		/// \throws std::bad_array_new_length if the size overflows, std::bad_alloc on failure
+		[[nodiscard]] Ty* allocate( size_type t_count )
+		{
+			if( t_count > std::numeric_limits<size_type>::max( ) / sizeof( Ty ) )
+			{
+				throw std::bad_array_new_length( );
+			}
+			return static_cast<Ty*>( ::operator new( t_count * sizeof( Ty ), std::align_val_t { Alignment } ) );
+		}
+
+		/// \brief Releases storage obtained from allocate()
+		void deallocate( Ty* t_ptr, size_type /*t_count*/ ) noexcept { ::operator delete( t_ptr, std::align_val_t { Alignment } ); }
+
+		template<typename Other>
+		[[nodiscard]] bool operator==( const aligned_allocator<Other, Alignment>& /*t_other*/ ) const noexcept
+		{
+			return true;
+		}
+
+		template<typename Other>
+		[[nodiscard]] bool operator!=( const aligned_allocator<Other, Alignment>& /*t_other*/ ) const noexcept
+		{
+			return false;
+		}
+	};
+
+	/// \brief Rounds an extent up so that a row of that many elements is a multiple of t_alignment bytes
+	/// \tparam Ty Element type
+	/// \param t_extent Logical number of elements per row
+	/// \param t_alignment Row alignment in bytes (default: 64, one cache line / AVX-512 register)
+	/// \return Padded row length in elements (>= t_extent)
+	/// \example
+	/// \code
+	/// // Rows of 1000 floats padded to 1008 so that each row starts on a 64-byte boundary
+	/// aligned_nd_array<float> storage(rows, padded_extent<float>(1000));
+	/// auto image = storage.subspan(1, {0, 1000}); // has_contiguous_rows(), but not is_contiguous()
+	/// \endcode
+	template<typename Ty>
+	[[nodiscard]] constexpr size_t padded_extent( size_t t_extent, size_t t_alignment = 64 ) noexcept
+	{
+		const size_t step = t_alignment / std::gcd( t_alignment, sizeof( Ty ) );
+		return ( t_extent + step - 1 ) / step * step;
+	}
+
+	/// \class nd_span
+	/// \brief Non-owning view over multi-dimensional data with dynamic rank
+	/// \tparam T Element type
+	/// \tparam MaxRank Maximum number of dimensions (default: 8)
+	/// \tparam Layout Layout policy: layout_right (default), layout_left or layout_stride
+	///
+	/// nd_span provides a lightweight, non-owning reference to multi-dimensional data.
+	/// It's similar to std::span but for multiple dimensions, like C++23's std::mdspan.
+	/// The actual rank is determined at runtime but cannot exceed MaxRank.
+	///
+	/// <b>Memory Layout</b>
+	///
+	/// Every view stores explicit strides, so subspans and transposes of any layout remain valid views.
+	/// The Layout policy selects the default strides for spans built from extents and the order used by
+	/// iteration, is_contiguous(), reshape() and flatten(): row-major (last dimension fastest) for
+	/// layout_right and layout_stride, column-major (first dimension fastest) for layout_left.
+	///
+	/// <b>Typical Usage</b>
+	///
+	/// \code
+	/// double data[12];
+	/// nd_span<double> span(data, 3, 4);  // 3x4 matrix
+	/// span(1, 2) = 5.0;  // Access element at row 1, column 2
+	///
+	/// nd_span<double, 8, layout_left> fortran(lapack_buffer, 3, 4);  // Column-major 3x4 matrix
+	/// \endcode
+	template<typename Ty, size_t MaxRank, typename Layout>
+	class nd_span
+	{
+	public:
+		using value_type      = Ty;        ///< Type of elements
+		using size_type       = size_t;    ///< Type for sizes and indices
+		using reference       = Ty&;       ///< Reference to element
+		using const_reference = const Ty&; ///< Const reference to element
+		using pointer         = Ty*;       ///< Pointer to element
+		using const_pointer   = const Ty*; ///< Const pointer to element
+		using layout_type     = Layout;         ///< Layout policy
+		using stride_type     = std::ptrdiff_t; ///< Signed stride in elements, negative along reversed dimensions
+
+		/// \brief Constructs a span from raw data with explicit extents and strides
+		/// \param t_data Pointer to the element at index (0, ..., 0)
+		/// \param t_extents Sizes of each dimension
+		/// \param t_strides Stride values for each dimension (negative strides walk backwards from t_data)
+		/// \param t_rank Number of dimensions (must be <= MaxRank)
+		/// \note This is the primary constructor used by subspan/slice operations
+		constexpr nd_span( pointer t_data, const std::array<size_type, MaxRank>& t_extents, const std::array<stride_type, MaxRank>& t_strides, size_type t_rank ) noexcept
+		    : m_data( t_data )
+		    , m_extents( t_extents )
+		    , m_strides( t_strides )
+		    , m_rank( t_rank )
+		{
+		}
+
+		/// \brief Converts a view with another layout policy, keeping its extents and strides
+		/// \param t_other View to convert; may also add const to the element type
+		/// \note Only the policy changes: elements are addressed as before, but iteration order, is_contiguous()
+		///       and reshape() follow Layout from now on.
+		/// \example
+		/// \code
+		/// nd_span<double, 8, layout_left> a(buffer, 3, 4);
+		/// nd_span<const double> strided(a);  // Same elements, row-major iteration order
+		/// \endcode
+		template<typename OtherTy, typename OtherLayout,
+		         std::enable_if_t<!std::is_same_v<OtherLayout, Layout> && std::is_convertible_v<OtherTy ( * )[], Ty ( * )[]>, int> = 0>
+		explicit nd_span( const nd_span<OtherTy, MaxRank, OtherLayout>& t_other ) noexcept
+		    : m_data( t_other.m_data )
+		    , m_extents( t_other.m_extents )
+		    , m_strides( t_other.m_strides )
+		    , m_rank( t_other.m_rank )
+		{
+		}
+
+		/// \brief Constructs a span from raw data with dimension sizes
+		/// \param t_data Pointer to the first element
+		/// \param t_extents Initializer list of dimension sizes {dim0, dim1, ...}
+		/// \throws std::invalid_argument if number of dimensions exceeds MaxRank
+		/// \example
+		/// \code
+		/// double data[12];
+		/// nd_span<double> span(data, {3, 4});  // 3x4 matrix
+		/// \endcode
+		nd_span( pointer t_data, std::initializer_list<size_type> t_extents ) : m_data( t_data ), m_rank( t_extents.size( ) )
+		{
+			if( m_rank > MaxRank )
+			{
+				throw std::invalid_argument( "Rank exceeds MaxRank" );
+			}
+
+			size_t idx = 0;
+			for( auto extent: t_extents )
+			{
+				m_extents[idx++] = extent;
+			}
+			for( size_t i = m_rank; i < MaxRank; ++i )
+			{
+				m_extents[i] = 0;
+			}
+
+			compute_strides( );
+		}
+
+		/// \brief Constructs a span from raw data with a container of dimension sizes
+		/// \tparam Container Type of container holding extents (e.g., std::vector<size_t>)
+		/// \param t_data Pointer to the first element
+		/// \param t_extents Container with dimension sizes
+		/// \throws std::invalid_argument if number of dimensions exceeds MaxRank
+		/// \example
+		/// \code
+		/// double data[24];
+		/// std::vector<size_t> dims = {2, 3, 4};
+		/// nd_span<double> span(data, dims);  // 2x3x4 array
+		/// \endcode
+		template<typename Container>
+		nd_span( pointer t_data, const Container& t_extents, std::enable_if_t<!std::is_integral_v<Container> && !std::is_same_v<Container, nd_span>>* = nullptr )
+		    : m_data( t_data )
+		    , m_rank( t_extents.size( ) )
+		{
+			if( m_rank > MaxRank )
+			{
+				throw std::invalid_argument( "Rank exceeds MaxRank" );
+			}
+
+			size_t idx = 0;
+			for( auto extent: t_extents )
+			{
+				m_extents[idx++] = static_cast<size_type>( extent );
+			}
+			for( size_t i = m_rank; i < MaxRank; ++i )
+			{
+				m_extents[i] = 0;
+			}
+
+			compute_strides( );
+		}
+
+		/// \brief Constructs a span from raw data with variadic dimension sizes
+		/// \tparam Indices Variadic index types (typically size_t or convertible to size_t)
 		/// \param t_data Pointer to the first element
 		/// \param t_indices Dimension sizes as separate arguments
 		/// \example
@@ -519,6 +2072,34 @@ namespace cppa
 			return m_data[detail::offset_computer<MaxRank>::compute( m_extents, m_strides, t_indices... )];
 		}
 
+		/// \brief Accesses an element without bounds checking (non-const)
+		/// \tparam Indices Variadic index types (typically size_t)
+		/// \param t_indices Multi-dimensional indices (i, j, k, ...)
+		/// \return Reference to the element at the specified location
+		/// \note Indices are only validated through ND_ARRAY_ASSERT, i.e. in debug builds
+		/// \example
+		/// \code
+		/// for( size_t j = 0; j < span.extent( 1 ); ++j )
+		///     out.unchecked( i, j ) = a.unchecked( i, j ) * b.unchecked( i, j );
+		/// \endcode
+		template<typename... Indices>
+		[[nodiscard]] reference unchecked( Indices... t_indices ) noexcept
+		{
+			static_assert( sizeof...( t_indices ) <= MaxRank, "Too many indices" );
+			return m_data[detail::offset_computer<MaxRank>::compute_unchecked( m_extents, m_strides, t_indices... )];
+		}
+
+		/// \brief Accesses an element without bounds checking (const)
+		/// \tparam Indices Variadic index types (typically size_t)
+		/// \param t_indices Multi-dimensional indices (i, j, k, ...)
+		/// \return Const reference to the element at the specified location
+		template<typename... Indices>
+		[[nodiscard]] const_reference unchecked( Indices... t_indices ) const noexcept
+		{
+			static_assert( sizeof...( t_indices ) <= MaxRank, "Too many indices" );
+			return m_data[detail::offset_computer<MaxRank>::compute_unchecked( m_extents, m_strides, t_indices... )];
+		}
+
 		/// \brief Creates a subspan by restricting a range along one dimension
 		/// \param t_dim Dimension to restrict (0-based)
 		/// \param t_range Pair of {start (inclusive), end (exclusive)} indices for that dimension
@@ -545,11 +2126,61 @@ namespace cppa
 			std::array<size_type, MaxRank> new_extents = m_extents;
 			new_extents[t_dim]                         = end - start;
 
-			size_type offset = start * m_strides[t_dim];
+			const stride_type offset = static_cast<stride_type>( start ) * m_strides[t_dim];
 
 			return nd_span( m_data + offset, new_extents, m_strides, m_rank );
 		}
 
+		/// \brief Creates a subspan of every t_step-th element of a range along one dimension
+		/// \param t_dim Dimension to restrict (0-based)
+		/// \param t_range Pair of {start (inclusive), end (exclusive)} indices for that dimension
+		/// \param t_step Distance between selected indices; a negative step walks the range backwards from end - 1
+		/// \return New nd_span view of the selected elements, no data is copied
+		/// \throws std::out_of_range if dimension or range is invalid
+		/// \throws std::invalid_argument if t_step is 0
+		/// \example
+		/// \code
+		/// nd_span<float> signal(samples, 1024);
+		/// auto decimated = signal.subspan(0, {0, 1024}, 2);   // 512 even samples
+		/// auto reversed  = signal.subspan(0, {0, 1024}, -1);  // reversed(0) == signal(1023)
+		/// \endcode
+		[[nodiscard]] nd_span subspan( size_type t_dim, std::pair<size_type, size_type> t_range, stride_type t_step ) const
+		{
+			if( t_step == 0 )
+			{
+				throw std::invalid_argument( "Step must not be zero" );
+			}
+			nd_span result             = subspan( t_dim, t_range );
+			const size_type distance   = static_cast<size_type>( t_step < 0 ? -t_step : t_step );
+			const size_type count      = ( result.m_extents[t_dim] + distance - 1 ) / distance;
+			const size_type first      = t_step < 0 ? result.m_extents[t_dim] - 1 : 0;
+			result.m_data             += static_cast<stride_type>( first ) * m_strides[t_dim];
+			result.m_extents[t_dim]    = count;
+			result.m_strides[t_dim]    = m_strides[t_dim] * t_step;
+			return result;
+		}
+
+		/// \brief Creates a view with the order of one dimension reversed
+		/// \param t_dim Dimension to reverse (0-based)
+		/// \return New nd_span view where index i of t_dim addresses extent - 1 - i, no data is copied
+		/// \throws std::out_of_range if dimension is invalid
+		/// \example
+		/// \code
+		/// auto mirrored = image.flip(1);  // mirrored(y, 0) == image(y, width - 1)
+		/// \endcode
+		[[nodiscard]] nd_span flip( size_type t_dim ) const
+		{
+			if( t_dim >= m_rank )
+			{
+				throw std::out_of_range( "Dimension out of range" );
+			}
+			if( m_extents[t_dim] == 0 )
+			{
+				return *this;
+			}
+			return subspan( t_dim, { 0, m_extents[t_dim] }, -1 );
+		}
+
 		/// \brief Creates a lower-dimensional view by fixing one dimension's index
 		/// \param t_dim Dimension to slice (0-based)
 		/// \param t_index Index value to fix for that dimension
@@ -572,10 +2203,10 @@ namespace cppa
 			}
 
 			std::array<size_type, MaxRank> new_extents;
-			std::array<size_type, MaxRank> new_strides;
+			std::array<stride_type, MaxRank> new_strides;
 
-			size_type new_rank = m_rank - 1;
-			size_type offset   = t_index * m_strides[t_dim];
+			size_type new_rank       = m_rank - 1;
+			const stride_type offset = static_cast<stride_type>( t_index ) * m_strides[t_dim];
 
 			size_type j = 0;
 			for( size_t i = 0; i < m_rank; ++i )
@@ -597,14 +2228,14 @@ namespace cppa
 			return nd_span( m_data + offset, new_extents, new_strides, new_rank );
 		}
 
-		/// \brief Reshapes the span (view-only, row-major contiguous required)
+		/// \brief Reshapes the span (view-only, contiguous in layout order required)
 		/// \param t_new_extents New shape extents
 		/// \return Reshaped view
 		/// \throws std::invalid_argument if rank exceeds MaxRank or size mismatch
 		/// \throws std::runtime_error if the view is not contiguous
 		[[nodiscard]] nd_span reshape( std::initializer_list<size_type> t_new_extents ) const { return reshape_impl( t_new_extents.begin( ), t_new_extents.size( ) ); }
 
-		/// \brief Reshapes the span with variadic extents (view-only, row-major contiguous required)
+		/// \brief Reshapes the span with variadic extents (view-only, contiguous in layout order required)
 		/// \tparam Indices Variadic extent types
 		/// \param t_new_extents New shape extents
 		/// \return Reshaped view
@@ -630,7 +2261,7 @@ namespace cppa
 			return transpose_impl( axes.data( ), axes_rank );
 		}
 
-		/// \brief Flattens the span into a 1D view (row-major contiguous required)
+		/// \brief Flattens the span into a 1D view in layout order (contiguous in layout order required)
 		/// \return 1D view of the data
 		[[nodiscard]] nd_span flatten( ) const { return reshape( size( ) ); }
 
@@ -639,7 +2270,7 @@ namespace cppa
 		[[nodiscard]] nd_span squeeze( ) const
 		{
 			std::array<size_type, MaxRank> new_extents;
-			std::array<size_type, MaxRank> new_strides;
+			std::array<stride_type, MaxRank> new_strides;
 			size_type new_rank = 0;
 
 			for( size_t i = 0; i < m_rank; ++i )
@@ -661,6 +2292,134 @@ namespace cppa
 			return nd_span( m_data, new_extents, new_strides, new_rank );
 		}
 
+		/// \brief Inserts a dimension of extent 1
+		/// \param t_dim Position of the new dimension (0 .. rank())
+		/// \return View with rank increased by 1; the new dimension has stride 0
+		/// \throws std::out_of_range if t_dim is greater than rank()
+		/// \throws std::invalid_argument if the rank would exceed MaxRank
+		/// \example
+		/// \code
+		/// nd_span<float> bias(values, 64);
+		/// auto row = bias.expand_dims(0);  // 1 x 64
+		/// \endcode
+		[[nodiscard]] nd_span expand_dims( size_type t_dim ) const
+		{
+			if( t_dim > m_rank )
+			{
+				throw std::out_of_range( "Dimension out of range" );
+			}
+			if( m_rank == MaxRank )
+			{
+				throw std::invalid_argument( "Rank exceeds MaxRank" );
+			}
+
+			nd_span result = *this;
+			for( size_type i = m_rank; i > t_dim; --i )
+			{
+				result.m_extents[i] = m_extents[i - 1];
+				result.m_strides[i] = m_strides[i - 1];
+			}
+			result.m_extents[t_dim] = 1;
+			result.m_strides[t_dim] = 0;
+			++result.m_rank;
+			return result;
+		}
+
+		/// \brief Creates a read-only view repeating the elements along new or singleton dimensions
+		/// \param t_extents Target extents, of a rank equal to or greater than rank()
+		/// \return View with the target extents; broadcast dimensions have stride 0 and allocate nothing
+		/// \throws std::invalid_argument if the target rank exceeds MaxRank or the shapes are incompatible
+		///
+		/// Dimensions are aligned at the end, as in NumPy: each dimension must equal the target or be 1,
+		/// and new leading dimensions are added. The view is const because its elements are shared.
+		/// \example
+		/// \code
+		/// nd_span<float> bias(values, 64);
+		/// auto rows = bias.broadcast_to(128, 64);  // rows(i, j) == bias(j)
+		/// \endcode
+		[[nodiscard]] nd_span<const Ty, MaxRank, Layout> broadcast_to( std::initializer_list<size_type> t_extents ) const
+		{
+			return broadcast_impl( t_extents.begin( ), t_extents.size( ) );
+		}
+
+		/// \brief Creates a read-only view repeating the elements along new or singleton dimensions
+		/// \tparam Indices Variadic extent types
+		/// \param t_extents Target extents, of a rank equal to or greater than rank()
+		/// \return View with the target extents; broadcast dimensions have stride 0 and allocate nothing
+		/// \throws std::invalid_argument if the target rank exceeds MaxRank or the shapes are incompatible
+		template<typename... Indices>
+		[[nodiscard]] nd_span<const Ty, MaxRank, Layout> broadcast_to( Indices... t_extents ) const
+		{
+			std::array<size_type, sizeof...( t_extents )> temp = { static_cast<size_type>( t_extents )... };
+			return broadcast_impl( temp.data( ), sizeof...( t_extents ) );
+		}
+
+		/// \brief Creates a read-only view of every window of the given extents, the windows as extra dimensions
+		/// \param t_window Window extent for each dimension, each between 1 and the extent of that dimension
+		/// \return View of rank 2 * rank(): extents [n0 - w0 + 1, ..., w0, ...], where element
+		///         (i..., k...) is the element (i + k)... of this view
+		/// \throws std::invalid_argument if the window rank differs from rank(), a window does not fit, or
+		///         twice the rank exceeds MaxRank
+		///
+		/// Like NumPy's sliding_window_view the windows overlap and share elements, so the view is const.
+		/// Window positions reuse the strides of this view and nothing is copied or checked per window.
+		/// \example
+		/// \code
+		/// nd_array<float> image(480, 640);
+		/// auto patches = image.sliding_window({3, 3});  // 478 x 638 x 3 x 3
+		/// patches(10, 20, 1, 1);                        // image(11, 21)
+		/// \endcode
+		[[nodiscard]] nd_span<const Ty, MaxRank, Layout> sliding_window( std::initializer_list<size_type> t_window ) const
+		{
+			return sliding_window_impl( t_window.begin( ), t_window.size( ), nullptr, 0 );
+		}
+
+		/// \brief Creates a read-only view of the windows that start every t_step elements
+		/// \param t_window Window extent for each dimension, each between 1 and the extent of that dimension
+		/// \param t_step Non-zero distance between window starts for each dimension
+		/// \return View of rank 2 * rank(): extents [(n0 - w0) / s0 + 1, ..., w0, ...]
+		/// \throws std::invalid_argument if a list has the wrong rank, a window does not fit, a step is zero,
+		///         or twice the rank exceeds MaxRank
+		/// \example
+		/// \code
+		/// auto tiles = image.sliding_window({8, 8}, {8, 8});  // 60 x 80 non-overlapping 8 x 8 tiles
+		/// \endcode
+		[[nodiscard]] nd_span<const Ty, MaxRank, Layout> sliding_window( std::initializer_list<size_type> t_window, std::initializer_list<size_type> t_step ) const
+		{
+			return sliding_window_impl( t_window.begin( ), t_window.size( ), t_step.begin( ), t_step.size( ) );
+		}
+
+		/// \brief Creates a view of the same elements with the lowest possible rank
+		/// \return View with singleton dimensions dropped and nested neighbours merged
+		///
+		/// Adjacent dimensions are merged when the outer stride equals the inner stride times the inner
+		/// extent (in layout order), so the iteration order and the viewed elements are unchanged. A
+		/// contiguous view becomes rank 1 and a non-empty view keeps at least one dimension.
+		/// \example
+		/// \code
+		/// nd_span<float> tile(data, 1, 1, 1, 1024);
+		/// auto flat = tile.coalesce();             // rank 1, extent 1024
+		/// auto rows = image.subspan(1, {0, 64});   // 480 x 64 with a row stride of 640
+		/// rows.coalesce().rank();                  // 2, rows cannot be merged
+		/// \endcode
+		[[nodiscard]] nd_span coalesce( ) const
+		{
+			nd_span result( *this );
+			if constexpr( Layout::first_index_fastest )
+			{
+				std::reverse( result.m_extents.begin( ), result.m_extents.begin( ) + m_rank );
+				std::reverse( result.m_strides.begin( ), result.m_strides.begin( ) + m_rank );
+				result.m_rank = detail::coalesce_dims<MaxRank>( result.m_extents, m_rank, result.m_strides );
+				std::reverse( result.m_extents.begin( ), result.m_extents.begin( ) + result.m_rank );
+				std::reverse( result.m_strides.begin( ), result.m_strides.begin( ) + result.m_rank );
+			}
+			else
+			{
+				result.m_rank = detail::coalesce_dims<MaxRank>( result.m_extents, m_rank, result.m_strides );
+			}
+			return result;
+		}
+
 		/// \brief Gets the size of a specific dimension
 		/// \param t_dim Dimension index (0-based)
 		/// \return Size of the specified dimension
@@ -676,9 +2435,9 @@ namespace cppa
 
 		/// \brief Gets the stride of a specific dimension
 		/// \param t_dim Dimension index (0-based)
-		/// \return Stride of the specified dimension
+		/// \return Stride of the specified dimension in elements (negative if the dimension is reversed)
 		/// \throws std::out_of_range if dimension is >= rank
-		[[nodiscard]] size_type stride( size_type t_dim ) const
+		[[nodiscard]] stride_type stride( size_type t_dim ) const
 		{
 			if( t_dim >= m_rank )
 			{
@@ -699,9 +2458,283 @@ namespace cppa
 		/// \return Current rank (number of dimensions)
 		[[nodiscard]] size_type rank( ) const noexcept { return m_rank; }
 
-		/// \brief Gets the maximum number of dimensions supported
-		/// \return MaxRank template parameter
-		[[nodiscard]] static constexpr size_type max_rank( ) noexcept { return MaxRank; }
+		/// \brief Gets the maximum number of dimensions supported
+		/// \return MaxRank template parameter
+		[[nodiscard]] static constexpr size_type max_rank( ) noexcept { return MaxRank; }
+
+		/// \brief Checks whether the view covers a dense block of memory in the order of the layout policy
+		/// \return True if the elements are contiguous in row-major order (layout_right), column-major order
+		///         (layout_left) or any dimension order (layout_stride)
+		[[nodiscard]] bool is_contiguous( ) const noexcept { return Layout::template is_contiguous<MaxRank>( m_extents, m_strides, m_rank ); }
+
+		/// \brief Checks whether every row along the last dimension is contiguous
+		/// \return True if the last dimension is unit-stride; rows may be separated by padding
+		[[nodiscard]] bool has_contiguous_rows( ) const noexcept { return detail::has_contiguous_rows<MaxRank>( m_extents, m_strides, m_rank ); }
+
+		/// \brief Number of elements in the longest unit-stride block at the innermost end of the layout order
+		/// \return size() for a contiguous view, 1 if the innermost coalesced dimension is strided, 0 for an empty view
+		[[nodiscard]] size_type inner_block_size( ) const noexcept
+		{
+			if( size( ) == 0 )
+			{
+				return 0;
+			}
+			const nd_span merged = coalesce( );
+			const size_type inner = Layout::first_index_fastest ? 0 : merged.m_rank - 1;
+			return merged.m_strides[inner] == 1 ? merged.m_extents[inner] : 1;
+		}
+
+		/// \brief Evaluates a lazy element-wise expression into the viewed elements
+		/// \tparam Expr Expression type built with the operators from nd_expr.hpp
+		/// \param t_expr Expression with the same extents as this view
+		/// \return Reference to this span
+		/// \throws std::invalid_argument if the extents differ
+		/// \example
+		/// \code
+		/// auto row = out.subspan(0, {1, 2});
+		/// row.assign(a.subspan(0, {0, 1}) * 2.0 + 1.0);
+		/// \endcode
+		template<typename Expr, std::enable_if_t<detail::is_expression_v<Expr>, int> = 0>
+		nd_span& assign( const Expr& t_expr )
+		{
+			detail::assign_expression( nd_span<Ty, MaxRank>( m_data, m_extents, m_strides, m_rank ), t_expr );
+			return *this;
+		}
+
+		/// \brief Fills all viewed elements with a value
+		/// \param t_value Value to assign
+		void fill( const Ty& t_value ) { fill( seq, t_value ); }
+
+		/// \brief Fills all viewed elements with a value using an execution policy
+		/// \param t_policy seq, par or parallel_policy{ thread_count }
+		/// \param t_value Value to assign
+		/// \example
+		/// \code
+		/// image.subspan(1, {8, 1016}).fill(cppa::par, 0.0f);  // Strided view, one block of rows per thread
+		/// \endcode
+		/// \note Elements are written in memory order, so permuted views are filled linearly
+		template<typename Policy, std::enable_if_t<is_execution_policy_v<Policy>, int> = 0>
+		void fill( const Policy& t_policy, const Ty& t_value )
+		{
+			ND_ARRAY_TRACE_SCOPE( "fill" );
+			for_each_memory_block( t_policy, [this, &t_value]( stride_type t_offset ) { m_data[t_offset] = t_value; } );
+		}
+
+		/// \brief Replaces every viewed element x with t_func( x )
+		/// \param t_func Function that takes a Ty and returns a Ty
+		template<typename Func>
+		void apply( Func&& t_func )
+		{
+			apply( seq, std::forward<Func>( t_func ) );
+		}
+
+		/// \brief Replaces every viewed element x with t_func( x ) using an execution policy
+		/// \param t_policy seq, par or parallel_policy{ thread_count }
+		/// \param t_func Function that takes a Ty and returns a Ty; must be safe to call concurrently for par
+		template<typename Policy, typename Func, std::enable_if_t<is_execution_policy_v<Policy>, int> = 0>
+		void apply( const Policy& t_policy, Func&& t_func )
+		{
+			ND_ARRAY_TRACE_SCOPE( "apply" );
+			for_each_row_block( t_policy, [this, &t_func]( stride_type t_offset ) { m_data[t_offset] = t_func( m_data[t_offset] ); } );
+		}
+
+		/// \brief Calls t_func( element ) for every viewed element in the order the elements are laid out in memory
+		/// \param t_func Function taking a reference to an element
+		///
+		/// Dimensions are sorted by stride and nested ones merged, so permuted views such as T() are swept
+		/// linearly instead of jumping by the largest stride. Use it when the visit order does not matter.
+		/// \example
+		/// \code
+		/// std::array<size_t, 256> histogram { };
+		/// image.T( ).for_each_in_memory_order( [&]( std::uint8_t v ) { ++histogram[v]; } );
+		/// \endcode
+		template<typename Func>
+		void for_each_in_memory_order( Func&& t_func )
+		{
+			for_each_in_memory_order( seq, std::forward<Func>( t_func ) );
+		}
+
+		/// \brief Calls t_func( element ) for every viewed element in memory order using an execution policy
+		/// \param t_policy seq, par or parallel_policy{ thread_count }
+		/// \param t_func Function taking a reference to an element; must be safe to call concurrently for par
+		/// \note Threads split the outermost dimension in memory, each sweeping its own block of memory
+		template<typename Policy, typename Func, std::enable_if_t<is_execution_policy_v<Policy>, int> = 0>
+		void for_each_in_memory_order( const Policy& t_policy, Func&& t_func )
+		{
+			for_each_memory_block( t_policy, [this, &t_func]( stride_type t_offset ) { t_func( m_data[t_offset] ); } );
+		}
+
+		/// \brief Calls t_func( element ) for every viewed element in memory order (const)
+		/// \param t_func Function taking a const reference to an element
+		template<typename Func>
+		void for_each_in_memory_order( Func&& t_func ) const
+		{
+			for_each_in_memory_order( seq, std::forward<Func>( t_func ) );
+		}
+
+		/// \brief Calls t_func( element ) for every viewed element in memory order using an execution policy (const)
+		/// \param t_policy seq, par or parallel_policy{ thread_count }
+		/// \param t_func Function taking a const reference to an element; must be safe to call concurrently for par
+		template<typename Policy, typename Func, std::enable_if_t<is_execution_policy_v<Policy>, int> = 0>
+		void for_each_in_memory_order( const Policy& t_policy, Func&& t_func ) const
+		{
+			for_each_memory_block( t_policy, [this, &t_func]( stride_type t_offset ) { t_func( static_cast<const_reference>( m_data[t_offset] ) ); } );
+		}
+
+		/// \brief Writes t_func( x ) for every element x of t_src into the corresponding viewed element
+		/// \param t_src Source view with the same extents
+		/// \param t_func Function taking a source element
+		/// \throws std::invalid_argument if the extents differ
+		template<typename OtherTy, typename OtherLayout, typename Func>
+		void transform( const nd_span<OtherTy, MaxRank, OtherLayout>& t_src, Func&& t_func )
+		{
+			transform( seq, t_src, std::forward<Func>( t_func ) );
+		}
+
+		/// \brief Writes t_func( x ) for every element x of t_src into the corresponding viewed element using an execution policy
+		/// \param t_policy seq, par or parallel_policy{ thread_count }
+		/// \param t_src Source view with the same extents
+		/// \param t_func Function taking a source element
+		/// \throws std::invalid_argument if the extents differ
+		/// \example
+		/// \code
+		/// nd_array<float> normalized(raw.extent(0), raw.extent(1));
+		/// normalized.transform(cppa::par, raw.as_span(), [](std::uint16_t v) { return v / 65535.0f; });
+		/// \endcode
+		template<typename Policy, typename OtherTy, typename OtherLayout, typename Func, std::enable_if_t<is_execution_policy_v<Policy>, int> = 0>
+		void transform( const Policy& t_policy, const nd_span<OtherTy, MaxRank, OtherLayout>& t_src, Func&& t_func )
+		{
+			check_same_extents( t_src );
+			ND_ARRAY_TRACE_SCOPE( "transform" );
+			const OtherTy* src                         = t_src.m_data;
+			std::array<size_type, MaxRank> extents     = m_extents;
+			std::array<stride_type, MaxRank> dst_strides = m_strides;
+			std::array<stride_type, MaxRank> src_strides = t_src.m_strides;
+			const size_type rank                       = detail::coalesce_dims<MaxRank>( extents, m_rank, dst_strides, src_strides );
+			detail::run_rows( t_policy, size( ) == 0 ? 0 : extents[0],
+			                  [&]( size_type t_first, size_type t_last )
+			                  {
+				                  detail::for_each_offset<MaxRank>(
+				                      extents, rank, t_first, t_last, [this, src, &t_func]( stride_type t_dst, stride_type t_from ) { m_data[t_dst] = t_func( src[t_from] ); },
+				                      dst_strides, src_strides );
+			                  } );
+		}
+
+		/// \brief Copies the elements of t_src into the viewed elements
+		/// \param t_src Source view with the same extents
+		/// \throws std::invalid_argument if the extents differ
+		template<typename OtherTy, typename OtherLayout>
+		void copy_from( const nd_span<OtherTy, MaxRank, OtherLayout>& t_src )
+		{
+			copy_from( seq, t_src );
+		}
+
+		/// \brief Copies the elements of t_src into the viewed elements using an execution policy
+		/// \param t_policy seq, par or parallel_policy{ thread_count }
+		/// \param t_src Source view with the same extents, must not overlap this view
+		/// \throws std::invalid_argument if the extents differ
+		/// \note Dimensions are reordered so that the innermost loop is unit-stride on the destination and
+		///       mergeable dimensions are collapsed; contiguous runs of trivially copyable elements use memcpy.
+		template<typename Policy, typename OtherTy, typename OtherLayout, std::enable_if_t<is_execution_policy_v<Policy>, int> = 0>
+		void copy_from( const Policy& t_policy, const nd_span<OtherTy, MaxRank, OtherLayout>& t_src )
+		{
+			check_same_extents( t_src );
+			ND_ARRAY_TRACE_SCOPE( "copy_from" );
+			detail::run_rows( t_policy, row_count( ),
+			                  [this, &t_src]( size_type t_first, size_type t_last )
+			                  {
+				                  std::array<size_type, MaxRank> block = m_extents;
+				                  block[0]                             = t_last - t_first;
+				                  const auto first                     = static_cast<stride_type>( t_first );
+				                  detail::strided_copy<MaxRank>( m_data + first * m_strides[0], m_strides, t_src.m_data + first * t_src.m_strides[0], t_src.m_strides,
+				                                                 block, m_rank );
+			                  } );
+		}
+
+		/// \brief Folds all viewed elements into t_init with t_reduce
+		/// \param t_init Initial value
+		/// \param t_reduce Binary operation
+		/// \return Result of the reduction (t_init for an empty view)
+		template<typename Init, typename Reduce>
+		[[nodiscard]] Init reduce( Init t_init, Reduce t_reduce ) const
+		{
+			return transform_reduce( seq, std::move( t_init ), t_reduce, []( const Ty& t_value ) -> const Ty& { return t_value; } );
+		}
+
+		/// \brief Folds all viewed elements into t_init with t_reduce using an execution policy
+		/// \param t_policy seq, par or parallel_policy{ thread_count }
+		/// \param t_init Initial value
+		/// \param t_reduce Associative binary operation (the parallel grouping of operands is unspecified)
+		/// \return Result of the reduction (t_init for an empty view)
+		template<typename Policy, typename Init, typename Reduce, std::enable_if_t<is_execution_policy_v<Policy>, int> = 0>
+		[[nodiscard]] Init reduce( const Policy& t_policy, Init t_init, Reduce t_reduce ) const
+		{
+			return transform_reduce( t_policy, std::move( t_init ), t_reduce, []( const Ty& t_value ) -> const Ty& { return t_value; } );
+		}
+
+		/// \brief Folds t_transform( x ) for all viewed elements x into t_init with t_reduce
+		/// \param t_init Initial value
+		/// \param t_reduce Binary operation
+		/// \param t_transform Function applied to each element before reduction
+		/// \return Result of the reduction (t_init for an empty view)
+		template<typename Init, typename Reduce, typename Transform, std::enable_if_t<!is_execution_policy_v<Init>, int> = 0>
+		[[nodiscard]] Init transform_reduce( Init t_init, Reduce t_reduce, Transform t_transform ) const
+		{
+			return transform_reduce( seq, std::move( t_init ), t_reduce, t_transform );
+		}
+
+		/// \brief Folds t_transform( x ) for all viewed elements x into t_init with t_reduce using an execution policy
+		/// \param t_policy seq, par or parallel_policy{ thread_count }
+		/// \param t_init Initial value
+		/// \param t_reduce Associative binary operation (the parallel grouping of operands is unspecified)
+		/// \param t_transform Function applied to each element before reduction
+		/// \return Result of the reduction (t_init for an empty view)
+		/// \example
+		/// \code
+		/// double sum_sq = view.transform_reduce(cppa::par, 0.0, std::plus<>(), [](float v) { return double(v) * v; });
+		/// \endcode
+		template<typename Policy, typename Init, typename Reduce, typename Transform, std::enable_if_t<is_execution_policy_v<Policy>, int> = 0>
+		[[nodiscard]] Init transform_reduce( const Policy& t_policy, Init t_init, Reduce t_reduce, Transform t_transform ) const
+		{
+			if( size( ) == 0 )
+			{
+				return t_init;
+			}
+			ND_ARRAY_TRACE_SCOPE( "reduce" );
+			const nd_span merged = coalesce( );
+			if constexpr( std::is_same_v<Policy, parallel_policy> )
+			{
+				return detail::parallel_reduce_rows( merged.row_count( ), t_policy.thread_count, std::move( t_init ), t_reduce,
+				                                     [this, &merged, &t_reduce, &t_transform]( size_type t_first, size_type t_last, std::optional<Init>& t_partial )
+				                                     {
+					                                     detail::for_each_offset<MaxRank>(
+					                                         merged.m_extents, merged.m_rank, t_first, t_last,
+					                                         [this, &t_reduce, &t_transform, &t_partial]( stride_type t_offset )
+					                                         {
+						                                         if( t_partial )
+						                                         {
+							                                         t_partial = t_reduce( std::move( *t_partial ), t_transform( m_data[t_offset] ) );
+						                                         }
+						                                         else
+						                                         {
+							                                         t_partial.emplace( t_transform( m_data[t_offset] ) );
+						                                         }
+					                                         },
+					                                         merged.m_strides );
+				                                     } );
+			}
+			else
+			{
+				detail::simd_dispatch(
+				    [&]
+				    {
+					    detail::for_each_offset<MaxRank>(
+					        merged.m_extents, merged.m_rank, 0, merged.m_extents[0], [&]( stride_type t_offset ) { t_init = t_reduce( std::move( t_init ), t_transform( m_data[t_offset] ) ); },
+					        merged.m_strides );
+				    } );
+				return t_init;
+			}
+		}
 
 		/// \brief Gets a pointer to the underlying data (non-const)
 		/// \return Pointer to the first element
@@ -711,35 +2744,165 @@ namespace cppa
 		/// \return Const pointer to the first element
 		[[nodiscard]] const_pointer data( ) const noexcept { return m_data; }
 
-		using iterator       = detail::nd_iterator<Ty, MaxRank>;       ///< Mutable stride-aware iterator
-		using const_iterator = detail::nd_iterator<const Ty, MaxRank>; ///< Const stride-aware iterator
+		using iterator       = detail::nd_iterator<Ty, MaxRank, Layout::first_index_fastest>;       ///< Mutable stride-aware iterator in layout order
+		using const_iterator = detail::nd_iterator<const Ty, MaxRank, Layout::first_index_fastest>; ///< Const stride-aware iterator in layout order
 
 		/// \brief Returns a stride-aware iterator to the first element
-		[[nodiscard]] iterator begin( ) noexcept { return iterator( m_data, m_extents, m_strides, m_rank ); }
+		[[nodiscard]] iterator begin( ) noexcept
+		{
+			ND_ARRAY_COUNT( noncontiguous_iterations, is_contiguous( ) ? 0 : 1 );
+			return make_iterator<iterator>( 0 );
+		}
 
 		/// \brief Returns a past-the-end iterator
-		[[nodiscard]] iterator end( ) noexcept { return iterator( m_data, m_extents, m_strides, m_rank, size( ) ); }
+		[[nodiscard]] iterator end( ) noexcept { return make_iterator<iterator>( size( ) ); }
 
 		/// \brief Returns a stride-aware const iterator to the first element
-		[[nodiscard]] const_iterator begin( ) const noexcept { return const_iterator( m_data, m_extents, m_strides, m_rank ); }
+		[[nodiscard]] const_iterator begin( ) const noexcept
+		{
+			ND_ARRAY_COUNT( noncontiguous_iterations, is_contiguous( ) ? 0 : 1 );
+			return make_iterator<const_iterator>( 0 );
+		}
 
 		/// \brief Returns a past-the-end const iterator
-		[[nodiscard]] const_iterator end( ) const noexcept { return const_iterator( m_data, m_extents, m_strides, m_rank, size( ) ); }
+		[[nodiscard]] const_iterator end( ) const noexcept { return make_iterator<const_iterator>( size( ) ); }
 
 		/// \brief Returns a stride-aware const iterator to the first element
-		[[nodiscard]] const_iterator cbegin( ) const noexcept { return const_iterator( m_data, m_extents, m_strides, m_rank ); }
+		[[nodiscard]] const_iterator cbegin( ) const noexcept { return begin( ); }
 
 		/// \brief Returns a past-the-end const iterator
-		[[nodiscard]] const_iterator cend( ) const noexcept { return const_iterator( m_data, m_extents, m_strides, m_rank, size( ) ); }
+		[[nodiscard]] const_iterator cend( ) const noexcept { return make_iterator<const_iterator>( size( ) ); }
+
+		/// \brief Checks whether the elements are dense in iteration order, so that raw pointers visit them like the iterators
+		/// \return True for views contiguous in the order of the layout policy; false for permuted layout_stride views
+		[[nodiscard]] bool is_contiguous_in_order( ) const noexcept
+		{
+			return Layout::first_index_fastest ? detail::is_column_major_contiguous<MaxRank>( m_extents, m_strides, m_rank )
+			                                   : detail::is_contiguous<MaxRank>( m_extents, m_strides, m_rank );
+		}
+
+		/// \brief Gets the viewed elements as a range of raw pointers, in iteration order
+		/// \return Pointer range over size() elements starting at data()
+		/// \throws std::runtime_error if is_contiguous_in_order() is false
+		/// \note Pointers carry no per-step state, so standard algorithms over them vectorize like on a raw buffer.
+		/// \example
+		/// \code
+		/// nd_span<float> frame(buffer.data(), 1080, 1920);
+		/// auto pixels = frame.as_contiguous();
+		/// std::sort(pixels.begin(), pixels.end());
+		/// \endcode
+		[[nodiscard]] detail::pointer_range<Ty> as_contiguous( ) { return { contiguous_data( ), size( ) }; }
+
+		/// \brief Gets the viewed elements as a range of raw const pointers, in iteration order
+		/// \throws std::runtime_error if is_contiguous_in_order() is false
+		[[nodiscard]] detail::pointer_range<const Ty> as_contiguous( ) const { return { contiguous_data( ), size( ) }; }
+
+		/// \brief Calls t_func( first, last ) with raw pointers if the view is contiguous in iteration order and
+		///        with stride-aware iterators otherwise
+		/// \tparam Func Callable accepting both iterator types and returning the same type for both, e.g. a generic lambda
+		/// \param t_func Function receiving the begin and end of the elements
+		/// \return The result of t_func
+		/// \example
+		/// \code
+		/// // Vectorized on contiguous views, still correct on transposed or sliced ones
+		/// const float total = view.with_iterators([](auto t_first, auto t_last) { return std::accumulate(t_first, t_last, 0.0f); });
+		/// \endcode
+		template<typename Func>
+		decltype( auto ) with_iterators( Func&& t_func )
+		{
+			if( is_contiguous_in_order( ) )
+			{
+				return std::forward<Func>( t_func )( m_data, m_data + size( ) );
+			}
+			return std::forward<Func>( t_func )( begin( ), end( ) );
+		}
+
+		/// \brief Calls t_func( first, last ) with raw const pointers if the view is contiguous in iteration order
+		///        and with stride-aware const iterators otherwise
+		/// \see with_iterators( Func&& )
+		template<typename Func>
+		decltype( auto ) with_iterators( Func&& t_func ) const
+		{
+			if( is_contiguous_in_order( ) )
+			{
+				return std::forward<Func>( t_func )( static_cast<const_pointer>( m_data ), static_cast<const_pointer>( m_data ) + size( ) );
+			}
+			return std::forward<Func>( t_func )( begin( ), end( ) );
+		}
 
 	private:
+		template<typename, size_t, typename>
+		friend class nd_span;
+
+		/// \brief Returns data() after checking that raw pointers visit the elements in iteration order
+		[[nodiscard]] pointer contiguous_data( ) const
+		{
+			if( !is_contiguous_in_order( ) )
+			{
+				throw std::runtime_error( "View is not contiguous in iteration order" );
+			}
+			return m_data;
+		}
+
 		pointer m_data;                           ///< Pointer to the first element
 		std::array<size_type, MaxRank> m_extents; ///< Size of each dimension
-		std::array<size_type, MaxRank> m_strides; ///< Stride for each dimension
+		std::array<stride_type, MaxRank> m_strides; ///< Stride for each dimension
 		size_type m_rank;                         ///< Actual number of dimensions
 
-		/// \brief Computes row-major strides from extents
-		constexpr void compute_strides( ) noexcept { detail::stride_computer<MaxRank>::compute( m_strides, m_extents, m_rank ); }
+		/// \brief Computes the default strides of the layout policy from extents
+		constexpr void compute_strides( ) noexcept { Layout::template compute_strides<MaxRank>( m_strides, m_extents, m_rank ); }
+
+		/// \brief Creates an iterator at flat position t_flat over the coalesced dimensions, which visit the same elements with fewer carries
+		template<typename Iterator>
+		[[nodiscard]] Iterator make_iterator( size_type t_flat ) const noexcept
+		{
+			const nd_span merged = coalesce( );
+			return Iterator( m_data, merged.m_extents, merged.m_strides, merged.m_rank, t_flat );
+		}
+
+		/// \brief Extent of the outermost dimension, the unit of work split between threads (0 for an empty view)
+		[[nodiscard]] size_type row_count( ) const noexcept { return size( ) == 0 ? 0 : m_extents[0]; }
+
+		/// \brief Calls t_func( offset ) for every viewed element, splitting the outermost dimension according to t_policy
+		template<typename Policy, typename Func>
+		void for_each_row_block( const Policy& t_policy, Func&& t_func ) const
+		{
+			const nd_span merged = coalesce( );
+			detail::run_rows( t_policy, merged.row_count( ),
+			                  [&merged, &t_func]( size_type t_first, size_type t_last )
+			                  { detail::for_each_offset<MaxRank>( merged.m_extents, merged.m_rank, t_first, t_last, t_func, merged.m_strides ); } );
+		}
+
+		/// \brief Calls t_func( offset ) for every viewed element in memory order, splitting the outermost memory dimension according to t_policy
+		template<typename Policy, typename Func>
+		void for_each_memory_block( const Policy& t_policy, Func&& t_func ) const
+		{
+			if( size( ) == 0 )
+			{
+				return;
+			}
+			std::array<detail::stride_dim, MaxRank> dims { };
+			stride_type origin   = 0;
+			const size_type rank = detail::memory_order_dims<MaxRank>( m_extents, m_strides, m_rank, dims, origin );
+			detail::run_rows( t_policy, rank == 0 ? 1 : dims[0].extent,
+			                  [&dims, rank, origin, &t_func]( size_type t_first, size_type t_last )
+			                  { detail::for_each_in_memory_order<MaxRank>( dims, rank, t_first, t_last, [origin, &t_func]( stride_type t_offset ) { t_func( origin + t_offset ); } ); } );
+		}
+
+		/// \brief Throws std::invalid_argument unless t_other has the same rank and extents
+		template<typename OtherTy, typename OtherLayout>
+		void check_same_extents( const nd_span<OtherTy, MaxRank, OtherLayout>& t_other ) const
+		{
+			bool same_extents = t_other.m_rank == m_rank;
+			for( size_type i = 0; same_extents && i < m_rank; ++i )
+			{
+				same_extents = t_other.m_extents[i] == m_extents[i];
+			}
+			if( !same_extents )
+			{
+				throw std::invalid_argument( "Shape mismatch" );
+			}
+		}
 
 		/// \brief Computes total number of elements from extents
 		[[nodiscard]] constexpr size_type compute_size( ) const noexcept
@@ -754,14 +2917,65 @@ namespace cppa
 			return s;
 		}
 
+		[[nodiscard]] nd_span<const Ty, MaxRank, Layout> broadcast_impl( const size_type* t_extents, size_type t_rank ) const
+		{
+			if( t_rank > MaxRank )
+			{
+				throw std::invalid_argument( "Rank exceeds MaxRank" );
+			}
+			std::array<stride_type, MaxRank> new_strides;
+			if( !detail::broadcast_strides<MaxRank>( m_extents, m_strides, m_rank, t_extents, t_rank, new_strides ) )
+			{
+				throw std::invalid_argument( "Cannot broadcast to the requested extents" );
+			}
+			std::array<size_type, MaxRank> new_extents { };
+			std::copy( t_extents, t_extents + t_rank, new_extents.begin( ) );
+			return nd_span<const Ty, MaxRank, Layout>( m_data, new_extents, new_strides, t_rank );
+		}
+
+		[[nodiscard]] nd_span<const Ty, MaxRank, Layout> sliding_window_impl( const size_type* t_window, size_type t_window_rank, const size_type* t_step,
+		                                                                      size_type t_step_rank ) const
+		{
+			if( t_window_rank != m_rank || ( t_step != nullptr && t_step_rank != m_rank ) )
+			{
+				throw std::invalid_argument( "Window rank must match rank" );
+			}
+			if( 2 * m_rank > MaxRank )
+			{
+				throw std::invalid_argument( "Rank exceeds MaxRank" );
+			}
+
+			std::array<size_type, MaxRank> new_extents { };
+			std::array<stride_type, MaxRank> new_strides { };
+			for( size_type i = 0; i < m_rank; ++i )
+			{
+				const size_type step = t_step != nullptr ? t_step[i] : 1;
+				if( t_window[i] == 0 || t_window[i] > m_extents[i] )
+				{
+					throw std::invalid_argument( "Window does not fit the extents" );
+				}
+				if( step == 0 )
+				{
+					throw std::invalid_argument( "Step must not be zero" );
+				}
+				new_extents[i]          = ( m_extents[i] - t_window[i] ) / step + 1;
+				new_strides[i]          = m_strides[i] * static_cast<stride_type>( step );
+				new_extents[m_rank + i] = t_window[i];
+				new_strides[m_rank + i] = m_strides[i];
+			}
+			return nd_span<const Ty, MaxRank, Layout>( m_data, new_extents, new_strides, 2 * m_rank );
+		}
+
 		[[nodiscard]] nd_span reshape_impl( const size_type* t_new_extents, size_type t_new_rank ) const
 		{
 			if( t_new_rank > MaxRank )
 			{
 				throw std::invalid_argument( "Rank exceeds MaxRank" );
 			}
-			if( !detail::is_contiguous<MaxRank>( m_extents, m_strides, m_rank ) )
+			// Reshape reinterprets elements in iteration order, so layout_stride needs row-major contiguity too
+			if( !is_contiguous_in_order( ) )
 			{
+				ND_ARRAY_COUNT( reshape_failures, 1 );
 				throw std::runtime_error( "Reshape requires contiguous data" );
 			}
 
@@ -777,8 +2991,8 @@ namespace cppa
 				throw std::invalid_argument( "Reshape size mismatch" );
 			}
 
-			std::array<size_type, MaxRank> new_strides { };
-			detail::stride_computer<MaxRank>::compute( new_strides, new_extents_array, t_new_rank );
+			std::array<stride_type, MaxRank> new_strides { };
+			Layout::template compute_strides<MaxRank>( new_strides, new_extents_array, t_new_rank );
 
 			return nd_span( m_data, new_extents_array, new_strides, t_new_rank );
 		}
@@ -792,7 +3006,7 @@ namespace cppa
 			detail::validate_permutation<MaxRank>( t_axes, t_axes_rank );
 
 			std::array<size_type, MaxRank> new_extents;
-			std::array<size_type, MaxRank> new_strides;
+			std::array<stride_type, MaxRank> new_strides;
 			for( size_t i = 0; i < m_rank; ++i )
 			{
 				new_extents[i] = m_extents[t_axes[i]];
@@ -823,10 +3037,262 @@ namespace cppa
 		}
 	};
 
+	/// \brief Copies the elements of one view into another view with the same extents
+	/// \param t_src Source view
+	/// \param t_dst Destination view, must not overlap the source
+	/// \throws std::invalid_argument if the extents differ
+	/// \example
+	/// \code
+	/// cppa::copy(image.subspan(0, {0, 64}), tile);  // Materialize a subspan into preallocated storage
+	/// \endcode
+	template<typename SrcTy, typename DstTy, size_t MaxRank, typename SrcLayout, typename DstLayout>
+	void copy( const nd_span<SrcTy, MaxRank, SrcLayout>& t_src, nd_span<DstTy, MaxRank, DstLayout> t_dst )
+	{
+		t_dst.copy_from( t_src );
+	}
+
+	/// \brief Copies the elements of one view into another view with the same extents using an execution policy
+	/// \param t_policy seq, par or parallel_policy{ thread_count }
+	/// \param t_src Source view
+	/// \param t_dst Destination view, must not overlap the source
+	/// \throws std::invalid_argument if the extents differ
+	template<typename Policy, typename SrcTy, typename DstTy, size_t MaxRank, typename SrcLayout, typename DstLayout,
+	         std::enable_if_t<is_execution_policy_v<Policy>, int> = 0>
+	void copy( const Policy& t_policy, const nd_span<SrcTy, MaxRank, SrcLayout>& t_src, nd_span<DstTy, MaxRank, DstLayout> t_dst )
+	{
+		t_dst.copy_from( t_policy, t_src );
+	}
+
+	/// \class static_nd_span
+	/// \brief Non-owning row-major view whose rank, and optionally extents, are fixed at compile time
+	/// \tparam Ty Element type
+	/// \tparam Extents A cppa::extents specialization
+	///
+	/// static_nd_span is the fixed-rank counterpart of nd_span for small hot tiles and
+	/// fixed-rank buffers. Only the pointer and the dynamic extents are stored, so a fully
+	/// static view such as `static_nd_span<float, extents<4, 4>>` is the size of a pointer,
+	/// and offsets are computed with a rank-deep Horner scheme that folds to constants.
+	///
+	/// <b>Typical Usage</b>
+	///
+	/// \code
+	/// float data[16];
+	/// static_nd_span<float, extents<4, 4>> tile(data);
+	/// tile(1, 2) = 5.0f;
+	///
+	/// static_nd_span<float, dextents<2>> image(pixels, 480, 640);
+	/// nd_span<float> dynamic = image; // converts to the dynamic-rank view
+	/// \endcode
+	template<typename Ty, typename Extents>
+	class static_nd_span : private Extents
+	{
+	public:
+		using extents_type    = Extents;   ///< Extents of the view
+		using value_type      = Ty;        ///< Type of elements
+		using size_type       = size_t;    ///< Type for sizes and indices
+		using reference       = Ty&;       ///< Reference to element
+		using const_reference = const Ty&; ///< Const reference to element
+		using pointer         = Ty*;       ///< Pointer to element
+		using const_pointer   = const Ty*; ///< Const pointer to element
+		using stride_type     = std::ptrdiff_t; ///< Signed stride type of the nd_span views
+		using iterator        = Ty*;       ///< The view is always contiguous, so iterators are pointers
+		using const_iterator  = const Ty*; ///< Const contiguous iterator
+
+		/// \brief Constructs a view from a pointer and extents
+		/// \param t_data Pointer to the first element
+		/// \param t_extents Extents of the view
+		constexpr static_nd_span( pointer t_data, const extents_type& t_extents ) noexcept : Extents( t_extents ), m_data( t_data ) {}
+
+		/// \brief Constructs a view from a pointer and the dynamic extents (or all extents)
+		/// \tparam Sizes Variadic extent types (typically size_t)
+		/// \param t_data Pointer to the first element
+		/// \param t_sizes rank_dynamic() dynamic extents, or rank() extents
+		/// \throws std::invalid_argument if a given static extent does not match
+		template<typename... Sizes, std::enable_if_t<( std::is_convertible_v<Sizes, size_type> && ... ), int> = 0>
+		constexpr explicit static_nd_span( pointer t_data, Sizes... t_sizes ) : Extents( t_sizes... ), m_data( t_data )
+		{
+		}
+
+		/// \brief Constructs a fixed-rank view over a dynamic-rank span
+		/// \tparam OtherTy Element type of the source span
+		/// \tparam MaxRank Maximum rank of the source span
+		/// \param t_span Source span (must be row-major contiguous)
+		/// \throws std::invalid_argument if the rank or a static extent does not match
+		/// \throws std::runtime_error if the span is not contiguous
+		template<typename OtherTy, size_t MaxRank, std::enable_if_t<std::is_convertible_v<OtherTy ( * )[], Ty ( * )[]>, int> = 0>
+		explicit static_nd_span( nd_span<OtherTy, MaxRank> t_span ) : Extents( make_extents( t_span ) )
+		                                                               , m_data( t_span.data( ) )
+		{
+		}
+
+		/// \brief Accesses an element with multi-dimensional indexing
+		/// \tparam Indices Variadic index types (typically size_t), exactly rank() of them
+		/// \param t_indices Multi-dimensional indices (i, j, k, ...)
+		/// \return Reference to the element at the specified location
+		/// \throws std::out_of_range if any index is out of bounds
+		template<typename... Indices>
+		[[nodiscard]] constexpr reference operator( )( Indices... t_indices ) const
+		{
+			static_assert( sizeof...( t_indices ) == rank( ), "Number of indices must match rank" );
+			const std::array<size_type, sizeof...( t_indices )> idx = { static_cast<size_type>( t_indices )... };
+			for( size_t i = 0; i < idx.size( ); ++i )
+			{
+				if( idx[i] >= extent( i ) )
+				{
+					throw std::out_of_range( "Index out of bounds" );
+				}
+			}
+			return m_data[offset( std::index_sequence_for<Indices...> { }, t_indices... )];
+		}
+
+		/// \brief Accesses an element without bounds checking
+		/// \tparam Indices Variadic index types (typically size_t), exactly rank() of them
+		/// \param t_indices Multi-dimensional indices (i, j, k, ...)
+		/// \return Reference to the element at the specified location
+		/// \note Indices are only validated through ND_ARRAY_ASSERT, i.e. in debug builds
+		template<typename... Indices>
+		[[nodiscard]] constexpr reference unchecked( Indices... t_indices ) const noexcept
+		{
+			static_assert( sizeof...( t_indices ) == rank( ), "Number of indices must match rank" );
+			[[maybe_unused]] const std::array<size_type, sizeof...( t_indices )> idx = { static_cast<size_type>( t_indices )... };
+			for( size_t i = 0; i < idx.size( ); ++i )
+			{
+				ND_ARRAY_ASSERT( idx[i] < extent( i ), "Index out of bounds" );
+			}
+			return m_data[offset( std::index_sequence_for<Indices...> { }, t_indices... )];
+		}
+
+		/// \brief Gets the extents object
+		[[nodiscard]] constexpr const extents_type& extents( ) const noexcept { return *this; }
+
+		/// \brief Gets the size of a specific dimension
+		/// \param t_dim Dimension index (0-based)
+		/// \return Size of the specified dimension
+		/// \throws std::out_of_range if dimension is >= rank
+		[[nodiscard]] constexpr size_type extent( size_type t_dim ) const
+		{
+			if( t_dim >= rank( ) )
+			{
+				throw std::out_of_range( "Dimension out of range" );
+			}
+			return Extents::extent( t_dim );
+		}
+
+		/// \brief Gets the row-major stride of a specific dimension
+		/// \param t_dim Dimension index (0-based)
+		/// \return Stride of the specified dimension
+		/// \throws std::out_of_range if dimension is >= rank
+		[[nodiscard]] constexpr stride_type stride( size_type t_dim ) const
+		{
+			if( t_dim >= rank( ) )
+			{
+				throw std::out_of_range( "Dimension out of range" );
+			}
+			stride_type s = 1;
+			for( size_t i = t_dim + 1; i < rank( ); ++i )
+			{
+				s *= static_cast<stride_type>( Extents::extent( i ) );
+			}
+			return s;
+		}
+
+		/// \brief Gets the total number of elements in the view
+		/// \return Product of all extents (0 when rank is 0, matching nd_span)
+		[[nodiscard]] constexpr size_type size( ) const noexcept
+		{
+			if( rank( ) == 0 )
+				return 0;
+			size_type s = 1;
+			for( size_t i = 0; i < rank( ); ++i )
+			{
+				s *= Extents::extent( i );
+			}
+			return s;
+		}
+
+		/// \brief Gets the number of dimensions
+		[[nodiscard]] static constexpr size_type rank( ) noexcept { return Extents::rank( ); }
+
+		/// \brief Gets a pointer to the underlying data
+		[[nodiscard]] constexpr pointer data( ) const noexcept { return m_data; }
+
+		/// \brief Returns a pointer to the first element
+		[[nodiscard]] constexpr iterator begin( ) const noexcept { return m_data; }
+
+		/// \brief Returns a pointer past the last element
+		[[nodiscard]] constexpr iterator end( ) const noexcept { return m_data + size( ); }
+
+		/// \brief Creates a dynamic-rank view of the same data
+		/// \tparam MaxRank Maximum rank of the resulting span
+		/// \return nd_span with identical extents and strides
+		template<size_t MaxRank = 8>
+		[[nodiscard]] nd_span<Ty, MaxRank> as_span( ) const noexcept
+		{
+			static_assert( rank( ) <= MaxRank, "Rank exceeds MaxRank" );
+			std::array<size_type, MaxRank> new_extents { };
+			std::array<stride_type, MaxRank> new_strides { };
+			for( size_t i = 0; i < rank( ); ++i )
+			{
+				new_extents[i] = Extents::extent( i );
+			}
+			detail::stride_computer<MaxRank>::compute( new_strides, new_extents, rank( ) );
+			return nd_span<Ty, MaxRank>( m_data, new_extents, new_strides, rank( ) );
+		}
+
+		/// \brief Implicit conversion to a dynamic-rank view
+		template<typename OtherTy, size_t MaxRank, std::enable_if_t<std::is_convertible_v<Ty ( * )[], OtherTy ( * )[]>, int> = 0>
+		operator nd_span<OtherTy, MaxRank>( ) const noexcept // NOLINT(google-explicit-constructor)
+		{
+			return static_nd_span<OtherTy, Extents>( m_data, extents( ) ).template as_span<MaxRank>( );
+		}
+
+	private:
+		pointer m_data; ///< Pointer to the first element
+
+		/// \brief Computes a row-major offset as ((i0 * e1 + i1) * e2 + i2) ...
+		template<size_t... Is, typename... Indices>
+		[[nodiscard]] constexpr size_type offset( std::index_sequence<Is...>, Indices... t_indices ) const noexcept
+		{
+			size_type result = 0;
+			( ( result = result * Extents::extent( Is ) + static_cast<size_type>( t_indices ) ), ... );
+			return result;
+		}
+
+		template<typename OtherTy, size_t MaxRank>
+		[[nodiscard]] static extents_type make_extents( const nd_span<OtherTy, MaxRank>& t_span )
+		{
+			if( t_span.rank( ) != rank( ) )
+			{
+				throw std::invalid_argument( "Span rank does not match static rank" );
+			}
+			if( t_span.size( ) > 0 )
+			{
+				stride_type expected = 1;
+				for( size_t i = rank( ); i-- > 0; )
+				{
+					if( t_span.stride( i ) != expected )
+					{
+						throw std::runtime_error( "static_nd_span requires contiguous data" );
+					}
+					expected *= static_cast<stride_type>( t_span.extent( i ) );
+				}
+			}
+			return make_extents_impl( t_span, std::make_index_sequence<rank( )> { } );
+		}
+
+		template<typename OtherTy, size_t MaxRank, size_t... Is>
+		[[nodiscard]] static extents_type make_extents_impl( const nd_span<OtherTy, MaxRank>& t_span, std::index_sequence<Is...> )
+		{
+			return extents_type( t_span.extent( Is )... );
+		}
+	};
+
 	/// \class nd_array
 	/// \brief Owning multi-dimensional array with dynamic rank and single memory allocation
 	/// \tparam T Element type
 	/// \tparam MaxRank Maximum number of dimensions (default: 8)
+	/// \tparam Allocator Allocator used for the element buffer (default: std::allocator)
+	/// \tparam InlineCapacity Arrays of up to this many elements are stored inside the object (default: 0)
 	///
 	/// nd_array provides a dynamically-sized multi-dimensional array with:
 	///
@@ -838,9 +3304,13 @@ namespace cppa
 	///
 	/// <b>Memory Allocation</b>
 	///
-	/// All memory is allocated once during construction using `std::unique_ptr<T[]>`.
-	/// No further allocations occur during the object's lifetime, minimizing
-	/// allocation overhead and memory fragmentation.
+	/// All memory is allocated once during construction through `Allocator`.
+	/// No further allocations occur unless an assignment or resize() needs more than
+	/// capacity() elements; smaller contents reuse the buffer, minimizing
+	/// allocation overhead and memory fragmentation. Plug in an arena or pool via a
+	/// custom allocator or a `std::pmr::memory_resource` (see cppa::pmr::nd_array).
+	/// With a non-zero `InlineCapacity` small arrays skip the allocator entirely and keep
+	/// their elements inside the object (see cppa::small_nd_array).
 	///
 	/// <b>Typical Usage</b>
 	///
@@ -850,20 +3320,27 @@ namespace cppa
 	/// matrix(1, 2) = 5.0;                     // Set element
 	/// auto sub = matrix.subspan(0, 1, 3);     // View of rows 1-2
 	/// \endcode
-	template<typename Ty, size_t MaxRank = 8>
+	template<typename Ty, size_t MaxRank = 8, typename Allocator = std::allocator<Ty>, size_t InlineCapacity = 0>
 	class nd_array
 	{
 	public:
+		using allocator_type  = Allocator; ///< Allocator for the element buffer
 		using value_type      = Ty;        ///< Type of elements
 		using size_type       = size_t;    ///< Type for sizes and indices
 		using reference       = Ty&;       ///< Reference to element
 		using const_reference = const Ty&; ///< Const reference to element
 		using pointer         = Ty*;       ///< Pointer to element
 		using const_pointer   = const Ty*; ///< Const pointer to element
+		using stride_type     = std::ptrdiff_t; ///< Signed stride in elements, as used by nd_span
 
 		/// \brief Constructs an empty array with no dimensions
 		/// \note No memory is allocated
-		nd_array( ) noexcept : m_data( nullptr ), m_size( 0 ), m_rank( 0 )
+		nd_array( ) noexcept( std::is_nothrow_default_constructible_v<Allocator> ) : nd_array( Allocator( ) ) {}
+
+		/// \brief Constructs an empty array that will allocate through t_alloc
+		/// \param t_alloc Allocator for the element buffer
+		/// \note No memory is allocated
+		explicit nd_array( const Allocator& t_alloc ) noexcept : m_data( t_alloc ), m_size( 0 ), m_rank( 0 )
 		{
 			m_extents.fill( 0 );
 			m_strides.fill( 0 );
@@ -878,7 +3355,13 @@ namespace cppa
 		/// \code
 		/// nd_array<double> arr({3, 4, 5});  // 3x4x5 array
 		/// \endcode
-		nd_array( std::initializer_list<size_type> t_extents ) : m_rank( t_extents.size( ) )
+		nd_array( std::initializer_list<size_type> t_extents ) : nd_array( t_extents, Allocator( ) ) {}
+
+		/// \brief Constructs an array with specified dimension sizes using an allocator
+		/// \param t_extents Initializer list of dimension sizes {dim0, dim1, ...}
+		/// \param t_alloc Allocator for the element buffer
+		/// \throws std::invalid_argument if number of dimensions exceeds MaxRank
+		nd_array( std::initializer_list<size_type> t_extents, const Allocator& t_alloc ) : m_data( t_alloc ), m_rank( t_extents.size( ) )
 		{
 			if( m_rank > MaxRank )
 			{
@@ -897,7 +3380,7 @@ namespace cppa
 
 			compute_strides( );
 			m_size = compute_size( );
-			m_data = std::make_unique<Ty[]>( m_size ); // NOLINT(modernize-avoid-c-arrays)
+			m_data.allocate( m_size );
 		}
 
 		/// \brief Constructs an array from a container of dimension sizes
@@ -910,8 +3393,21 @@ namespace cppa
 		/// nd_array<double> arr(dims);  // 2x3x4 array
 		/// \endcode
 		template<typename Container>
-		nd_array( const Container& t_extents, std::enable_if_t<!std::is_integral_v<Container> && !std::is_same_v<Container, nd_array>>* = nullptr )
-		    : m_rank( t_extents.size( ) )
+		nd_array( const Container& t_extents, std::enable_if_t<!std::is_integral_v<Container> && !std::is_same_v<Container, nd_array> && !detail::is_expression_v<Container>>* = nullptr )
+		    : nd_array( t_extents, Allocator( ) )
+		{
+		}
+
+		/// \brief Constructs an array from a container of dimension sizes using an allocator
+		/// \tparam Container Type of container holding extents (e.g., std::vector<size_t>)
+		/// \param t_extents Container with dimension sizes
+		/// \param t_alloc Allocator for the element buffer
+		/// \throws std::invalid_argument if number of dimensions exceeds MaxRank
+		template<typename Container>
+		nd_array( const Container& t_extents, const Allocator& t_alloc,
+		          std::enable_if_t<!std::is_integral_v<Container> && !std::is_same_v<Container, nd_array> && !detail::is_expression_v<Container>>* = nullptr )
+		    : m_data( t_alloc )
+		    , m_rank( t_extents.size( ) )
 		{
 			if( m_rank > MaxRank )
 			{
@@ -930,7 +3426,7 @@ namespace cppa
 
 			compute_strides( );
 			m_size = compute_size( );
-			m_data = std::make_unique<Ty[]>( m_size ); // NOLINT(modernize-avoid-c-arrays)
+			m_data.allocate( m_size );
 		}
 
 		/// \brief Constructs an array with variadic dimension sizes
@@ -940,38 +3436,124 @@ namespace cppa
 		/// \code
 		/// nd_array<double> arr(2, 3, 4);  // 2x3x4 array
 		/// \endcode
-		template<typename... Indices>
-		nd_array( Indices... t_indices ) : m_rank( sizeof...( t_indices ) )
+		template<typename... Indices, std::enable_if_t<( std::is_convertible_v<Indices, size_type> && ... ), int> = 0>
+		nd_array( Indices... t_indices ) : nd_array( std::allocator_arg, Allocator( ), t_indices... )
 		{
-			static_assert( sizeof...( t_indices ) <= MaxRank, "Too many dimensions" );
+		}
 
-			std::array<size_type, sizeof...( t_indices )> temp = { static_cast<size_type>( t_indices )... };
-			for( size_t i = 0; i < m_rank; ++i )
+		/// \brief Constructs an array with variadic dimension sizes using an allocator
+		/// \tparam Indices Variadic index types (typically size_t or convertible to size_t)
+		/// \param t_alloc Allocator for the element buffer
+		/// \param t_indices Dimension sizes as separate arguments
+		/// \example
+		/// \code
+		/// std::pmr::monotonic_buffer_resource arena;
+		/// pmr::nd_array<float> tmp(std::allocator_arg, &arena, 64, 64);
+		/// \endcode
+		template<typename... Indices, std::enable_if_t<( std::is_convertible_v<Indices, size_type> && ... ), int> = 0>
+		nd_array( std::allocator_arg_t, const Allocator& t_alloc, Indices... t_indices ) : m_data( t_alloc )
+		                                                                                 , m_rank( sizeof...( t_indices ) )
+		{
+			init_extents( t_indices... );
+			m_data.allocate( m_size );
+		}
+
+		/// \brief Constructs an array without zero-filling its elements
+		/// \tparam Indices Variadic index types (typically size_t or convertible to size_t)
+		/// \param t_indices Dimension sizes as separate arguments
+		/// \note Trivially default constructible elements hold indeterminate values until written,
+		///       other element types are value-initialized as usual
+		/// \example
+		/// \code
+		/// nd_array<float> buffer(cppa::uninitialized, 1024, 1024, 256);
+		/// read_into(buffer.data(), buffer.size());
+		/// \endcode
+		template<typename... Indices, std::enable_if_t<( std::is_convertible_v<Indices, size_type> && ... ), int> = 0>
+		nd_array( uninitialized_t, Indices... t_indices ) : nd_array( std::allocator_arg, Allocator( ), uninitialized, t_indices... )
+		{
+		}
+
+		/// \brief Constructs an array without zero-filling its elements using an allocator
+		/// \tparam Indices Variadic index types (typically size_t or convertible to size_t)
+		/// \param t_alloc Allocator for the element buffer
+		/// \param t_indices Dimension sizes as separate arguments
+		template<typename... Indices, std::enable_if_t<( std::is_convertible_v<Indices, size_type> && ... ), int> = 0>
+		nd_array( std::allocator_arg_t, const Allocator& t_alloc, uninitialized_t, Indices... t_indices ) : m_data( t_alloc )
+		                                                                                                  , m_rank( sizeof...( t_indices ) )
+		{
+			init_extents( t_indices... );
+			m_data.allocate_for_overwrite( m_size );
+		}
+
+		/// \brief Constructs a zero-initialized array whose pages are first touched by several threads
+		/// \tparam Indices Variadic index types (typically size_t or convertible to size_t)
+		/// \param t_touch Number of threads, each initializing a block of the outermost dimension
+		/// \param t_indices Dimension sizes as separate arguments
+		/// \note Element types that are not trivially default constructible are initialized sequentially
+		/// \example
+		/// \code
+		/// nd_array<float> volume(cppa::first_touch_t{ 16 }, 4096, 4096);
+		/// \endcode
+		template<typename... Indices, std::enable_if_t<( std::is_convertible_v<Indices, size_type> && ... ), int> = 0>
+		nd_array( first_touch_t t_touch, Indices... t_indices ) : nd_array( std::allocator_arg, Allocator( ), t_touch, t_indices... )
+		{
+		}
+
+		/// \brief Constructs a zero-initialized array whose pages are first touched by several threads using an allocator
+		/// \tparam Indices Variadic index types (typically size_t or convertible to size_t)
+		/// \param t_alloc Allocator for the element buffer
+		/// \param t_touch Number of threads, each initializing a block of the outermost dimension
+		/// \param t_indices Dimension sizes as separate arguments
+		template<typename... Indices, std::enable_if_t<( std::is_convertible_v<Indices, size_type> && ... ), int> = 0>
+		nd_array( std::allocator_arg_t, const Allocator& t_alloc, first_touch_t t_touch, Indices... t_indices ) : m_data( t_alloc )
+		                                                                                                         , m_rank( sizeof...( t_indices ) )
+		{
+			init_extents( t_indices... );
+			if constexpr( std::is_trivially_default_constructible_v<Ty> && std::is_trivially_copyable_v<Ty> )
 			{
-				m_extents[i] = temp[i];
+				m_data.allocate_for_overwrite( m_size );
+				if( m_size > 0 )
+				{
+					const size_type row_size = m_size / m_extents[0];
+					pointer data             = m_data.get( );
+					detail::parallel_for_rows( m_extents[0], t_touch.thread_count,
+					                           [data, row_size]( size_type t_first, size_type t_last )
+					                           { std::fill( data + t_first * row_size, data + t_last * row_size, Ty( ) ); } );
+				}
 			}
-			for( size_t i = m_rank; i < MaxRank; ++i )
+			else
 			{
-				m_extents[i] = 0;
+				m_data.allocate( m_size );
 			}
-
-			compute_strides( );
-			m_size = compute_size( );
-			m_data = std::make_unique<Ty[]>( m_size ); // NOLINT(modernize-avoid-c-arrays)
 		}
 
 		/// \brief Copy constructor - performs deep copy of data
 		/// \param t_other Array to copy from
-		nd_array( const nd_array& t_other ) : m_extents( t_other.m_extents ), m_strides( t_other.m_strides ), m_size( t_other.m_size ), m_rank( t_other.m_rank )
+		nd_array( const nd_array& t_other )
+		    : nd_array( t_other, std::allocator_traits<Allocator>::select_on_container_copy_construction( t_other.get_allocator( ) ) )
+		{
+		}
+
+		/// \brief Copy constructor using a different allocator - performs deep copy of data
+		/// \param t_other Array to copy from
+		/// \param t_alloc Allocator for the new element buffer
+		nd_array( const nd_array& t_other, const Allocator& t_alloc )
+		    : m_data( t_alloc )
+		    , m_extents( t_other.m_extents )
+		    , m_strides( t_other.m_strides )
+		    , m_size( t_other.m_size )
+		    , m_rank( t_other.m_rank )
 		{
 			if( m_size > 0 )
 			{
-				m_data = std::make_unique<Ty[]>( m_size ); // NOLINT(modernize-avoid-c-arrays)
-				std::copy( t_other.m_data.get( ), t_other.m_data.get( ) + m_size, m_data.get( ) );
+				m_data.allocate_from( t_other.m_data.get( ), m_size );
 			}
+			ND_ARRAY_COUNT( deep_copies, 1 );
+			ND_ARRAY_COUNT( copied_bytes, m_size * sizeof( Ty ) );
 		}
 
 		/// \brief Move constructor - transfers ownership of data
+		/// \note Inline elements are moved one by one, so views of a small array do not follow the move
 		nd_array( nd_array&& t_other ) noexcept = default;
 
 		/// \brief Constructs an owning array by deep-copying an nd_span
@@ -983,26 +3565,57 @@ namespace cppa
 		/// \param t_span Source span to copy
 		explicit nd_array( const nd_span<Ty, MaxRank>& t_span ) : nd_array( from_span( t_span ) ) {}
 
+		/// \brief Constructs an owning array by deep-copying an nd_span using an allocator
+		/// \param t_span Source span to copy
+		/// \param t_alloc Allocator for the element buffer
+		nd_array( const nd_span<const Ty, MaxRank>& t_span, const Allocator& t_alloc ) : nd_array( from_span( t_span, t_alloc ) ) {}
+
+		/// \brief Constructs an owning array by deep-copying an nd_span using an allocator
+		/// \param t_span Source span to copy
+		/// \param t_alloc Allocator for the element buffer
+		nd_array( const nd_span<Ty, MaxRank>& t_span, const Allocator& t_alloc ) : nd_array( from_span( t_span, t_alloc ) ) {}
+
+		/// \brief Constructs an array by evaluating a lazy element-wise expression
+		/// \tparam Expr Expression type built with the operators from nd_expr.hpp
+		/// \param t_expr Expression to evaluate; its extents become the extents of the array
+		/// \param t_alloc Allocator for the element buffer
+		/// \throws std::invalid_argument if the expression rank exceeds MaxRank
+		/// \example
+		/// \code
+		/// nd_array<double> c(a * b + 1.0);  // One pass, no temporaries
+		/// \endcode
+		template<typename Expr, std::enable_if_t<detail::is_expression_v<Expr>, int> = 0>
+		explicit nd_array( const Expr& t_expr, const Allocator& t_alloc = Allocator( ) ) : nd_array( t_alloc )
+		{
+			init_extents_from( t_expr );
+			m_data.allocate_for_overwrite( m_size );
+			detail::assign_expression( as_span( ), t_expr );
+		}
+
 		/// \brief Copy assignment operator - performs deep copy of data
 		/// \param t_other Array to copy from
 		/// \return Reference to this array
+		/// \note The existing buffer is reused when capacity() is large enough, so repeated assignments of
+		///       equally sized arrays do not allocate. In that case only the basic exception guarantee applies.
 		nd_array& operator=( const nd_array& t_other )
 		{
 			if( this != &t_other )
 			{
+				if constexpr( std::allocator_traits<Allocator>::propagate_on_container_copy_assignment::value )
+				{
+					if( m_data.allocator( ) != t_other.m_data.allocator( ) )
+					{
+						m_data.reset( );
+					}
+					m_data.allocator( ) = t_other.m_data.allocator( );
+				}
+				m_data.assign( t_other.m_data.get( ), t_other.m_size );
+				ND_ARRAY_COUNT( deep_copies, 1 );
+				ND_ARRAY_COUNT( copied_bytes, t_other.m_size * sizeof( Ty ) );
 				m_rank    = t_other.m_rank;
 				m_size    = t_other.m_size;
 				m_extents = t_other.m_extents;
 				m_strides = t_other.m_strides;
-				if( m_size > 0 )
-				{
-					m_data = std::make_unique<Ty[]>( m_size ); // NOLINT(modernize-avoid-c-arrays)
-					std::copy( t_other.m_data.get( ), t_other.m_data.get( ) + m_size, m_data.get( ) );
-				}
-				else
-				{
-					m_data.reset( );
-				}
 			}
 			return *this;
 		}
@@ -1010,7 +3623,7 @@ namespace cppa
 		/// \brief Move assignment operator - transfers ownership of data
 		/// \param t_other Array to move from
 		/// \return Reference to this array
-		nd_array& operator=( nd_array&& t_other ) noexcept = default;
+		nd_array& operator=( nd_array&& t_other ) noexcept( std::is_nothrow_move_assignable_v<detail::array_storage<Ty, Allocator, InlineCapacity>> ) = default;
 
 		/// \brief Assigns from an nd_span by deep-copying its contents
 		/// \param t_span Source span to copy
@@ -1022,6 +3635,28 @@ namespace cppa
 		/// \return Reference to this array
 		nd_array& operator=( const nd_span<Ty, MaxRank>& t_span ) { return *this = from_span( t_span ); }
 
+		/// \brief Evaluates a lazy element-wise expression into this array
+		/// \tparam Expr Expression type built with the operators from nd_expr.hpp
+		/// \param t_expr Expression to evaluate
+		/// \return Reference to this array
+		/// \note The existing buffer is reused when the extents already match, otherwise the array is reallocated
+		///       to the extents of the expression. Operands may alias this array.
+		template<typename Expr, std::enable_if_t<detail::is_expression_v<Expr>, int> = 0>
+		nd_array& operator=( const Expr& t_expr )
+		{
+			bool same_extents = t_expr.rank( ) == m_rank;
+			for( size_type i = 0; same_extents && i < m_rank; ++i )
+			{
+				same_extents = t_expr.extent( i ) == m_extents[i];
+			}
+			if( !same_extents )
+			{
+				return *this = nd_array( t_expr, m_data.allocator( ) );
+			}
+			detail::assign_expression( as_span( ), t_expr );
+			return *this;
+		}
+
 		/// \brief Creates an owning array by deep-copying an nd_span
 		/// \param t_span Source span to copy
 		/// \return Newly allocated array with the same contents
@@ -1033,6 +3668,21 @@ namespace cppa
 		/// \return Newly allocated array with the same contents
 		static nd_array from_span( const nd_span<Ty, MaxRank>& t_span ) { return from_span_impl( t_span ); }
 
+		/// \brief Creates an owning array by deep-copying an nd_span using an allocator
+		/// \param t_span Source span to copy
+		/// \param t_alloc Allocator for the element buffer
+		/// \return Newly allocated array with the same contents
+		static nd_array from_span( const nd_span<const Ty, MaxRank>& t_span, const Allocator& t_alloc ) { return from_span_impl( t_span, t_alloc ); }
+
+		/// \brief Creates an owning array by deep-copying an nd_span using an allocator
+		/// \param t_span Source span to copy
+		/// \param t_alloc Allocator for the element buffer
+		/// \return Newly allocated array with the same contents
+		static nd_array from_span( const nd_span<Ty, MaxRank>& t_span, const Allocator& t_alloc ) { return from_span_impl( t_span, t_alloc ); }
+
+		/// \brief Gets a copy of the allocator used for the element buffer
+		[[nodiscard]] allocator_type get_allocator( ) const noexcept { return m_data.allocator( ); }
+
 		/// \brief Accesses an element with multi-dimensional indexing (non-const)
 		/// \tparam Indices Variadic index types (typically size_t)
 		/// \param t_indices Multi-dimensional indices (i, j, k, ...)
@@ -1062,6 +3712,29 @@ namespace cppa
 			return m_data[detail::offset_computer<MaxRank>::compute( m_extents, m_strides, t_indices... )];
 		}
 
+		/// \brief Accesses an element without bounds checking (non-const)
+		/// \tparam Indices Variadic index types (typically size_t)
+		/// \param t_indices Multi-dimensional indices (i, j, k, ...)
+		/// \return Reference to the element at the specified location
+		/// \note Indices are only validated through ND_ARRAY_ASSERT, i.e. in debug builds
+		template<typename... Indices>
+		[[nodiscard]] reference unchecked( Indices... t_indices ) noexcept
+		{
+			static_assert( sizeof...( t_indices ) <= MaxRank, "Too many indices" );
+			return m_data[detail::offset_computer<MaxRank>::compute_unchecked( m_extents, m_strides, t_indices... )];
+		}
+
+		/// \brief Accesses an element without bounds checking (const)
+		/// \tparam Indices Variadic index types (typically size_t)
+		/// \param t_indices Multi-dimensional indices (i, j, k, ...)
+		/// \return Const reference to the element at the specified location
+		template<typename... Indices>
+		[[nodiscard]] const_reference unchecked( Indices... t_indices ) const noexcept
+		{
+			static_assert( sizeof...( t_indices ) <= MaxRank, "Too many indices" );
+			return m_data[detail::offset_computer<MaxRank>::compute_unchecked( m_extents, m_strides, t_indices... )];
+		}
+
 		/// \brief Creates a subspan with multiple dimension ranges
 		/// \param t_ranges Initializer list of {start, end} pairs for each dimension
 		/// \return Non-owning view (nd_span) of the restricted data
@@ -1073,10 +3746,10 @@ namespace cppa
 		/// \endcode
 		[[nodiscard]] nd_span<Ty, MaxRank> subspan( std::initializer_list<std::pair<size_type, size_type>> t_ranges )
 		{
-			std::array<size_type, MaxRank> new_extents = m_extents;
-			std::array<size_type, MaxRank> new_strides = m_strides;
-			size_type offset                           = 0;
-			size_type dim                              = 0;
+			std::array<size_type, MaxRank> new_extents   = m_extents;
+			std::array<stride_type, MaxRank> new_strides = m_strides;
+			stride_type offset                           = 0;
+			size_type dim                                = 0;
 
 			for( const auto& [start, end]: t_ranges )
 			{
@@ -1088,7 +3761,7 @@ namespace cppa
 				{
 					throw std::out_of_range( "Invalid range for subspan" );
 				}
-				offset += start * m_strides[dim];
+				offset += static_cast<stride_type>( start ) * m_strides[dim];
 				new_extents[dim] = end - start;
 				++dim;
 			}
@@ -1102,10 +3775,10 @@ namespace cppa
 		/// 	hrows std::out_of_range if too many dimensions or invalid ranges
 		[[nodiscard]] nd_span<const Ty, MaxRank> subspan( std::initializer_list<std::pair<size_type, size_type>> t_ranges ) const
 		{
-			std::array<size_type, MaxRank> new_extents = m_extents;
-			std::array<size_type, MaxRank> new_strides = m_strides;
-			size_type offset                           = 0;
-			size_type dim                              = 0;
+			std::array<size_type, MaxRank> new_extents   = m_extents;
+			std::array<stride_type, MaxRank> new_strides = m_strides;
+			stride_type offset                           = 0;
+			size_type dim                                = 0;
 
 			for( const auto& [start, end]: t_ranges )
 			{
@@ -1117,7 +3790,7 @@ namespace cppa
 				{
 					throw std::out_of_range( "Invalid range for subspan" );
 				}
-				offset += start * m_strides[dim];
+				offset += static_cast<stride_type>( start ) * m_strides[dim];
 				new_extents[dim] = end - start;
 				++dim;
 			}
@@ -1151,7 +3824,7 @@ namespace cppa
 			std::array<size_type, MaxRank> new_extents = m_extents;
 			new_extents[t_dim]                         = t_end - t_start;
 
-			size_type offset = t_start * m_strides[t_dim];
+			const stride_type offset = static_cast<stride_type>( t_start ) * m_strides[t_dim];
 
 			return nd_span<Ty, MaxRank>( m_data.get( ) + offset, new_extents, m_strides, m_rank );
 		}
@@ -1177,11 +3850,47 @@ namespace cppa
 			std::array<size_type, MaxRank> new_extents = m_extents;
 			new_extents[t_dim]                         = end - start;
 
-			size_type offset = start * m_strides[t_dim];
+			const stride_type offset = static_cast<stride_type>( start ) * m_strides[t_dim];
 
 			return nd_span<const Ty, MaxRank>( m_data.get( ) + offset, new_extents, m_strides, m_rank );
 		}
 
+		/// \brief Creates a subspan of every t_step-th element of a range along one dimension
+		/// \param t_dim Dimension to restrict (0-based)
+		/// \param t_range Pair of {start (inclusive), end (exclusive)} indices for that dimension
+		/// \param t_step Distance between selected indices; a negative step walks the range backwards
+		/// \return Non-owning view (nd_span) of the selected elements
+		/// \throws std::out_of_range if dimension or range is invalid
+		/// \throws std::invalid_argument if t_step is 0
+		[[nodiscard]] nd_span<Ty, MaxRank> subspan( size_type t_dim, std::pair<size_type, size_type> t_range, stride_type t_step )
+		{
+			return as_span( ).subspan( t_dim, t_range, t_step );
+		}
+
+		/// \brief Creates a subspan of every t_step-th element of a range along one dimension (const)
+		/// \param t_dim Dimension to restrict (0-based)
+		/// \param t_range Pair of {start (inclusive), end (exclusive)} indices for that dimension
+		/// \param t_step Distance between selected indices; a negative step walks the range backwards
+		/// \return Non-owning view (nd_span) of the selected elements
+		/// \throws std::out_of_range if dimension or range is invalid
+		/// \throws std::invalid_argument if t_step is 0
+		[[nodiscard]] nd_span<const Ty, MaxRank> subspan( size_type t_dim, std::pair<size_type, size_type> t_range, stride_type t_step ) const
+		{
+			return as_span( ).subspan( t_dim, t_range, t_step );
+		}
+
+		/// \brief Creates a view with the order of one dimension reversed
+		/// \param t_dim Dimension to reverse (0-based)
+		/// \return Non-owning view (nd_span) in which index i of t_dim addresses extent - 1 - i
+		/// \throws std::out_of_range if dimension is invalid
+		[[nodiscard]] nd_span<Ty, MaxRank> flip( size_type t_dim ) { return as_span( ).flip( t_dim ); }
+
+		/// \brief Creates a view with the order of one dimension reversed (const)
+		/// \param t_dim Dimension to reverse (0-based)
+		/// \return Non-owning view (nd_span) in which index i of t_dim addresses extent - 1 - i
+		/// \throws std::out_of_range if dimension is invalid
+		[[nodiscard]] nd_span<const Ty, MaxRank> flip( size_type t_dim ) const { return as_span( ).flip( t_dim ); }
+
 		/// \brief Creates a lower-dimensional view by fixing one dimension's index
 		/// \param t_dim Dimension to slice (0-based)
 		/// \param t_index Index value to fix for that dimension
@@ -1204,10 +3913,10 @@ namespace cppa
 			}
 
 			std::array<size_type, MaxRank> new_extents;
-			std::array<size_type, MaxRank> new_strides;
+			std::array<stride_type, MaxRank> new_strides;
 
-			size_type new_rank = m_rank - 1;
-			size_type offset   = t_index * m_strides[t_dim];
+			size_type new_rank       = m_rank - 1;
+			const stride_type offset = static_cast<stride_type>( t_index ) * m_strides[t_dim];
 
 			size_type j = 0;
 			for( size_t i = 0; i < m_rank; ++i )
@@ -1246,10 +3955,10 @@ namespace cppa
 			}
 
 			std::array<size_type, MaxRank> new_extents;
-			std::array<size_type, MaxRank> new_strides;
+			std::array<stride_type, MaxRank> new_strides;
 
-			size_type new_rank = m_rank - 1;
-			size_type offset   = t_index * m_strides[t_dim];
+			size_type new_rank       = m_rank - 1;
+			const stride_type offset = static_cast<stride_type>( t_index ) * m_strides[t_dim];
 
 			size_type j = 0;
 			for( size_t i = 0; i < m_rank; ++i )
@@ -1306,6 +4015,55 @@ namespace cppa
 			return reshape_impl( temp.data( ), sizeof...( t_new_extents ) );
 		}
 
+		/// \brief Changes the extents of the array itself, keeping the elements in row-major order
+		/// \param t_new_extents New shape extents, with the same total size
+		/// \throws std::invalid_argument if the rank exceeds MaxRank or the total size differs
+		/// \note Unlike reshape(), no view is returned; the array and its buffer are reused as they are
+		void reshape_inplace( std::initializer_list<size_type> t_new_extents ) { reshape_inplace_impl( t_new_extents.begin( ), t_new_extents.size( ) ); }
+
+		/// \brief Changes the extents of the array itself with variadic extents
+		/// \tparam Indices Variadic extent types
+		/// \param t_new_extents New shape extents, with the same total size
+		/// \throws std::invalid_argument if the total size differs
+		template<typename... Indices>
+		void reshape_inplace( Indices... t_new_extents )
+		{
+			static_assert( sizeof...( t_new_extents ) <= MaxRank, "Too many dimensions" );
+			std::array<size_type, sizeof...( t_new_extents )> temp = { static_cast<size_type>( t_new_extents )... };
+			reshape_inplace_impl( temp.data( ), sizeof...( t_new_extents ) );
+		}
+
+		/// \brief Changes the extents and the number of elements, reusing the buffer when capacity() allows
+		/// \param t_new_extents New shape extents
+		/// \throws std::invalid_argument if the rank exceeds MaxRank
+		/// \note As with std::vector::resize, the first elements in row-major order are kept and new ones are
+		///       value-initialized. Shrinking never releases memory, so a later resize back does not allocate.
+		/// \example
+		/// \code
+		/// nd_array<float> batch;
+		/// batch.reserve(max_batch * features);
+		/// for(auto rows: batch_sizes) {
+		///     batch.resize(rows, features); // no allocation in the loop
+		/// }
+		/// \endcode
+		void resize( std::initializer_list<size_type> t_new_extents ) { resize_impl( t_new_extents.begin( ), t_new_extents.size( ) ); }
+
+		/// \brief Changes the extents and the number of elements with variadic extents
+		/// \tparam Indices Variadic extent types
+		/// \param t_new_extents New shape extents
+		template<typename... Indices>
+		void resize( Indices... t_new_extents )
+		{
+			static_assert( sizeof...( t_new_extents ) <= MaxRank, "Too many dimensions" );
+			std::array<size_type, sizeof...( t_new_extents )> temp = { static_cast<size_type>( t_new_extents )... };
+			resize_impl( temp.data( ), sizeof...( t_new_extents ) );
+		}
+
+		/// \brief Makes room for at least t_count elements without changing the extents
+		/// \param t_count Number of elements later assignments and resize() calls may use without allocating
+		/// \note Existing elements are moved into the new buffer, so views of the array are invalidated if it grows
+		void reserve( size_type t_count ) { m_data.reserve( t_count ); }
+
 		/// \brief Returns a transposed view using an axis permutation
 		/// \param t_axes Permutation of axes
 		/// \return Transposed view
@@ -1319,7 +4077,7 @@ namespace cppa
 		/// \return Transposed const view
 		[[nodiscard]] nd_span<const Ty, MaxRank> transpose( std::initializer_list<size_type> t_axes ) const
 		{
-			return transpose_impl( t_axes.begin( ), t_axes.size( ), m_data.get( ) );
+			return transpose_impl( t_axes.begin( ), t_axes.size( ), static_cast<const_pointer>( m_data.get( ) ) );
 		}
 
 		/// \brief Returns a transposed view by swapping the last two axes
@@ -1337,7 +4095,35 @@ namespace cppa
 		{
 			size_type axes_rank = 0;
 			auto axes           = make_t_axes( axes_rank );
-			return transpose_impl( axes.data( ), axes_rank, m_data.get( ) );
+			return transpose_impl( axes.data( ), axes_rank, static_cast<const_pointer>( m_data.get( ) ) );
+		}
+
+		/// \brief Materializes T() into a new row-major array
+		/// \return Array holding the transposed elements contiguously
+		/// \note The copy is blocked into cache-sized tiles, so large matrices are read and written near memory bandwidth
+		/// \example
+		/// \code
+		/// nd_array<float> m(8192, 8192);
+		/// nd_array<float> mt = m.transpose_copy();  // mt(j, i) == m(i, j)
+		/// \endcode
+		[[nodiscard]] nd_array transpose_copy( ) const { return from_span_impl( T( ), m_data.allocator( ) ); }
+
+		/// \brief Materializes an axis permutation into a new row-major array
+		/// \param t_axes New order of axes, as for transpose()
+		/// \return Array holding the permuted elements contiguously
+		/// \throws std::invalid_argument if t_axes is not a valid permutation
+		[[nodiscard]] nd_array transpose_copy( std::initializer_list<size_type> t_axes ) const { return from_span_impl( transpose( t_axes ), m_data.allocator( ) ); }
+
+		/// \brief Transposes a square matrix in place
+		/// \throws std::invalid_argument unless the array is a square 2D matrix
+		/// \note Tiles on opposite sides of the diagonal are swapped pairwise; no memory is allocated
+		void transpose_inplace( )
+		{
+			if( m_rank != 2 || m_extents[0] != m_extents[1] )
+			{
+				throw std::invalid_argument( "In-place transpose requires a square matrix" );
+			}
+			detail::transpose_square_inplace( m_data.get( ), m_extents[0], m_strides[0], m_strides[1] );
 		}
 
 		/// \brief Flattens the array into a 1D view
@@ -1356,6 +4142,53 @@ namespace cppa
 		/// \return Const view with singleton dimensions removed
 		[[nodiscard]] nd_span<const Ty, MaxRank> squeeze( ) const { return squeeze_impl( m_data.get( ) ); }
 
+		/// \brief Inserts a dimension of extent 1
+		/// \param t_dim Position of the new dimension (0 .. rank())
+		/// \return View with rank increased by 1
+		/// \throws std::out_of_range if t_dim is greater than rank()
+		/// \throws std::invalid_argument if the rank would exceed MaxRank
+		[[nodiscard]] nd_span<Ty, MaxRank> expand_dims( size_type t_dim ) { return as_span( ).expand_dims( t_dim ); }
+
+		/// \brief Inserts a dimension of extent 1 (const)
+		/// \param t_dim Position of the new dimension (0 .. rank())
+		/// \return Const view with rank increased by 1
+		/// \throws std::out_of_range if t_dim is greater than rank()
+		/// \throws std::invalid_argument if the rank would exceed MaxRank
+		[[nodiscard]] nd_span<const Ty, MaxRank> expand_dims( size_type t_dim ) const { return as_span( ).expand_dims( t_dim ); }
+
+		/// \brief Creates a read-only view repeating the elements along new or singleton dimensions
+		/// \param t_extents Target extents, aligned with the array extents at the end
+		/// \return Const view with zero strides along broadcast dimensions
+		/// \throws std::invalid_argument if the target rank exceeds MaxRank or the shapes are incompatible
+		[[nodiscard]] nd_span<const Ty, MaxRank> broadcast_to( std::initializer_list<size_type> t_extents ) const { return as_span( ).broadcast_to( t_extents ); }
+
+		/// \brief Creates a read-only view repeating the elements along new or singleton dimensions
+		/// \tparam Indices Variadic extent types
+		/// \param t_extents Target extents, aligned with the array extents at the end
+		/// \return Const view with zero strides along broadcast dimensions
+		/// \throws std::invalid_argument if the target rank exceeds MaxRank or the shapes are incompatible
+		template<typename... Indices>
+		[[nodiscard]] nd_span<const Ty, MaxRank> broadcast_to( Indices... t_extents ) const
+		{
+			return as_span( ).broadcast_to( t_extents... );
+		}
+
+		/// \brief Creates a read-only view of every window of the given extents, the windows as extra dimensions
+		/// \param t_window Window extent for each dimension
+		/// \return Const view of rank 2 * rank(); see nd_span::sliding_window
+		/// \throws std::invalid_argument if the window rank differs, a window does not fit, or the rank would exceed MaxRank
+		[[nodiscard]] nd_span<const Ty, MaxRank> sliding_window( std::initializer_list<size_type> t_window ) const { return as_span( ).sliding_window( t_window ); }
+
+		/// \brief Creates a read-only view of the windows that start every t_step elements
+		/// \param t_window Window extent for each dimension
+		/// \param t_step Non-zero distance between window starts for each dimension
+		/// \return Const view of rank 2 * rank(); see nd_span::sliding_window
+		/// \throws std::invalid_argument if a list has the wrong rank, a window does not fit, a step is zero, or the rank would exceed MaxRank
+		[[nodiscard]] nd_span<const Ty, MaxRank> sliding_window( std::initializer_list<size_type> t_window, std::initializer_list<size_type> t_step ) const
+		{
+			return as_span( ).sliding_window( t_window, t_step );
+		}
+
 		/// \brief Gets the size of a specific dimension
 		/// \param t_dim Dimension index (0-based)
 		/// \return Size of the specified dimension
@@ -1371,9 +4204,9 @@ namespace cppa
 
 		/// \brief Gets the stride of a specific dimension
 		/// \param t_dim Dimension index (0-based)
-		/// \return Stride of the specified dimension
+		/// \return Stride of the specified dimension in elements
 		/// \throws std::out_of_range if dimension is >= rank
-		[[nodiscard]] size_type stride( size_type t_dim ) const
+		[[nodiscard]] stride_type stride( size_type t_dim ) const
 		{
 			if( t_dim >= m_rank )
 			{
@@ -1390,6 +4223,10 @@ namespace cppa
 		/// \return Total number of elements (product of all extents)
 		[[nodiscard]] size_type size( ) const noexcept { return m_size; }
 
+		/// \brief Gets the number of elements the buffer can hold without reallocating
+		/// \return Capacity in elements, at least size()
+		[[nodiscard]] size_type capacity( ) const noexcept { return m_data.capacity( ); }
+
 		/// \brief Gets the number of dimensions
 		/// \return Current rank (number of dimensions)
 		[[nodiscard]] size_type rank( ) const noexcept { return m_rank; }
@@ -1445,7 +4282,11 @@ namespace cppa
 		/// nd_array<double> arr(3, 4);
 		/// arr.fill(0.0);  // Set all elements to zero
 		/// \endcode
-		void fill( const Ty& t_value ) { std::fill( m_data.get( ), m_data.get( ) + m_size, t_value ); }
+		void fill( const Ty& t_value )
+		{
+			ND_ARRAY_TRACE_SCOPE( "fill" );
+			detail::simd_dispatch( [&] { std::fill( m_data.get( ), m_data.get( ) + m_size, t_value ); } );
+		}
 
 		/// \brief Applies a function to each element
 		/// \tparam Func Function type (typically a lambda or function object)
@@ -1459,27 +4300,169 @@ namespace cppa
 		template<typename Func>
 		void apply( Func&& t_func )
 		{
-			for( size_t i = 0; i < m_size; ++i )
-			{
-				m_data[i] = t_func( m_data[i] );
-			}
+			ND_ARRAY_TRACE_SCOPE( "apply" );
+			detail::simd_dispatch(
+			    [&]
+			    {
+				    for( size_t i = 0; i < m_size; ++i )
+				    {
+					    m_data[i] = t_func( m_data[i] );
+				    }
+			    } );
+		}
+
+		/// \brief Fills all elements with a value using an execution policy
+		/// \param t_policy seq, par or parallel_policy{ thread_count }
+		/// \param t_value Value to fill the array with
+		/// \example
+		/// \code
+		/// nd_array<float> volume(cppa::uninitialized, 512, 512, 512);
+		/// volume.fill(cppa::par, 1.0f);  // One block of the outermost dimension per hardware thread
+		/// \endcode
+		template<typename Policy, std::enable_if_t<is_execution_policy_v<Policy>, int> = 0>
+		void fill( const Policy& t_policy, const Ty& t_value )
+		{
+			as_span( ).fill( t_policy, t_value );
+		}
+
+		/// \brief Applies a function to each element using an execution policy
+		/// \param t_policy seq, par or parallel_policy{ thread_count }
+		/// \param t_func Function that takes a Ty and returns a Ty; must be safe to call concurrently for par
+		template<typename Policy, typename Func, std::enable_if_t<is_execution_policy_v<Policy>, int> = 0>
+		void apply( const Policy& t_policy, Func&& t_func )
+		{
+			as_span( ).apply( t_policy, std::forward<Func>( t_func ) );
+		}
+
+		/// \brief Calls t_func( element ) for every element in memory order
+		/// \param t_func Function taking a reference to an element
+		/// \note The storage is row-major and contiguous, so this is a single linear sweep
+		template<typename Func>
+		void for_each_in_memory_order( Func&& t_func )
+		{
+			as_span( ).for_each_in_memory_order( std::forward<Func>( t_func ) );
+		}
+
+		/// \brief Calls t_func( element ) for every element in memory order (const)
+		/// \param t_func Function taking a const reference to an element
+		template<typename Func>
+		void for_each_in_memory_order( Func&& t_func ) const
+		{
+			as_span( ).for_each_in_memory_order( std::forward<Func>( t_func ) );
+		}
+
+		/// \brief Calls t_func( element ) for every element in memory order using an execution policy
+		/// \param t_policy seq, par or parallel_policy{ thread_count }
+		/// \param t_func Function taking a reference to an element; must be safe to call concurrently for par
+		template<typename Policy, typename Func, std::enable_if_t<is_execution_policy_v<Policy>, int> = 0>
+		void for_each_in_memory_order( const Policy& t_policy, Func&& t_func )
+		{
+			as_span( ).for_each_in_memory_order( t_policy, std::forward<Func>( t_func ) );
+		}
+
+		/// \brief Writes t_func( x ) for every element x of t_src into the corresponding element
+		/// \param t_src Source view with the same extents
+		/// \param t_func Function taking a source element
+		/// \throws std::invalid_argument if the extents differ
+		template<typename OtherTy, typename Func>
+		void transform( const nd_span<OtherTy, MaxRank>& t_src, Func&& t_func )
+		{
+			as_span( ).transform( t_src, std::forward<Func>( t_func ) );
+		}
+
+		/// \brief Writes t_func( x ) for every element x of t_src into the corresponding element using an execution policy
+		/// \param t_policy seq, par or parallel_policy{ thread_count }
+		/// \param t_src Source view with the same extents
+		/// \param t_func Function taking a source element
+		/// \throws std::invalid_argument if the extents differ
+		template<typename Policy, typename OtherTy, typename Func, std::enable_if_t<is_execution_policy_v<Policy>, int> = 0>
+		void transform( const Policy& t_policy, const nd_span<OtherTy, MaxRank>& t_src, Func&& t_func )
+		{
+			as_span( ).transform( t_policy, t_src, std::forward<Func>( t_func ) );
+		}
+
+		/// \brief Copies the elements of t_src into this array without reallocating
+		/// \param t_src Source view with the same extents
+		/// \throws std::invalid_argument if the extents differ
+		template<typename OtherTy>
+		void copy_from( const nd_span<OtherTy, MaxRank>& t_src )
+		{
+			as_span( ).copy_from( t_src );
+		}
+
+		/// \brief Copies the elements of t_src into this array without reallocating using an execution policy
+		/// \param t_policy seq, par or parallel_policy{ thread_count }
+		/// \param t_src Source view with the same extents
+		/// \throws std::invalid_argument if the extents differ
+		template<typename Policy, typename OtherTy, std::enable_if_t<is_execution_policy_v<Policy>, int> = 0>
+		void copy_from( const Policy& t_policy, const nd_span<OtherTy, MaxRank>& t_src )
+		{
+			as_span( ).copy_from( t_policy, t_src );
+		}
+
+		/// \brief Folds all elements into t_init with t_reduce
+		/// \param t_init Initial value
+		/// \param t_reduce Binary operation
+		/// \return Result of the reduction (t_init for an empty array)
+		template<typename Init, typename Reduce>
+		[[nodiscard]] Init reduce( Init t_init, Reduce t_reduce ) const
+		{
+			return as_span( ).reduce( std::move( t_init ), t_reduce );
+		}
+
+		/// \brief Folds all elements into t_init with t_reduce using an execution policy
+		/// \param t_policy seq, par or parallel_policy{ thread_count }
+		/// \param t_init Initial value
+		/// \param t_reduce Associative binary operation (the parallel grouping of operands is unspecified)
+		/// \return Result of the reduction (t_init for an empty array)
+		/// \example
+		/// \code
+		/// const double total = arr.reduce(cppa::par, 0.0, std::plus<>());
+		/// \endcode
+		template<typename Policy, typename Init, typename Reduce, std::enable_if_t<is_execution_policy_v<Policy>, int> = 0>
+		[[nodiscard]] Init reduce( const Policy& t_policy, Init t_init, Reduce t_reduce ) const
+		{
+			return as_span( ).reduce( t_policy, std::move( t_init ), t_reduce );
+		}
+
+		/// \brief Folds t_transform( x ) for all elements x into t_init with t_reduce
+		/// \param t_init Initial value
+		/// \param t_reduce Binary operation
+		/// \param t_transform Function applied to each element before reduction
+		/// \return Result of the reduction (t_init for an empty array)
+		template<typename Init, typename Reduce, typename Transform, std::enable_if_t<!is_execution_policy_v<Init>, int> = 0>
+		[[nodiscard]] Init transform_reduce( Init t_init, Reduce t_reduce, Transform t_transform ) const
+		{
+			return as_span( ).transform_reduce( std::move( t_init ), t_reduce, t_transform );
+		}
+
+		/// \brief Folds t_transform( x ) for all elements x into t_init with t_reduce using an execution policy
+		/// \param t_policy seq, par or parallel_policy{ thread_count }
+		/// \param t_init Initial value
+		/// \param t_reduce Associative binary operation (the parallel grouping of operands is unspecified)
+		/// \param t_transform Function applied to each element before reduction
+		/// \return Result of the reduction (t_init for an empty array)
+		template<typename Policy, typename Init, typename Reduce, typename Transform, std::enable_if_t<is_execution_policy_v<Policy>, int> = 0>
+		[[nodiscard]] Init transform_reduce( const Policy& t_policy, Init t_init, Reduce t_reduce, Transform t_transform ) const
+		{
+			return as_span( ).transform_reduce( t_policy, std::move( t_init ), t_reduce, t_transform );
 		}
 
 	private:
 		/// \brief Internal owned data storage
-		std::unique_ptr<Ty[]> m_data;             // NOLINT(modernize-avoid-c-arrays)
+		detail::array_storage<Ty, Allocator, InlineCapacity> m_data;
 		std::array<size_type, MaxRank> m_extents; ///< Size of each dimension
-		std::array<size_type, MaxRank> m_strides; ///< Stride for each dimension
+		std::array<stride_type, MaxRank> m_strides; ///< Stride for each dimension
 		size_type m_size;                         ///< Total number of elements
 		size_type m_rank;                         ///< Actual number of dimensions
 
 		/// \brief Helper function to create an nd_array from an nd_span
 		template<typename U>
-		static nd_array from_span_impl( const nd_span<U, MaxRank>& t_span )
+		static nd_array from_span_impl( const nd_span<U, MaxRank>& t_span, const Allocator& t_alloc = Allocator( ) )
 		{
 			static_assert( std::is_convertible_v<U, Ty>, "Span element type must be convertible" );
 
-			nd_array result;
+			nd_array result( t_alloc );
 			if( t_span.rank( ) > MaxRank )
 			{
 				throw std::invalid_argument( "Rank exceeds MaxRank" );
@@ -1498,13 +4481,11 @@ namespace cppa
 			result.m_size = detail::compute_size<MaxRank>( result.m_extents, result.m_rank );
 			if( result.m_size > 0 )
 			{
-				result.m_data    = std::make_unique<Ty[]>( result.m_size ); // NOLINT(modernize-avoid-c-arrays)
-				size_type offset = 0;
-				for( const auto& value: t_span )
-				{
-					result.m_data[offset++] = static_cast<Ty>( value );
-				}
+				result.m_data.allocate_for_overwrite( result.m_size );
+				result.as_span( ).copy_from( t_span );
 			}
+			ND_ARRAY_COUNT( deep_copies, 1 );
+			ND_ARRAY_COUNT( copied_bytes, result.m_size * sizeof( Ty ) );
 
 			return result;
 		}
@@ -1512,6 +4493,45 @@ namespace cppa
 		/// \brief Computes row-major strides from extents
 		constexpr void compute_strides( ) noexcept { detail::stride_computer<MaxRank>::compute( m_strides, m_extents, m_rank ); }
 
+		/// \brief Sets extents, strides and size from variadic dimension sizes (m_rank must already be set)
+		template<typename... Indices>
+		void init_extents( Indices... t_indices ) noexcept
+		{
+			static_assert( sizeof...( t_indices ) <= MaxRank, "Too many dimensions" );
+
+			std::array<size_type, sizeof...( t_indices )> temp = { static_cast<size_type>( t_indices )... };
+			for( size_t i = 0; i < m_rank; ++i )
+			{
+				m_extents[i] = temp[i];
+			}
+			for( size_t i = m_rank; i < MaxRank; ++i )
+			{
+				m_extents[i] = 0;
+			}
+
+			compute_strides( );
+			m_size = compute_size( );
+		}
+
+		/// \brief Sets rank, extents, strides and size from the shape of an expression
+		template<typename Expr>
+		void init_extents_from( const Expr& t_expr )
+		{
+			if( t_expr.rank( ) > MaxRank )
+			{
+				throw std::invalid_argument( "Rank exceeds MaxRank" );
+			}
+
+			m_rank = t_expr.rank( );
+			m_extents.fill( 0 );
+			for( size_type i = 0; i < m_rank; ++i )
+			{
+				m_extents[i] = t_expr.extent( i );
+			}
+			compute_strides( );
+			m_size = compute_size( );
+		}
+
 		/// \brief Computes total number of elements from extents
 		/// \return Product of all dimension sizes
 		[[nodiscard]] constexpr size_type compute_size( ) const noexcept
@@ -1526,6 +4546,42 @@ namespace cppa
 			return s;
 		}
 
+		/// \brief Sets rank, extents, strides and size from a shape that has already been validated
+		void assign_shape( const size_type* t_new_extents, size_type t_new_rank ) noexcept
+		{
+			m_rank = t_new_rank;
+			m_extents.fill( 0 );
+			for( size_type i = 0; i < m_rank; ++i )
+			{
+				m_extents[i] = t_new_extents[i];
+			}
+			compute_strides( );
+			m_size = compute_size( );
+		}
+
+		void reshape_inplace_impl( const size_type* t_new_extents, size_type t_new_rank )
+		{
+			// Validates the shape against the current size
+			static_cast<void>( reshape_impl( t_new_extents, t_new_rank ) );
+			assign_shape( t_new_extents, t_new_rank );
+		}
+
+		void resize_impl( const size_type* t_new_extents, size_type t_new_rank )
+		{
+			if( t_new_rank > MaxRank )
+			{
+				throw std::invalid_argument( "Rank exceeds MaxRank" );
+			}
+
+			size_type new_size = t_new_rank > 0 ? 1 : 0;
+			for( size_type i = 0; i < t_new_rank; ++i )
+			{
+				new_size *= t_new_extents[i];
+			}
+			m_data.resize( new_size );
+			assign_shape( t_new_extents, t_new_rank );
+		}
+
 		[[nodiscard]] nd_span<Ty, MaxRank> reshape_impl( const size_type* t_new_extents, size_type t_new_rank )
 		{
 			if( t_new_rank > MaxRank )
@@ -1545,7 +4601,7 @@ namespace cppa
 				throw std::invalid_argument( "Reshape size mismatch" );
 			}
 
-			std::array<size_type, MaxRank> new_strides { };
+			std::array<stride_type, MaxRank> new_strides { };
 			detail::stride_computer<MaxRank>::compute( new_strides, new_extents_array, t_new_rank );
 			return nd_span<Ty, MaxRank>( m_data.get( ), new_extents_array, new_strides, t_new_rank );
 		}
@@ -1569,7 +4625,7 @@ namespace cppa
 				throw std::invalid_argument( "Reshape size mismatch" );
 			}
 
-			std::array<size_type, MaxRank> new_strides { };
+			std::array<stride_type, MaxRank> new_strides { };
 			detail::stride_computer<MaxRank>::compute( new_strides, new_extents_array, t_new_rank );
 			return nd_span<const Ty, MaxRank>( m_data.get( ), new_extents_array, new_strides, t_new_rank );
 		}
@@ -1584,7 +4640,7 @@ namespace cppa
 			detail::validate_permutation<MaxRank>( t_axes, t_axes_rank );
 
 			std::array<size_type, MaxRank> new_extents;
-			std::array<size_type, MaxRank> new_strides;
+			std::array<stride_type, MaxRank> new_strides;
 
 			for( size_t i = 0; i < m_rank; ++i )
 			{
@@ -1620,7 +4676,7 @@ namespace cppa
 		[[nodiscard]] auto squeeze_impl( PointerType t_data_ptr ) const
 		{
 			std::array<size_type, MaxRank> new_extents;
-			std::array<size_type, MaxRank> new_strides;
+			std::array<stride_type, MaxRank> new_strides;
 			size_type new_rank = 0;
 
 			for( size_t i = 0; i < m_rank; ++i )
@@ -1644,4 +4700,72 @@ namespace cppa
 		}
 	};
 
+	/// \brief nd_array whose buffer starts on an Alignment-byte boundary
+	/// \tparam Ty Element type
+	/// \tparam Alignment Alignment in bytes (default: 64)
+	/// \tparam MaxRank Maximum number of dimensions (default: 8)
+	template<typename Ty, size_t Alignment = 64, size_t MaxRank = 8>
+	using aligned_nd_array = nd_array<Ty, MaxRank, aligned_allocator<Ty, Alignment>>;
+
+	/// \brief nd_array that stores up to InlineCapacity elements inside the object
+	/// \tparam Ty Element type
+	/// \tparam InlineCapacity Largest element count kept inline; bigger arrays use the heap
+	/// \tparam MaxRank Maximum number of dimensions (default: 8)
+	/// \example
+	/// \code
+	/// small_nd_array<float, 16> transform(4, 4); // no allocation
+	/// small_nd_array<float, 16> image(64, 64);   // falls back to the heap
+	/// \endcode
+	template<typename Ty, size_t InlineCapacity, size_t MaxRank = 8>
+	using small_nd_array = nd_array<Ty, MaxRank, std::allocator<Ty>, InlineCapacity>;
+
+	namespace detail
+	{
+		/// \brief True if Ty is an nd_span or nd_array
+		template<typename Ty>
+		struct is_nd_container : std::false_type
+		{
+		};
+
+		template<typename Ty, size_t MaxRank, typename Layout>
+		struct is_nd_container<nd_span<Ty, MaxRank, Layout>> : std::true_type
+		{
+		};
+
+		template<typename Ty, size_t MaxRank, typename Allocator, size_t InlineCapacity>
+		struct is_nd_container<nd_array<Ty, MaxRank, Allocator, InlineCapacity>> : std::true_type
+		{
+		};
+
+		/// \brief Converts any view to a read-only strided view; element positions, not memory order, pair up operands
+		template<typename Ty, size_t MaxRank, typename Layout>
+		[[nodiscard]] nd_span<const Ty, MaxRank> as_const_span( const nd_span<Ty, MaxRank, Layout>& t_span )
+		{
+			std::array<size_t, MaxRank> extents { };
+			std::array<std::ptrdiff_t, MaxRank> strides { };
+			for( size_t i = 0; i < t_span.rank( ); ++i )
+			{
+				extents[i] = t_span.extent( i );
+				strides[i] = t_span.stride( i );
+			}
+			return nd_span<const Ty, MaxRank>( t_span.data( ), extents, strides, t_span.rank( ) );
+		}
+	} // namespace detail
+
+#if __has_include( <memory_resource> )
+	/// \namespace cppa::pmr
+	/// \brief Aliases using polymorphic allocators backed by a std::pmr::memory_resource
+	namespace pmr
+	{
+		/// \brief nd_array allocating from a std::pmr::memory_resource
+		/// \example
+		/// \code
+		/// std::pmr::monotonic_buffer_resource arena(1 << 20);
+		/// cppa::pmr::nd_array<float> tmp({64, 64}, &arena); // reset the arena per frame
+		/// \endcode
+		template<typename Ty, size_t MaxRank = 8>
+		using nd_array = cppa::nd_array<Ty, MaxRank, std::pmr::polymorphic_allocator<Ty>>;
+	} // namespace pmr
+#endif
+
 } // namespace cppa
\ No newline at end of file
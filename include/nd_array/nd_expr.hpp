@@ -0,0 +1,751 @@
+#pragma once
+
+#include "nd_array.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+
+/// \file nd_expr.hpp
+/// \brief Lazy element-wise arithmetic on nd_span and nd_array
+///
+/// Arithmetic, comparison and math operators applied to nd_span / nd_array operands build a
+/// lightweight expression tree instead of computing a result. The tree is evaluated in a single
+/// pass when it is assigned to an nd_array (or to an nd_span via nd_span::assign), so
+/// `c = a * b + d` reads every operand once and allocates no temporaries. When the destination and
+/// all operands are contiguous, evaluation is a plain indexed loop the compiler can vectorize.
+///
+/// Array operands broadcast like NumPy arrays: shapes are aligned at the end and dimensions of
+/// extent 1 (or missing leading dimensions) are stretched through zero-stride views, so adding a
+/// bias vector to every row of a matrix reads the vector in place.
+///
+/// \code
+/// nd_array<double> a(256, 256), b(256, 256), c(256, 256);
+/// c = a * b + 1.0;          // Fused, no temporaries
+/// c = cppa::sqrt(c) - a;    // Operands may alias the destination
+/// c = a + bias;             // bias of extent 256 is added to every row
+/// \endcode
+///
+/// \note Expressions keep views of their operands. Do not build one from a temporary
+///       nd_array and evaluate it after that temporary has been destroyed.
+
+namespace cppa
+{
+	template<typename Ty, size_t MaxRank>
+	class view_expr;
+
+	template<typename Ty>
+	class scalar_expr;
+
+	namespace detail
+	{
+		/// \brief True if Ty can take part in an expression as an array operand
+		template<typename Ty>
+		inline constexpr bool is_array_operand_v = is_nd_container<Ty>::value || is_expression_v<Ty>;
+
+		/// \brief True if Ty is broadcast to every element as a scalar operand
+		template<typename Ty>
+		inline constexpr bool is_scalar_operand_v = std::is_arithmetic_v<Ty>;
+
+		/// \brief True if an operator may combine Lhs and Rhs into an expression (at least one array operand)
+		template<typename Lhs, typename Rhs>
+		inline constexpr bool is_binary_operands_v = ( is_array_operand_v<Lhs> && ( is_array_operand_v<Rhs> || is_scalar_operand_v<Rhs> ) ) ||
+		                                             ( is_scalar_operand_v<Lhs> && is_array_operand_v<Rhs> );
+
+		template<typename Ty, size_t MaxRank, typename Layout>
+		[[nodiscard]] view_expr<const Ty, MaxRank> make_operand( const nd_span<Ty, MaxRank, Layout>& t_span )
+		{
+			return view_expr<const Ty, MaxRank>( as_const_span( t_span ) );
+		}
+
+		template<typename Ty, size_t MaxRank, typename Allocator, size_t InlineCapacity>
+		[[nodiscard]] view_expr<const Ty, MaxRank> make_operand( const nd_array<Ty, MaxRank, Allocator, InlineCapacity>& t_array ) noexcept
+		{
+			return view_expr<const Ty, MaxRank>( t_array.as_span( ) );
+		}
+
+		template<typename Expr, std::enable_if_t<is_expression_v<Expr>, int> = 0>
+		[[nodiscard]] const Expr& make_operand( const Expr& t_expr ) noexcept
+		{
+			return t_expr;
+		}
+
+		template<typename Ty, std::enable_if_t<is_scalar_operand_v<Ty>, int> = 0>
+		[[nodiscard]] scalar_expr<Ty> make_operand( Ty t_value ) noexcept
+		{
+			return scalar_expr<Ty>( t_value );
+		}
+
+		/// \brief Expression node type an operand of type Ty is stored as
+		template<typename Ty>
+		using operand_t = std::decay_t<decltype( make_operand( std::declval<const Ty&>( ) ) )>;
+
+		template<typename Ty, size_t MaxRank, typename Layout>
+		[[nodiscard]] nd_span<Ty, MaxRank> as_target( nd_span<Ty, MaxRank, Layout>& t_span ) noexcept
+		{
+			return nd_span<Ty, MaxRank>( t_span );
+		}
+
+		template<typename Ty, size_t MaxRank, typename Allocator, size_t InlineCapacity>
+		[[nodiscard]] nd_span<Ty, MaxRank> as_target( nd_array<Ty, MaxRank, Allocator, InlineCapacity>& t_array ) noexcept
+		{
+			return t_array.as_span( );
+		}
+
+		/// \brief Byte range [first, last) touched by a span, used to detect aliasing
+		template<typename Span>
+		[[nodiscard]] std::pair<std::uintptr_t, std::uintptr_t> memory_range( const Span& t_span )
+		{
+			std::ptrdiff_t first_offset = 0;
+			std::ptrdiff_t last_offset  = 0;
+			for( size_t i = 0; i < t_span.rank( ); ++i )
+			{
+				const std::ptrdiff_t span = static_cast<std::ptrdiff_t>( t_span.extent( i ) - 1 ) * t_span.stride( i );
+				( span < 0 ? first_offset : last_offset ) += span;
+			}
+			return { reinterpret_cast<std::uintptr_t>( t_span.data( ) + first_offset ), reinterpret_cast<std::uintptr_t>( t_span.data( ) + last_offset + 1 ) };
+		}
+
+		/// \brief Extent of an operand along dimension t_dim of a shape of rank t_rank aligned at the end
+		template<typename Expr>
+		[[nodiscard]] size_t aligned_extent( const Expr& t_expr, size_t t_rank, size_t t_dim )
+		{
+			const size_t lead = t_rank - t_expr.rank( );
+			return t_dim < lead ? 1 : t_expr.extent( t_dim - lead );
+		}
+
+		/// \brief Checks whether two operands have the same rank and extents
+		template<typename Lhs, typename Rhs>
+		[[nodiscard]] bool same_shape( const Lhs& t_lhs, const Rhs& t_rhs )
+		{
+			bool same_extents = t_lhs.rank( ) == t_rhs.rank( );
+			for( size_t i = 0; same_extents && i < t_lhs.rank( ); ++i )
+			{
+				same_extents = t_lhs.extent( i ) == t_rhs.extent( i );
+			}
+			return same_extents;
+		}
+
+		struct abs_fn
+		{
+			template<typename Ty>
+			auto operator( )( Ty t_value ) const
+			{
+				return std::abs( t_value );
+			}
+		};
+
+		struct sqrt_fn
+		{
+			template<typename Ty>
+			auto operator( )( Ty t_value ) const
+			{
+				return std::sqrt( t_value );
+			}
+		};
+
+		struct exp_fn
+		{
+			template<typename Ty>
+			auto operator( )( Ty t_value ) const
+			{
+				return std::exp( t_value );
+			}
+		};
+
+		struct log_fn
+		{
+			template<typename Ty>
+			auto operator( )( Ty t_value ) const
+			{
+				return std::log( t_value );
+			}
+		};
+
+		struct sin_fn
+		{
+			template<typename Ty>
+			auto operator( )( Ty t_value ) const
+			{
+				return std::sin( t_value );
+			}
+		};
+
+		struct cos_fn
+		{
+			template<typename Ty>
+			auto operator( )( Ty t_value ) const
+			{
+				return std::cos( t_value );
+			}
+		};
+
+		struct tanh_fn
+		{
+			template<typename Ty>
+			auto operator( )( Ty t_value ) const
+			{
+				return std::tanh( t_value );
+			}
+		};
+
+		struct pow_fn
+		{
+			template<typename Base, typename Exponent>
+			auto operator( )( Base t_base, Exponent t_exponent ) const
+			{
+				return std::pow( t_base, t_exponent );
+			}
+		};
+	} // namespace detail
+
+	/// \class view_expr
+	/// \brief Expression leaf reading the elements of an nd_span
+	/// \tparam Ty Element type (const-qualified)
+	/// \tparam MaxRank Maximum number of dimensions of the viewed span
+	///
+	/// All expression nodes share the same evaluation interface: rank()/extent() describe the
+	/// shape, flat() reads element i of a contiguous operand, seek_row()/row_at() walk the
+	/// innermost dimension of a strided one, broadcast() stretches the operands to a larger shape
+	/// and aliases() reports overlap with a destination.
+	template<typename Ty, size_t MaxRank>
+	class view_expr : public detail::expression_tag
+	{
+	public:
+		using value_type = std::remove_cv_t<Ty>; ///< Type of the elements produced
+		using size_type  = size_t;               ///< Type for sizes and indices
+
+		static constexpr bool is_scalar     = false;   ///< Whether the node broadcasts a single value
+		static constexpr size_type max_rank = MaxRank; ///< Highest rank the node can take
+
+		/// \brief Constructs a leaf over the elements of t_span
+		/// \param t_span Span whose elements are read
+		explicit view_expr( const nd_span<Ty, MaxRank>& t_span ) noexcept : m_span( t_span ) { reset( ); }
+
+		/// \brief Gets the number of dimensions
+		[[nodiscard]] size_type rank( ) const noexcept { return m_span.rank( ); }
+
+		/// \brief Gets the size of a dimension
+		/// \param t_dim Dimension index
+		[[nodiscard]] size_type extent( size_type t_dim ) const { return m_span.extent( t_dim ); }
+
+		/// \brief Checks whether flat() may be used
+		[[nodiscard]] bool is_contiguous( ) const noexcept { return m_contiguous; }
+
+		/// \brief Reads element t_index of a contiguous operand
+		[[nodiscard]] value_type flat( size_type t_index ) const noexcept { return m_span.data( )[t_index]; }
+
+		/// \brief Positions the row cursor at the given indices of all but the last dimension
+		/// \param t_index Indices of dimensions 0 .. rank()-2
+		void seek_row( const size_type* t_index ) noexcept
+		{
+			std::ptrdiff_t offset = 0;
+			for( size_type i = 0; i + 1 < m_span.rank( ); ++i )
+			{
+				offset += static_cast<std::ptrdiff_t>( t_index[i] ) * m_span.stride( i );
+			}
+			m_row = m_span.data( ) + offset;
+		}
+
+		/// \brief Reads element t_index of the current row
+		[[nodiscard]] value_type row_at( size_type t_index ) const noexcept { return m_row[static_cast<std::ptrdiff_t>( t_index ) * m_inner_stride]; }
+
+		/// \brief Replaces the viewed span by a zero-stride view with the given extents
+		/// \param t_extents Target extents, aligned with the operand extents at the end
+		/// \param t_rank Number of target dimensions
+		/// \throws std::invalid_argument if the operand cannot be broadcast to the target
+		void broadcast( const size_type* t_extents, size_type t_rank )
+		{
+			std::array<size_type, MaxRank> extents { };
+			std::array<std::ptrdiff_t, MaxRank> strides { };
+			for( size_type i = 0; i < m_span.rank( ); ++i )
+			{
+				extents[i] = m_span.extent( i );
+				strides[i] = m_span.stride( i );
+			}
+			std::array<std::ptrdiff_t, MaxRank> new_strides;
+			if( !detail::broadcast_strides<MaxRank>( extents, strides, m_span.rank( ), t_extents, t_rank, new_strides ) )
+			{
+				throw std::invalid_argument( "Expression shape mismatch" );
+			}
+			std::copy( t_extents, t_extents + t_rank, extents.begin( ) );
+			m_span = nd_span<Ty, MaxRank>( m_span.data( ), extents, new_strides, t_rank );
+			reset( );
+		}
+
+		/// \brief Checks whether evaluating into t_dst could overwrite elements before they are read
+		/// \param t_dst Destination span
+		/// \return False if the memory is disjoint or the destination has the identical layout
+		template<typename Span>
+		[[nodiscard]] bool aliases( const Span& t_dst ) const
+		{
+			if( m_span.size( ) == 0 || t_dst.size( ) == 0 )
+			{
+				return false;
+			}
+			const auto src = detail::memory_range( m_span );
+			const auto dst = detail::memory_range( t_dst );
+			if( src.second <= dst.first || dst.second <= src.first )
+			{
+				return false;
+			}
+			if( static_cast<const void*>( m_span.data( ) ) != static_cast<const void*>( t_dst.data( ) ) ||
+			    sizeof( value_type ) != sizeof( typename Span::value_type ) || m_span.rank( ) != t_dst.rank( ) )
+			{
+				return true;
+			}
+			for( size_type i = 0; i < m_span.rank( ); ++i )
+			{
+				if( m_span.stride( i ) != t_dst.stride( i ) )
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+	private:
+		/// \brief Recomputes the cached row cursor and layout properties of m_span
+		void reset( ) noexcept
+		{
+			const size_type rank = m_span.rank( );
+			m_row                = m_span.data( );
+			m_inner_stride       = rank > 0 ? m_span.stride( rank - 1 ) : 1;
+			m_contiguous         = m_span.is_contiguous( );
+		}
+
+		nd_span<Ty, MaxRank> m_span;   ///< Viewed operand
+		Ty* m_row;                     ///< Start of the current row
+		std::ptrdiff_t m_inner_stride; ///< Stride of the last dimension
+		bool m_contiguous;             ///< Cached is_contiguous() of the operand
+	};
+
+	/// \class scalar_expr
+	/// \brief Expression leaf broadcasting a single value to every element
+	/// \tparam Ty Scalar type
+	template<typename Ty>
+	class scalar_expr : public detail::expression_tag
+	{
+	public:
+		using value_type = Ty;     ///< Type of the elements produced
+		using size_type  = size_t; ///< Type for sizes and indices
+
+		static constexpr bool is_scalar     = true; ///< Whether the node broadcasts a single value
+		static constexpr size_type max_rank = 0;    ///< Highest rank the node can take
+
+		/// \brief Constructs a leaf producing t_value
+		explicit constexpr scalar_expr( Ty t_value ) noexcept : m_value( t_value ) {}
+
+		[[nodiscard]] constexpr size_type rank( ) const noexcept { return 0; }
+		[[nodiscard]] constexpr size_type extent( size_type /*t_dim*/ ) const noexcept { return 1; }
+		[[nodiscard]] constexpr bool is_contiguous( ) const noexcept { return true; }
+		[[nodiscard]] constexpr value_type flat( size_type /*t_index*/ ) const noexcept { return m_value; }
+		constexpr void seek_row( const size_type* /*t_index*/ ) noexcept {}
+		[[nodiscard]] constexpr value_type row_at( size_type /*t_index*/ ) const noexcept { return m_value; }
+		constexpr void broadcast( const size_type* /*t_extents*/, size_type /*t_rank*/ ) noexcept {}
+
+		template<typename Span>
+		[[nodiscard]] constexpr bool aliases( const Span& /*t_dst*/ ) const noexcept
+		{
+			return false;
+		}
+
+	private:
+		Ty m_value; ///< Broadcast value
+	};
+
+	/// \class unary_expr
+	/// \brief Expression node applying a function to every element of its operand
+	/// \tparam Op Function object type
+	/// \tparam Expr Operand node type
+	template<typename Op, typename Expr>
+	class unary_expr : public detail::expression_tag
+	{
+	public:
+		using value_type = std::decay_t<std::invoke_result_t<const Op&, typename Expr::value_type>>; ///< Type of the elements produced
+		using size_type  = size_t;                                                                   ///< Type for sizes and indices
+
+		static constexpr bool is_scalar     = Expr::is_scalar; ///< Whether the node broadcasts a single value
+		static constexpr size_type max_rank = Expr::max_rank;  ///< Highest rank the node can take
+
+		/// \brief Constructs a node applying t_op to t_expr
+		unary_expr( Op t_op, Expr t_expr ) : m_op( std::move( t_op ) ), m_expr( std::move( t_expr ) ) {}
+
+		[[nodiscard]] size_type rank( ) const noexcept { return m_expr.rank( ); }
+		[[nodiscard]] size_type extent( size_type t_dim ) const { return m_expr.extent( t_dim ); }
+		[[nodiscard]] bool is_contiguous( ) const noexcept { return m_expr.is_contiguous( ); }
+		[[nodiscard]] value_type flat( size_type t_index ) const { return m_op( m_expr.flat( t_index ) ); }
+		void seek_row( const size_type* t_index ) noexcept { m_expr.seek_row( t_index ); }
+		[[nodiscard]] value_type row_at( size_type t_index ) const { return m_op( m_expr.row_at( t_index ) ); }
+		void broadcast( const size_type* t_extents, size_type t_rank ) { m_expr.broadcast( t_extents, t_rank ); }
+
+		template<typename Span>
+		[[nodiscard]] bool aliases( const Span& t_dst ) const
+		{
+			return m_expr.aliases( t_dst );
+		}
+
+	private:
+		Op m_op;     ///< Applied function
+		Expr m_expr; ///< Operand
+	};
+
+	/// \class binary_expr
+	/// \brief Expression node combining two operands element by element
+	/// \tparam Op Function object type
+	/// \tparam Lhs Left operand node type
+	/// \tparam Rhs Right operand node type
+	///
+	/// Scalar operands are broadcast; array operands must have broadcast-compatible extents (aligned at
+	/// the end, each dimension equal or 1) and are stretched to the common shape on construction.
+	template<typename Op, typename Lhs, typename Rhs>
+	class binary_expr : public detail::expression_tag
+	{
+	public:
+		using value_type = std::decay_t<std::invoke_result_t<const Op&, typename Lhs::value_type, typename Rhs::value_type>>; ///< Type of the elements produced
+		using size_type  = size_t; ///< Type for sizes and indices
+
+		static constexpr bool is_scalar     = Lhs::is_scalar && Rhs::is_scalar;                              ///< Whether the node broadcasts a single value
+		static constexpr size_type max_rank = Lhs::max_rank > Rhs::max_rank ? Lhs::max_rank : Rhs::max_rank; ///< Highest rank the node can take
+
+		/// \brief Constructs a node applying t_op to t_lhs and t_rhs
+		/// \throws std::invalid_argument if both operands are arrays whose extents cannot be broadcast together
+		binary_expr( Op t_op, Lhs t_lhs, Rhs t_rhs ) : m_op( std::move( t_op ) ), m_lhs( std::move( t_lhs ) ), m_rhs( std::move( t_rhs ) )
+		{
+			if constexpr( !Lhs::is_scalar && !Rhs::is_scalar )
+			{
+				if( detail::same_shape( m_lhs, m_rhs ) )
+				{
+					return;
+				}
+
+				const size_type rank = m_lhs.rank( ) > m_rhs.rank( ) ? m_lhs.rank( ) : m_rhs.rank( );
+				std::array<size_type, max_rank> extents { };
+				for( size_type i = 0; i < rank; ++i )
+				{
+					const size_type lhs = detail::aligned_extent( m_lhs, rank, i );
+					const size_type rhs = detail::aligned_extent( m_rhs, rank, i );
+					if( lhs != rhs && lhs != 1 && rhs != 1 )
+					{
+						throw std::invalid_argument( "Expression shape mismatch" );
+					}
+					extents[i] = lhs == 1 ? rhs : lhs;
+				}
+				m_lhs.broadcast( extents.data( ), rank );
+				m_rhs.broadcast( extents.data( ), rank );
+			}
+		}
+
+		[[nodiscard]] size_type rank( ) const noexcept { return Lhs::is_scalar ? m_rhs.rank( ) : m_lhs.rank( ); }
+		[[nodiscard]] size_type extent( size_type t_dim ) const { return Lhs::is_scalar ? m_rhs.extent( t_dim ) : m_lhs.extent( t_dim ); }
+		[[nodiscard]] bool is_contiguous( ) const noexcept { return m_lhs.is_contiguous( ) && m_rhs.is_contiguous( ); }
+		[[nodiscard]] value_type flat( size_type t_index ) const { return m_op( m_lhs.flat( t_index ), m_rhs.flat( t_index ) ); }
+
+		void seek_row( const size_type* t_index ) noexcept
+		{
+			m_lhs.seek_row( t_index );
+			m_rhs.seek_row( t_index );
+		}
+
+		[[nodiscard]] value_type row_at( size_type t_index ) const { return m_op( m_lhs.row_at( t_index ), m_rhs.row_at( t_index ) ); }
+
+		void broadcast( const size_type* t_extents, size_type t_rank )
+		{
+			m_lhs.broadcast( t_extents, t_rank );
+			m_rhs.broadcast( t_extents, t_rank );
+		}
+
+		template<typename Span>
+		[[nodiscard]] bool aliases( const Span& t_dst ) const
+		{
+			return m_lhs.aliases( t_dst ) || m_rhs.aliases( t_dst );
+		}
+
+	private:
+		Op m_op;   ///< Applied function
+		Lhs m_lhs; ///< Left operand
+		Rhs m_rhs; ///< Right operand
+	};
+
+	namespace detail
+	{
+		template<typename Op, typename Lhs, typename Rhs>
+		[[nodiscard]] binary_expr<Op, operand_t<Lhs>, operand_t<Rhs>> make_binary( const Lhs& t_lhs, const Rhs& t_rhs, Op t_op = Op( ) )
+		{
+			return binary_expr<Op, operand_t<Lhs>, operand_t<Rhs>>( std::move( t_op ), make_operand( t_lhs ), make_operand( t_rhs ) );
+		}
+
+		template<typename Op, typename Expr>
+		[[nodiscard]] unary_expr<Op, operand_t<Expr>> make_unary( const Expr& t_expr, Op t_op = Op( ) )
+		{
+			return unary_expr<Op, operand_t<Expr>>( std::move( t_op ), make_operand( t_expr ) );
+		}
+
+		/// \brief Writes every element of t_expr into t_dst (shapes already checked, no aliasing)
+		template<typename Ty, size_t MaxRank, typename Expr>
+		void evaluate_into( nd_span<Ty, MaxRank> t_dst, Expr t_expr )
+		{
+			const size_t size = t_dst.size( );
+			if( size == 0 )
+			{
+				return;
+			}
+
+			Ty* out = t_dst.data( );
+			if( t_dst.is_contiguous( ) && t_expr.is_contiguous( ) )
+			{
+				for( size_t i = 0; i < size; ++i )
+				{
+					out[i] = static_cast<Ty>( t_expr.flat( i ) );
+				}
+				return;
+			}
+
+			const size_t rank         = t_dst.rank( );
+			const size_t inner        = t_dst.extent( rank - 1 );
+			const std::ptrdiff_t inner_stride = t_dst.stride( rank - 1 );
+			std::array<size_t, MaxRank> index { };
+			for( size_t row = 0, rows = size / inner; row < rows; ++row )
+			{
+				std::ptrdiff_t offset = 0;
+				for( size_t d = 0; d + 1 < rank; ++d )
+				{
+					offset += static_cast<std::ptrdiff_t>( index[d] ) * t_dst.stride( d );
+				}
+				t_expr.seek_row( index.data( ) );
+
+				Ty* row_out = out + offset;
+				for( size_t j = 0; j < inner; ++j )
+				{
+					row_out[static_cast<std::ptrdiff_t>( j ) * inner_stride] = static_cast<Ty>( t_expr.row_at( j ) );
+				}
+
+				for( size_t d = rank - 1; d-- > 0; )
+				{
+					if( ++index[d] < t_dst.extent( d ) )
+					{
+						break;
+					}
+					index[d] = 0;
+				}
+			}
+		}
+
+		template<typename Ty, size_t MaxRank, typename Expr>
+		void assign_expression( nd_span<Ty, MaxRank> t_dst, const Expr& t_expr )
+		{
+			if( !same_shape( t_dst, t_expr ) )
+			{
+				// Stretch the expression to the destination, it never shrinks
+				std::array<size_t, MaxRank> extents { };
+				for( size_t i = 0; i < t_dst.rank( ); ++i )
+				{
+					extents[i] = t_dst.extent( i );
+				}
+				Expr broadcast = t_expr;
+				broadcast.broadcast( extents.data( ), t_dst.rank( ) );
+				assign_expression( t_dst, broadcast );
+				return;
+			}
+
+			if( t_expr.aliases( t_dst ) )
+			{
+				const nd_array<std::remove_const_t<Ty>, MaxRank> temp( t_expr );
+				std::copy( temp.begin( ), temp.end( ), t_dst.begin( ) );
+				return;
+			}
+			ND_ARRAY_TRACE_SCOPE( "expression" );
+			simd_dispatch( [&] { evaluate_into( t_dst, t_expr ); } );
+		}
+	} // namespace detail
+
+	/// \brief Evaluates an expression into a new nd_array
+	/// \tparam Expr Expression type
+	/// \param t_expr Expression to evaluate
+	/// \return Array with the extents of the expression holding its values
+	template<typename Expr, std::enable_if_t<detail::is_expression_v<Expr>, int> = 0>
+	[[nodiscard]] nd_array<typename Expr::value_type> evaluate( const Expr& t_expr )
+	{
+		return nd_array<typename Expr::value_type>( t_expr );
+	}
+
+	/// \brief Element-wise sum (lazy)
+	template<typename Lhs, typename Rhs, std::enable_if_t<detail::is_binary_operands_v<Lhs, Rhs>, int> = 0>
+	[[nodiscard]] auto operator+( const Lhs& t_lhs, const Rhs& t_rhs )
+	{
+		return detail::make_binary<std::plus<>>( t_lhs, t_rhs );
+	}
+
+	/// \brief Element-wise difference (lazy)
+	template<typename Lhs, typename Rhs, std::enable_if_t<detail::is_binary_operands_v<Lhs, Rhs>, int> = 0>
+	[[nodiscard]] auto operator-( const Lhs& t_lhs, const Rhs& t_rhs )
+	{
+		return detail::make_binary<std::minus<>>( t_lhs, t_rhs );
+	}
+
+	/// \brief Element-wise product (lazy)
+	template<typename Lhs, typename Rhs, std::enable_if_t<detail::is_binary_operands_v<Lhs, Rhs>, int> = 0>
+	[[nodiscard]] auto operator*( const Lhs& t_lhs, const Rhs& t_rhs )
+	{
+		return detail::make_binary<std::multiplies<>>( t_lhs, t_rhs );
+	}
+
+	/// \brief Element-wise quotient (lazy)
+	template<typename Lhs, typename Rhs, std::enable_if_t<detail::is_binary_operands_v<Lhs, Rhs>, int> = 0>
+	[[nodiscard]] auto operator/( const Lhs& t_lhs, const Rhs& t_rhs )
+	{
+		return detail::make_binary<std::divides<>>( t_lhs, t_rhs );
+	}
+
+	/// \brief Element-wise equality comparison, yields bool elements (lazy)
+	template<typename Lhs, typename Rhs, std::enable_if_t<detail::is_binary_operands_v<Lhs, Rhs>, int> = 0>
+	[[nodiscard]] auto operator==( const Lhs& t_lhs, const Rhs& t_rhs )
+	{
+		return detail::make_binary<std::equal_to<>>( t_lhs, t_rhs );
+	}
+
+	/// \brief Element-wise inequality comparison, yields bool elements (lazy)
+	template<typename Lhs, typename Rhs, std::enable_if_t<detail::is_binary_operands_v<Lhs, Rhs>, int> = 0>
+	[[nodiscard]] auto operator!=( const Lhs& t_lhs, const Rhs& t_rhs )
+	{
+		return detail::make_binary<std::not_equal_to<>>( t_lhs, t_rhs );
+	}
+
+	/// \brief Element-wise less-than comparison, yields bool elements (lazy)
+	template<typename Lhs, typename Rhs, std::enable_if_t<detail::is_binary_operands_v<Lhs, Rhs>, int> = 0>
+	[[nodiscard]] auto operator<( const Lhs& t_lhs, const Rhs& t_rhs )
+	{
+		return detail::make_binary<std::less<>>( t_lhs, t_rhs );
+	}
+
+	/// \brief Element-wise less-or-equal comparison, yields bool elements (lazy)
+	template<typename Lhs, typename Rhs, std::enable_if_t<detail::is_binary_operands_v<Lhs, Rhs>, int> = 0>
+	[[nodiscard]] auto operator<=( const Lhs& t_lhs, const Rhs& t_rhs )
+	{
+		return detail::make_binary<std::less_equal<>>( t_lhs, t_rhs );
+	}
+
+	/// \brief Element-wise greater-than comparison, yields bool elements (lazy)
+	template<typename Lhs, typename Rhs, std::enable_if_t<detail::is_binary_operands_v<Lhs, Rhs>, int> = 0>
+	[[nodiscard]] auto operator>( const Lhs& t_lhs, const Rhs& t_rhs )
+	{
+		return detail::make_binary<std::greater<>>( t_lhs, t_rhs );
+	}
+
+	/// \brief Element-wise greater-or-equal comparison, yields bool elements (lazy)
+	template<typename Lhs, typename Rhs, std::enable_if_t<detail::is_binary_operands_v<Lhs, Rhs>, int> = 0>
+	[[nodiscard]] auto operator>=( const Lhs& t_lhs, const Rhs& t_rhs )
+	{
+		return detail::make_binary<std::greater_equal<>>( t_lhs, t_rhs );
+	}
+
+	/// \brief Element-wise negation (lazy)
+	template<typename Expr, std::enable_if_t<detail::is_array_operand_v<Expr>, int> = 0>
+	[[nodiscard]] auto operator-( const Expr& t_expr )
+	{
+		return detail::make_unary<std::negate<>>( t_expr );
+	}
+
+	/// \brief Element-wise absolute value (lazy)
+	template<typename Expr, std::enable_if_t<detail::is_array_operand_v<Expr>, int> = 0>
+	[[nodiscard]] auto abs( const Expr& t_expr )
+	{
+		return detail::make_unary<detail::abs_fn>( t_expr );
+	}
+
+	/// \brief Element-wise square root (lazy)
+	template<typename Expr, std::enable_if_t<detail::is_array_operand_v<Expr>, int> = 0>
+	[[nodiscard]] auto sqrt( const Expr& t_expr )
+	{
+		return detail::make_unary<detail::sqrt_fn>( t_expr );
+	}
+
+	/// \brief Element-wise exponential (lazy)
+	template<typename Expr, std::enable_if_t<detail::is_array_operand_v<Expr>, int> = 0>
+	[[nodiscard]] auto exp( const Expr& t_expr )
+	{
+		return detail::make_unary<detail::exp_fn>( t_expr );
+	}
+
+	/// \brief Element-wise natural logarithm (lazy)
+	template<typename Expr, std::enable_if_t<detail::is_array_operand_v<Expr>, int> = 0>
+	[[nodiscard]] auto log( const Expr& t_expr )
+	{
+		return detail::make_unary<detail::log_fn>( t_expr );
+	}
+
+	/// \brief Element-wise sine (lazy)
+	template<typename Expr, std::enable_if_t<detail::is_array_operand_v<Expr>, int> = 0>
+	[[nodiscard]] auto sin( const Expr& t_expr )
+	{
+		return detail::make_unary<detail::sin_fn>( t_expr );
+	}
+
+	/// \brief Element-wise cosine (lazy)
+	template<typename Expr, std::enable_if_t<detail::is_array_operand_v<Expr>, int> = 0>
+	[[nodiscard]] auto cos( const Expr& t_expr )
+	{
+		return detail::make_unary<detail::cos_fn>( t_expr );
+	}
+
+	/// \brief Element-wise hyperbolic tangent (lazy)
+	template<typename Expr, std::enable_if_t<detail::is_array_operand_v<Expr>, int> = 0>
+	[[nodiscard]] auto tanh( const Expr& t_expr )
+	{
+		return detail::make_unary<detail::tanh_fn>( t_expr );
+	}
+
+	/// \brief Element-wise power (lazy); either argument may be a scalar
+	template<typename Base, typename Exponent, std::enable_if_t<detail::is_binary_operands_v<Base, Exponent>, int> = 0>
+	[[nodiscard]] auto pow( const Base& t_base, const Exponent& t_exponent )
+	{
+		return detail::make_binary<detail::pow_fn>( t_base, t_exponent );
+	}
+
+	/// \brief Applies a custom function to every element (lazy)
+	/// \param t_expr Operand
+	/// \param t_func Function object taking one element
+	/// \example
+	/// \code
+	/// c = cppa::map(a, [](double x) { return x > 0.0 ? x : 0.0; });  // ReLU
+	/// \endcode
+	template<typename Expr, typename Func, std::enable_if_t<detail::is_array_operand_v<Expr>, int> = 0>
+	[[nodiscard]] auto map( const Expr& t_expr, Func t_func )
+	{
+		return detail::make_unary<Func>( t_expr, std::move( t_func ) );
+	}
+
+	/// \brief Adds an operand to an array or span in place, in a single pass
+	template<typename Target, typename Rhs, std::enable_if_t<detail::is_nd_container<Target>::value && detail::is_binary_operands_v<Target, Rhs>, int> = 0>
+	Target& operator+=( Target& t_target, const Rhs& t_rhs )
+	{
+		detail::assign_expression( detail::as_target( t_target ), t_target + t_rhs );
+		return t_target;
+	}
+
+	/// \brief Subtracts an operand from an array or span in place, in a single pass
+	template<typename Target, typename Rhs, std::enable_if_t<detail::is_nd_container<Target>::value && detail::is_binary_operands_v<Target, Rhs>, int> = 0>
+	Target& operator-=( Target& t_target, const Rhs& t_rhs )
+	{
+		detail::assign_expression( detail::as_target( t_target ), t_target - t_rhs );
+		return t_target;
+	}
+
+	/// \brief Multiplies an array or span by an operand in place, in a single pass
+	template<typename Target, typename Rhs, std::enable_if_t<detail::is_nd_container<Target>::value && detail::is_binary_operands_v<Target, Rhs>, int> = 0>
+	Target& operator*=( Target& t_target, const Rhs& t_rhs )
+	{
+		detail::assign_expression( detail::as_target( t_target ), t_target * t_rhs );
+		return t_target;
+	}
+
+	/// \brief Divides an array or span by an operand in place, in a single pass
+	template<typename Target, typename Rhs, std::enable_if_t<detail::is_nd_container<Target>::value && detail::is_binary_operands_v<Target, Rhs>, int> = 0>
+	Target& operator/=( Target& t_target, const Rhs& t_rhs )
+	{
+		detail::assign_expression( detail::as_target( t_target ), t_target / t_rhs );
+		return t_target;
+	}
+
+} // namespace cppa
@@ -0,0 +1,628 @@
+#pragma once
+
+#include "nd_array.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#if defined( _WIN32 )
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	include <windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+/// \file nd_io.hpp
+/// \brief Memory-mapped nd_span views over files and .npy / raw writers
+///
+/// map_npy() opens a NumPy `.npy` file and returns an nd_span directly over the mapped pages, so
+/// multi-gigabyte tensors are usable without reading or copying them. Fortran-ordered files map to
+/// column-major strides, still without a copy. map_raw() does the same for headerless files whose
+/// shape is known by the caller. save_npy() and save_raw() write any nd_span, including strided views.
+///
+/// \code
+/// // Many processes mapping read-only share a single page-cache copy of the weights
+/// auto weights = cppa::map_npy<const float>("weights.npy");
+/// float w = weights.as_span()(3, 7);
+///
+/// // Private, writable copy of the pages; the file itself is never modified
+/// auto scratch = cppa::map_npy<float>("weights.npy", cppa::map_mode::copy_on_write);
+///
+/// cppa::save_npy("weights_t.npy", weights.as_span().T());  // Written as fortran_order, no transpose loop
+/// \endcode
+///
+/// \note Only little-endian element types are read; `.npy` files with big-endian descriptors are rejected.
+
+namespace cppa
+{
+	/// \brief How the pages of a mapped file may be accessed
+	enum class map_mode
+	{
+		read_only,     ///< Pages are read-only and shared with every other mapping of the file
+		copy_on_write, ///< Pages are writable; written pages become private copies and never reach the file
+		read_write     ///< Pages are writable and shared; writes are stored back to the file
+	};
+
+	/// \class mapped_file
+	/// \brief RAII owner of a whole-file memory mapping
+	///
+	/// Move-only. The mapping is released when the object is destroyed.
+	class mapped_file
+	{
+	public:
+		/// \brief Creates an empty object that maps nothing
+		mapped_file( ) noexcept = default;
+
+		/// \brief Maps the whole file at t_path
+		/// \param t_path File to map; must exist and, for map_mode::read_write, be writable
+		/// \param t_mode Access mode of the mapped pages
+		/// \throws std::system_error if the file cannot be opened or mapped
+		mapped_file( const std::string& t_path, map_mode t_mode ) : m_mode( t_mode ) { open( t_path ); }
+
+		mapped_file( const mapped_file& )            = delete;
+		mapped_file& operator=( const mapped_file& ) = delete;
+
+		/// \brief Move constructor, leaves t_other empty
+		mapped_file( mapped_file&& t_other ) noexcept { swap( t_other ); }
+
+		/// \brief Move assignment, releases the current mapping and leaves t_other empty
+		mapped_file& operator=( mapped_file&& t_other ) noexcept
+		{
+			if( this != &t_other )
+			{
+				close( );
+				swap( t_other );
+			}
+			return *this;
+		}
+
+		~mapped_file( ) { close( ); }
+
+		/// \brief Returns the first mapped byte, or nullptr if nothing is mapped
+		[[nodiscard]] std::byte* data( ) const noexcept { return m_data; }
+
+		/// \brief Returns the mapped length in bytes
+		[[nodiscard]] size_t size( ) const noexcept { return m_size; }
+
+		/// \brief Returns the access mode the file was mapped with
+		[[nodiscard]] map_mode mode( ) const noexcept { return m_mode; }
+
+		/// \brief Returns true if a non-empty file is mapped
+		[[nodiscard]] bool is_open( ) const noexcept { return m_data != nullptr; }
+
+		/// \brief Writes modified pages of a map_mode::read_write mapping back to the file
+		/// \throws std::system_error if the flush fails
+		/// \note No-op for the other modes, where pages are never written back
+		void flush( ) const
+		{
+			if( m_data == nullptr || m_mode != map_mode::read_write )
+				return;
+#if defined( _WIN32 )
+			if( !::FlushViewOfFile( m_data, m_size ) )
+				throw std::system_error( static_cast<int>( ::GetLastError( ) ), std::system_category( ), "FlushViewOfFile failed" );
+#else
+			if( ::msync( m_data, m_size, MS_SYNC ) != 0 )
+				throw std::system_error( errno, std::generic_category( ), "msync failed" );
+#endif
+		}
+
+	private:
+		void swap( mapped_file& t_other ) noexcept
+		{
+			std::swap( m_data, t_other.m_data );
+			std::swap( m_size, t_other.m_size );
+			std::swap( m_mode, t_other.m_mode );
+#if defined( _WIN32 )
+			std::swap( m_file, t_other.m_file );
+			std::swap( m_mapping, t_other.m_mapping );
+#endif
+		}
+
+#if defined( _WIN32 )
+		void open( const std::string& t_path )
+		{
+			const DWORD access = m_mode == map_mode::read_write ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ;
+			m_file = ::CreateFileA( t_path.c_str( ), access, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+			if( m_file == INVALID_HANDLE_VALUE )
+				throw std::system_error( static_cast<int>( ::GetLastError( ) ), std::system_category( ), "Cannot open " + t_path );
+
+			LARGE_INTEGER file_size;
+			if( !::GetFileSizeEx( m_file, &file_size ) )
+			{
+				const auto error = ::GetLastError( );
+				close( );
+				throw std::system_error( static_cast<int>( error ), std::system_category( ), "Cannot query size of " + t_path );
+			}
+			m_size = static_cast<size_t>( file_size.QuadPart );
+			if( m_size == 0 )
+				return;
+
+			const DWORD protect = m_mode == map_mode::read_only ? PAGE_READONLY : m_mode == map_mode::copy_on_write ? PAGE_WRITECOPY : PAGE_READWRITE;
+			const DWORD view    = m_mode == map_mode::read_only ? FILE_MAP_READ : m_mode == map_mode::copy_on_write ? FILE_MAP_COPY : FILE_MAP_WRITE;
+			m_mapping           = ::CreateFileMappingA( m_file, nullptr, protect, 0, 0, nullptr );
+			void* address       = m_mapping != nullptr ? ::MapViewOfFile( m_mapping, view, 0, 0, 0 ) : nullptr;
+			if( address == nullptr )
+			{
+				const auto error = ::GetLastError( );
+				close( );
+				throw std::system_error( static_cast<int>( error ), std::system_category( ), "Cannot map " + t_path );
+			}
+			m_data = static_cast<std::byte*>( address );
+		}
+
+		void close( ) noexcept
+		{
+			if( m_data != nullptr )
+				::UnmapViewOfFile( m_data );
+			if( m_mapping != nullptr )
+				::CloseHandle( m_mapping );
+			if( m_file != INVALID_HANDLE_VALUE )
+				::CloseHandle( m_file );
+			m_data    = nullptr;
+			m_size    = 0;
+			m_mapping = nullptr;
+			m_file    = INVALID_HANDLE_VALUE;
+		}
+
+		HANDLE m_file    = INVALID_HANDLE_VALUE;
+		HANDLE m_mapping = nullptr;
+#else
+		void open( const std::string& t_path )
+		{
+			const int fd = ::open( t_path.c_str( ), m_mode == map_mode::read_write ? O_RDWR : O_RDONLY );
+			if( fd < 0 )
+				throw std::system_error( errno, std::generic_category( ), "Cannot open " + t_path );
+
+			struct stat info = { };
+			if( ::fstat( fd, &info ) != 0 )
+			{
+				const int error = errno;
+				::close( fd );
+				throw std::system_error( error, std::generic_category( ), "Cannot query size of " + t_path );
+			}
+			m_size = static_cast<size_t>( info.st_size );
+			if( m_size == 0 )
+			{
+				::close( fd );
+				return;
+			}
+
+			const int protect = m_mode == map_mode::read_only ? PROT_READ : PROT_READ | PROT_WRITE;
+			const int flags   = m_mode == map_mode::copy_on_write ? MAP_PRIVATE : MAP_SHARED;
+			void* address     = ::mmap( nullptr, m_size, protect, flags, fd, 0 );
+			const int error   = errno;
+			// The mapping keeps its own reference to the file
+			::close( fd );
+			if( address == MAP_FAILED )
+			{
+				m_size = 0;
+				throw std::system_error( error, std::generic_category( ), "Cannot map " + t_path );
+			}
+			m_data = static_cast<std::byte*>( address );
+		}
+
+		void close( ) noexcept
+		{
+			if( m_data != nullptr )
+				::munmap( m_data, m_size );
+			m_data = nullptr;
+			m_size = 0;
+		}
+#endif
+
+		std::byte* m_data = nullptr;
+		size_t m_size     = 0;
+		map_mode m_mode   = map_mode::read_only;
+	};
+
+	/// \class mapped_nd_span
+	/// \brief nd_span over a memory-mapped file, keeping the mapping alive
+	/// \tparam Ty Element type; must be const for map_mode::read_only mappings
+	/// \tparam MaxRank Maximum number of dimensions supported
+	///
+	/// Returned by map_npy() and map_raw(). Spans obtained from as_span() are valid as long as this
+	/// object lives. Move-only, like the mapped_file it owns.
+	template<typename Ty, size_t MaxRank = 8>
+	class mapped_nd_span
+	{
+	public:
+		using span_type = nd_span<Ty, MaxRank>; ///< View type over the mapped elements
+
+		/// \brief Takes ownership of t_file and views its elements through t_span
+		/// \param t_file Mapping that t_span points into
+		/// \param t_span View of the mapped elements
+		mapped_nd_span( mapped_file t_file, span_type t_span ) noexcept : m_file( std::move( t_file ) ), m_span( t_span ) {}
+
+		/// \brief Returns a view of the mapped elements
+		[[nodiscard]] span_type as_span( ) const noexcept { return m_span; }
+
+		/// \brief Returns the underlying mapping
+		[[nodiscard]] const mapped_file& file( ) const noexcept { return m_file; }
+
+		/// \brief Writes modified elements of a map_mode::read_write mapping back to the file
+		/// \throws std::system_error if the flush fails
+		void flush( ) const { m_file.flush( ); }
+
+	private:
+		mapped_file m_file;
+		span_type m_span;
+	};
+
+	namespace detail
+	{
+		/// \brief Returns the .npy dtype descriptor of an arithmetic type, e.g. "<f4" for float
+		template<typename Ty>
+		[[nodiscard]] std::string npy_descr( )
+		{
+			using value_type = std::remove_cv_t<Ty>;
+			static_assert( std::is_arithmetic_v<value_type>, ".npy I/O supports arithmetic element types only" );
+
+			char kind = 'f';
+			if constexpr( std::is_same_v<value_type, bool> )
+				kind = 'b';
+			else if constexpr( std::is_integral_v<value_type> )
+				kind = std::is_signed_v<value_type> ? 'i' : 'u';
+
+			return std::string( 1, sizeof( value_type ) == 1 ? '|' : '<' ) + kind + std::to_string( sizeof( value_type ) );
+		}
+
+		/// \brief Parsed fields of a .npy header
+		struct npy_header
+		{
+			std::string descr;
+			bool fortran_order = false;
+			std::vector<size_t> shape;
+			size_t data_offset = 0;
+		};
+
+		/// \brief Returns the text following t_key in the header dictionary
+		[[nodiscard]] inline const char* npy_find_value( const std::string& t_dict, const char* t_key )
+		{
+			const auto pos = t_dict.find( t_key );
+			if( pos == std::string::npos )
+				throw std::runtime_error( std::string( "Missing " ) + t_key + " in .npy header" );
+			const auto colon = t_dict.find( ':', pos );
+			if( colon == std::string::npos )
+				throw std::runtime_error( "Invalid .npy header" );
+			const char* value = t_dict.c_str( ) + colon + 1;
+			while( *value == ' ' )
+				++value;
+			return value;
+		}
+
+		/// \brief Parses the magic, version and header dictionary at the start of a .npy file
+		/// \throws std::runtime_error if the header is malformed or truncated
+		[[nodiscard]] inline npy_header parse_npy_header( const std::byte* t_data, size_t t_size )
+		{
+			static constexpr char magic[] = "\x93NUMPY";
+			if( t_size < 10 || std::memcmp( t_data, magic, 6 ) != 0 )
+				throw std::runtime_error( "Not a .npy file" );
+
+			const auto major     = static_cast<unsigned>( t_data[6] );
+			const auto byte_at   = [t_data]( size_t t_index ) { return static_cast<size_t>( t_data[t_index] ); };
+			size_t header_length = 0;
+			size_t header_start  = 0;
+			if( major == 1 )
+			{
+				header_length = byte_at( 8 ) | byte_at( 9 ) << 8;
+				header_start  = 10;
+			}
+			else if( major == 2 || major == 3 )
+			{
+				if( t_size < 12 )
+					throw std::runtime_error( "Truncated .npy header" );
+				header_length = byte_at( 8 ) | byte_at( 9 ) << 8 | byte_at( 10 ) << 16 | byte_at( 11 ) << 24;
+				header_start  = 12;
+			}
+			else
+			{
+				throw std::runtime_error( "Unsupported .npy version " + std::to_string( major ) );
+			}
+			if( header_start + header_length > t_size )
+				throw std::runtime_error( "Truncated .npy header" );
+
+			const std::string dict( reinterpret_cast<const char*>( t_data + header_start ), header_length );
+			npy_header result;
+			result.data_offset = header_start + header_length;
+
+			const char* descr = npy_find_value( dict, "'descr'" );
+			if( *descr != '\'' )
+				throw std::runtime_error( "Invalid descr in .npy header" );
+			const char* descr_end = std::strchr( descr + 1, '\'' );
+			if( descr_end == nullptr )
+				throw std::runtime_error( "Invalid descr in .npy header" );
+			result.descr.assign( descr + 1, descr_end );
+
+			const char* order = npy_find_value( dict, "'fortran_order'" );
+			if( std::strncmp( order, "True", 4 ) == 0 )
+				result.fortran_order = true;
+			else if( std::strncmp( order, "False", 5 ) != 0 )
+				throw std::runtime_error( "Invalid fortran_order in .npy header" );
+
+			const char* shape = npy_find_value( dict, "'shape'" );
+			if( *shape != '(' )
+				throw std::runtime_error( "Invalid shape in .npy header" );
+			for( ++shape; *shape != ')'; )
+			{
+				if( *shape == ' ' || *shape == ',' )
+				{
+					++shape;
+					continue;
+				}
+				char* next           = nullptr;
+				const auto dimension = std::strtoull( shape, &next, 10 );
+				if( next == shape )
+					throw std::runtime_error( "Invalid shape in .npy header" );
+				result.shape.push_back( static_cast<size_t>( dimension ) );
+				shape = next;
+			}
+			return result;
+		}
+
+		/// \brief Checks that a descriptor read from a file describes Ty
+		[[nodiscard]] inline bool npy_descr_matches( std::string t_file_descr, const std::string& t_expected )
+		{
+			// '=' is native order and '|' marks single-byte types; both are little-endian compatible here
+			if( !t_file_descr.empty( ) && ( t_file_descr[0] == '=' || t_file_descr[0] == '|' ) )
+				t_file_descr[0] = t_expected[0];
+			return t_file_descr == t_expected;
+		}
+
+		/// \brief Builds the view over already validated mapped bytes
+		template<typename Ty, size_t MaxRank>
+		[[nodiscard]] mapped_nd_span<Ty, MaxRank> make_mapped_span( mapped_file t_file, size_t t_offset, const std::vector<size_t>& t_shape, bool t_column_major )
+		{
+			using value_type = std::remove_const_t<Ty>;
+			if( t_shape.empty( ) )
+				throw std::invalid_argument( "Rank-0 arrays cannot be mapped" );
+			if( t_shape.size( ) > MaxRank )
+				throw std::invalid_argument( "Rank exceeds MaxRank" );
+			if( t_offset % alignof( value_type ) != 0 )
+				throw std::invalid_argument( "Data offset is not aligned for the element type" );
+
+			const size_t rank = t_shape.size( );
+			std::array<size_t, MaxRank> extents { };
+			std::array<std::ptrdiff_t, MaxRank> strides { };
+			size_t count = 1;
+			for( size_t i = 0; i < rank; ++i )
+			{
+				extents[i] = t_shape[i];
+				count *= t_shape[i];
+			}
+			if( t_offset > t_file.size( ) || count > ( t_file.size( ) - t_offset ) / sizeof( value_type ) )
+				throw std::runtime_error( "File is too small for the requested shape" );
+
+			if( t_column_major )
+			{
+				layout_left::compute_strides<MaxRank>( strides, extents, rank );
+			}
+			else
+			{
+				stride_computer<MaxRank>::compute( strides, extents, rank );
+			}
+
+			auto* data = count == 0 ? nullptr : reinterpret_cast<Ty*>( t_file.data( ) + t_offset );
+			return mapped_nd_span<Ty, MaxRank>( std::move( t_file ), nd_span<Ty, MaxRank>( data, extents, strides, rank ) );
+		}
+
+		/// \brief Rejects writable element types on read-only mappings
+		template<typename Ty>
+		void check_map_mode( map_mode t_mode )
+		{
+			if( !std::is_const_v<Ty> && t_mode == map_mode::read_only )
+				throw std::invalid_argument( "Read-only mapping requires a const element type" );
+		}
+
+		/// \brief Passes the bytes of t_span in row-major order to t_sink, one or more calls of (pointer, bytes)
+		///
+		/// Contiguous views are passed in one call; other views are gathered block-wise through a
+		/// small buffer with the strided copy engine, so they are never materialized as a whole.
+		template<typename Ty, size_t MaxRank, typename Sink>
+		void for_each_row_major_block( const nd_span<Ty, MaxRank>& t_span, Sink&& t_sink )
+		{
+			using value_type = std::remove_const_t<Ty>;
+			if( t_span.size( ) == 0 )
+				return;
+			if( t_span.is_contiguous( ) )
+			{
+				t_sink( reinterpret_cast<const std::byte*>( t_span.data( ) ), t_span.size( ) * sizeof( value_type ) );
+				return;
+			}
+
+			constexpr size_t buffer_bytes = size_t( 1 ) << 20;
+			const size_t rank             = t_span.rank( );
+			const size_t rows             = t_span.extent( 0 );
+			const size_t row_size         = t_span.size( ) / rows;
+			const size_t block_rows       = std::max<size_t>( 1, buffer_bytes / ( row_size * sizeof( value_type ) ) );
+
+			std::array<size_t, MaxRank> extents { };
+			std::array<std::ptrdiff_t, MaxRank> strides { };
+			for( size_t i = 0; i < rank; ++i )
+				extents[i] = t_span.extent( i );
+
+			std::vector<value_type> buffer( std::min( block_rows, rows ) * row_size );
+			for( size_t first = 0; first < rows; first += block_rows )
+			{
+				const size_t count = std::min( block_rows, rows - first );
+				extents[0]         = count;
+				stride_computer<MaxRank>::compute( strides, extents, rank );
+				nd_span<value_type, MaxRank> block( buffer.data( ), extents, strides, rank );
+				block.copy_from( t_span.subspan( 0, { first, first + count } ) );
+				t_sink( reinterpret_cast<const std::byte*>( buffer.data( ) ), count * row_size * sizeof( value_type ) );
+			}
+		}
+
+		/// \brief Writes the elements of t_span to t_out in row-major order
+		template<typename Ty, size_t MaxRank>
+		void write_row_major( std::ostream& t_out, const nd_span<Ty, MaxRank>& t_span )
+		{
+			for_each_row_major_block( t_span, [&t_out]( const std::byte* t_bytes, size_t t_size )
+			                          { t_out.write( reinterpret_cast<const char*>( t_bytes ), static_cast<std::streamsize>( t_size ) ); } );
+		}
+
+		/// \brief Opens t_path for binary writing
+		/// \throws std::system_error if the file cannot be created
+		[[nodiscard]] inline std::ofstream open_for_writing( const std::string& t_path )
+		{
+			std::ofstream out( t_path, std::ios::binary | std::ios::trunc );
+			if( !out )
+				throw std::system_error( errno, std::generic_category( ), "Cannot create " + t_path );
+			return out;
+		}
+
+		/// \brief Fails if a stream write did not complete
+		inline void check_written( const std::ofstream& t_out, const std::string& t_path )
+		{
+			if( !t_out )
+				throw std::system_error( errno, std::generic_category( ), "Cannot write " + t_path );
+		}
+	} // namespace detail
+
+	/// \brief Memory-maps a .npy file as an nd_span without copying its data
+	/// \tparam Ty Element type matching the file's descr; const for read-only mappings
+	/// \tparam MaxRank Maximum number of dimensions supported
+	/// \param t_path Path of the .npy file (format versions 1.0, 2.0 and 3.0)
+	/// \param t_mode Access mode; defaults to read_only for const Ty and copy_on_write otherwise
+	/// \return Mapping owning the pages, with as_span() viewing the array
+	/// \throws std::system_error if the file cannot be opened or mapped
+	/// \throws std::runtime_error if the header is malformed or the file is truncated
+	/// \throws std::invalid_argument if Ty does not match the stored type, the rank exceeds MaxRank or
+	///                               is zero, or a read-only mapping is requested for non-const Ty
+	/// \note Fortran-ordered files are viewed with column-major strides.
+	/// \example
+	/// \code
+	/// auto mapped = cppa::map_npy<const float>("activations.npy");
+	/// auto span   = mapped.as_span();
+	/// float first = span(0, 0);
+	/// \endcode
+	template<typename Ty, size_t MaxRank = 8>
+	[[nodiscard]] mapped_nd_span<Ty, MaxRank> map_npy( const std::string& t_path, map_mode t_mode = std::is_const_v<Ty> ? map_mode::read_only : map_mode::copy_on_write )
+	{
+		detail::check_map_mode<Ty>( t_mode );
+		mapped_file file( t_path, t_mode );
+		const auto header = detail::parse_npy_header( file.data( ), file.size( ) );
+		if( !detail::npy_descr_matches( header.descr, detail::npy_descr<Ty>( ) ) )
+			throw std::invalid_argument( "Element type " + detail::npy_descr<Ty>( ) + " does not match .npy descr " + header.descr );
+		return detail::make_mapped_span<Ty, MaxRank>( std::move( file ), header.data_offset, header.shape, header.fortran_order );
+	}
+
+	/// \brief Memory-maps a headerless file of row-major elements as an nd_span
+	/// \tparam Ty Element type stored in the file; const for read-only mappings
+	/// \tparam MaxRank Maximum number of dimensions supported
+	/// \param t_path Path of the raw file
+	/// \param t_extents Extents of the stored array
+	/// \param t_offset Byte offset of the first element, e.g. past a custom header
+	/// \param t_mode Access mode; defaults to read_only for const Ty and copy_on_write otherwise
+	/// \return Mapping owning the pages, with as_span() viewing the array
+	/// \throws std::system_error if the file cannot be opened or mapped
+	/// \throws std::runtime_error if the file is too small for t_extents
+	/// \throws std::invalid_argument if t_offset is misaligned for Ty, the rank is invalid, or a read-only
+	///                               mapping is requested for non-const Ty
+	template<typename Ty, size_t MaxRank = 8>
+	[[nodiscard]] mapped_nd_span<Ty, MaxRank> map_raw( const std::string& t_path, std::initializer_list<size_t> t_extents, size_t t_offset = 0,
+	                                                   map_mode t_mode = std::is_const_v<Ty> ? map_mode::read_only : map_mode::copy_on_write )
+	{
+		detail::check_map_mode<Ty>( t_mode );
+		mapped_file file( t_path, t_mode );
+		return detail::make_mapped_span<Ty, MaxRank>( std::move( file ), t_offset, std::vector<size_t>( t_extents ), false );
+	}
+
+	/// \brief Writes a view to a .npy file (format version 1.0)
+	/// \param t_path Destination path, overwritten if it exists
+	/// \param t_span View to write; any strides are accepted
+	/// \throws std::system_error if the file cannot be written
+	/// \throws std::invalid_argument for rank-0 views
+	/// \note The header is built from extents() and stride(): row-major and column-major contiguous views are
+	///       written with a single write (the latter as fortran_order), other views are gathered in row-major order.
+	/// \example
+	/// \code
+	/// nd_array<double> field(128, 256);
+	/// cppa::save_npy("field.npy", field.as_span());
+	/// cppa::save_npy("field_t.npy", field.T());  // fortran_order: True, data written as is
+	/// \endcode
+	template<typename Ty, size_t MaxRank>
+	void save_npy( const std::string& t_path, const nd_span<Ty, MaxRank>& t_span )
+	{
+		const size_t rank = t_span.rank( );
+		if( rank == 0 )
+			throw std::invalid_argument( "Rank-0 arrays cannot be saved" );
+
+		std::array<size_t, MaxRank> extents { };
+		std::array<std::ptrdiff_t, MaxRank> strides { };
+		for( size_t i = 0; i < rank; ++i )
+		{
+			extents[i] = t_span.extent( i );
+			strides[i] = t_span.stride( i );
+		}
+		const bool fortran_order = rank > 1 && !t_span.is_contiguous( ) && detail::is_column_major_contiguous<MaxRank>( extents, strides, rank );
+
+		std::string dict = "{'descr': '" + detail::npy_descr<Ty>( ) + "', 'fortran_order': " + ( fortran_order ? "True" : "False" ) + ", 'shape': (";
+		for( size_t i = 0; i < rank; ++i )
+			dict += std::to_string( extents[i] ) + ( rank == 1 || i + 1 < rank ? "," : "" ) + ( i + 1 < rank ? " " : "" );
+		dict += "), }";
+
+		// Pad with spaces so that the data starts on a 64-byte boundary, as numpy does
+		constexpr size_t preamble = 10;
+		const size_t total        = ( preamble + dict.size( ) + 1 + 63 ) / 64 * 64;
+		dict.append( total - preamble - dict.size( ) - 1, ' ' );
+		dict += '\n';
+		if( dict.size( ) > 0xFFFF )
+			throw std::invalid_argument( "Shape too large for a .npy header" );
+
+		auto out              = detail::open_for_writing( t_path );
+		const char version[4] = { 1, 0, static_cast<char>( dict.size( ) & 0xFF ), static_cast<char>( dict.size( ) >> 8 ) };
+		out.write( "\x93NUMPY", 6 );
+		out.write( version, 4 );
+		out.write( dict.data( ), static_cast<std::streamsize>( dict.size( ) ) );
+
+		if( fortran_order )
+			out.write( reinterpret_cast<const char*>( t_span.data( ) ), static_cast<std::streamsize>( t_span.size( ) * sizeof( Ty ) ) );
+		else
+			detail::write_row_major( out, t_span );
+		detail::check_written( out, t_path );
+	}
+
+	/// \brief Writes an array to a .npy file (format version 1.0)
+	/// \see save_npy(const std::string&, const nd_span<Ty, MaxRank>&)
+	template<typename Ty, size_t MaxRank, typename Allocator, size_t InlineCapacity>
+	void save_npy( const std::string& t_path, const nd_array<Ty, MaxRank, Allocator, InlineCapacity>& t_array )
+	{
+		save_npy( t_path, t_array.as_span( ) );
+	}
+
+	/// \brief Writes the elements of a view in row-major order without a header
+	/// \param t_path Destination path, overwritten if it exists
+	/// \param t_span View to write; any strides are accepted
+	/// \throws std::system_error if the file cannot be written
+	/// \note Read back with map_raw() and the same extents.
+	template<typename Ty, size_t MaxRank>
+	void save_raw( const std::string& t_path, const nd_span<Ty, MaxRank>& t_span )
+	{
+		auto out = detail::open_for_writing( t_path );
+		detail::write_row_major( out, t_span );
+		detail::check_written( out, t_path );
+	}
+
+	/// \brief Writes the elements of an array without a header
+	/// \see save_raw(const std::string&, const nd_span<Ty, MaxRank>&)
+	template<typename Ty, size_t MaxRank, typename Allocator, size_t InlineCapacity>
+	void save_raw( const std::string& t_path, const nd_array<Ty, MaxRank, Allocator, InlineCapacity>& t_array )
+	{
+		save_raw( t_path, t_array.as_span( ) );
+	}
+} // namespace cppa
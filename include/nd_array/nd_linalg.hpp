@@ -0,0 +1,739 @@
+#pragma once
+
+#include "nd_array.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#if defined( ND_ARRAY_USE_CBLAS )
+#	include <cblas.h>
+#endif
+
+/// \file nd_linalg.hpp
+/// \brief Matrix products of rank-2 and batched nd_span / nd_array operands
+///
+/// matmul() multiplies the last two dimensions of its operands and treats leading dimensions as a
+/// batch, broadcast like NumPy (an operand with fewer or extent-1 batch dimensions is reused for every
+/// matrix of the batch). matvec() multiplies a matrix with a vector. Operands keep their strides, so
+/// T() views, column-major data and subspans are used without copying them first.
+///
+/// The built-in kernel packs cache-sized blocks of both operands into contiguous panels, reading each
+/// operand along its unit-stride dimension, and accumulates 4 x 8 tiles of the result in registers.
+/// Defining `ND_ARRAY_USE_CBLAS` (the `ND_ARRAY_USE_BLAS` CMake option) routes float and double
+/// operands whose matrices have a unit stride in one dimension to `cblas_sgemm`/`cblas_dgemm` and
+/// `cblas_sgemv`/`cblas_dgemv`; everything else falls back to the built-in kernel.
+///
+/// \code
+/// nd_array<float> a(512, 256), b(512, 256);
+/// nd_array<float> c(512, 512);
+/// cppa::matmul(a, b.T(), c);                       // c = a * b^T, b is not transposed in memory
+///
+/// nd_array<float> q(8, 128, 64), k(8, 128, 64);
+/// auto scores = cppa::matmul(cppa::par, q, k.transpose({0, 2, 1}));  // extents 8 x 128 x 128
+/// \endcode
+///
+/// \note The result must not overlap an operand. With cppa::par, batches are split across threads,
+///       or the rows of the result for a single matrix.
+
+namespace cppa
+{
+	namespace detail
+	{
+		/// \brief Strided matrix operand of the kernels
+		template<typename Ty>
+		struct matrix_ref
+		{
+			Ty* data;                  ///< Element (0, 0)
+			size_t rows;               ///< Number of rows
+			size_t cols;               ///< Number of columns
+			std::ptrdiff_t row_stride; ///< Distance between rows in elements
+			std::ptrdiff_t col_stride; ///< Distance between columns in elements
+
+			[[nodiscard]] Ty& operator( )( size_t t_row, size_t t_col ) const noexcept
+			{
+				return data[static_cast<std::ptrdiff_t>( t_row ) * row_stride + static_cast<std::ptrdiff_t>( t_col ) * col_stride];
+			}
+
+			/// \brief Rows [t_first, t_last) of the matrix
+			[[nodiscard]] matrix_ref row_range( size_t t_first, size_t t_last ) const noexcept
+			{
+				return { data + static_cast<std::ptrdiff_t>( t_first ) * row_stride, t_last - t_first, cols, row_stride, col_stride };
+			}
+
+			/// \brief True if walking a row is the cheaper direction through memory
+			[[nodiscard]] bool rows_contiguous( ) const noexcept { return std::abs( col_stride ) <= std::abs( row_stride ); }
+		};
+
+		/// \brief Register and cache blocking of the built-in kernel
+		struct gemm_blocking
+		{
+			static constexpr size_t mr = 4;    ///< Rows of the register tile
+			static constexpr size_t nr = 8;    ///< Columns of the register tile (one 256-bit vector of floats)
+			static constexpr size_t kc = 256;  ///< Depth of the packed panels; an mr x kc slice of A stays in L1
+			static constexpr size_t mc = 64;   ///< Rows of a packed block of A (L2)
+			static constexpr size_t nc = 1024; ///< Columns of a packed block of B (L3)
+		};
+
+		/// \brief Packing buffers of one thread, reused for every matrix it multiplies
+		template<typename Ty>
+		struct gemm_workspace
+		{
+			std::vector<Ty> a_pack; ///< Panels of mr rows of A, depth-major
+			std::vector<Ty> b_pack; ///< Panels of nr columns of B, depth-major
+		};
+
+		/// \brief Copies rows [t_row, t_row + t_rows) and depth [t_depth, t_depth + t_depth_count) of A into mr-row panels
+		/// \note Rows past the end of A are zero-padded, so the tile kernel never branches on the edge
+		template<typename Ty>
+		void pack_a( const matrix_ref<const Ty>& t_a, size_t t_row, size_t t_rows, size_t t_depth, size_t t_depth_count, Ty* t_out )
+		{
+			constexpr size_t mr = gemm_blocking::mr;
+			for( size_t p = 0; p < t_rows; p += mr, t_out += mr * t_depth_count )
+			{
+				const size_t valid = std::min( mr, t_rows - p );
+				if( valid < mr )
+				{
+					std::fill( t_out, t_out + mr * t_depth_count, Ty( 0 ) );
+				}
+				if( t_a.rows_contiguous( ) )
+				{
+					for( size_t i = 0; i < valid; ++i )
+					{
+						for( size_t k = 0; k < t_depth_count; ++k )
+						{
+							t_out[k * mr + i] = t_a( t_row + p + i, t_depth + k );
+						}
+					}
+				}
+				else
+				{
+					for( size_t k = 0; k < t_depth_count; ++k )
+					{
+						for( size_t i = 0; i < valid; ++i )
+						{
+							t_out[k * mr + i] = t_a( t_row + p + i, t_depth + k );
+						}
+					}
+				}
+			}
+		}
+
+		/// \brief Copies depth [t_depth, t_depth + t_depth_count) and columns [t_col, t_col + t_cols) of B into nr-column panels
+		template<typename Ty>
+		void pack_b( const matrix_ref<const Ty>& t_b, size_t t_depth, size_t t_depth_count, size_t t_col, size_t t_cols, Ty* t_out )
+		{
+			constexpr size_t nr = gemm_blocking::nr;
+			for( size_t q = 0; q < t_cols; q += nr, t_out += nr * t_depth_count )
+			{
+				const size_t valid = std::min( nr, t_cols - q );
+				if( valid < nr )
+				{
+					std::fill( t_out, t_out + nr * t_depth_count, Ty( 0 ) );
+				}
+				if( t_b.rows_contiguous( ) )
+				{
+					for( size_t k = 0; k < t_depth_count; ++k )
+					{
+						for( size_t j = 0; j < valid; ++j )
+						{
+							t_out[k * nr + j] = t_b( t_depth + k, t_col + q + j );
+						}
+					}
+				}
+				else
+				{
+					for( size_t j = 0; j < valid; ++j )
+					{
+						for( size_t k = 0; k < t_depth_count; ++k )
+						{
+							t_out[k * nr + j] = t_b( t_depth + k, t_col + q + j );
+						}
+					}
+				}
+			}
+		}
+
+		/// \brief Multiplies one packed A panel with one packed B panel into a tile of C
+		/// \param t_accumulate Adds to C instead of overwriting it (every depth block but the first)
+		template<typename Ty>
+		void gemm_tile( size_t t_depth_count, const Ty* t_a, const Ty* t_b, const matrix_ref<Ty>& t_c, size_t t_row, size_t t_col, size_t t_rows, size_t t_cols,
+		                bool t_accumulate )
+		{
+			constexpr size_t mr = gemm_blocking::mr;
+			constexpr size_t nr = gemm_blocking::nr;
+
+			Ty acc[mr][nr] = { };
+			for( size_t k = 0; k < t_depth_count; ++k, t_a += mr, t_b += nr )
+			{
+				for( size_t i = 0; i < mr; ++i )
+				{
+					const Ty a = t_a[i];
+					for( size_t j = 0; j < nr; ++j )
+					{
+						acc[i][j] += a * t_b[j];
+					}
+				}
+			}
+
+			for( size_t i = 0; i < t_rows; ++i )
+			{
+				for( size_t j = 0; j < t_cols; ++j )
+				{
+					Ty& out = t_c( t_row + i, t_col + j );
+					out     = t_accumulate ? out + acc[i][j] : acc[i][j];
+				}
+			}
+		}
+
+		/// \brief Cache-blocked, register-tiled C = A * B for matrices with at least one element and non-zero depth
+		template<typename Ty>
+		void gemm_blocked( const matrix_ref<const Ty>& t_a, const matrix_ref<const Ty>& t_b, const matrix_ref<Ty>& t_c, gemm_workspace<Ty>& t_workspace )
+		{
+			using blocking     = gemm_blocking;
+			const size_t m     = t_c.rows;
+			const size_t n     = t_c.cols;
+			const size_t depth = t_a.cols;
+			const auto padded  = []( size_t t_count, size_t t_multiple ) { return ( t_count + t_multiple - 1 ) / t_multiple * t_multiple; };
+
+			for( size_t jc = 0; jc < n; jc += blocking::nc )
+			{
+				const size_t cols = std::min( blocking::nc, n - jc );
+				for( size_t pc = 0; pc < depth; pc += blocking::kc )
+				{
+					const size_t depth_count = std::min( blocking::kc, depth - pc );
+					t_workspace.b_pack.resize( std::max( t_workspace.b_pack.size( ), padded( cols, blocking::nr ) * depth_count ) );
+					pack_b( t_b, pc, depth_count, jc, cols, t_workspace.b_pack.data( ) );
+
+					for( size_t ic = 0; ic < m; ic += blocking::mc )
+					{
+						const size_t rows = std::min( blocking::mc, m - ic );
+						t_workspace.a_pack.resize( std::max( t_workspace.a_pack.size( ), padded( rows, blocking::mr ) * depth_count ) );
+						pack_a( t_a, ic, rows, pc, depth_count, t_workspace.a_pack.data( ) );
+
+						for( size_t jr = 0; jr < cols; jr += blocking::nr )
+						{
+							for( size_t ir = 0; ir < rows; ir += blocking::mr )
+							{
+								gemm_tile( depth_count, t_workspace.a_pack.data( ) + ir * depth_count, t_workspace.b_pack.data( ) + jr * depth_count, t_c, ic + ir,
+								           jc + jr, std::min( blocking::mr, rows - ir ), std::min( blocking::nr, cols - jr ), pc > 0 );
+							}
+						}
+					}
+				}
+			}
+		}
+
+		/// \brief Dot product of two strided vectors; unit strides use eight independent accumulators
+		template<typename Ty>
+		[[nodiscard]] Ty dot_strided( const Ty* t_a, std::ptrdiff_t t_a_stride, const Ty* t_x, std::ptrdiff_t t_x_stride, size_t t_count ) noexcept
+		{
+			Ty sum = Ty( 0 );
+			size_t i = 0;
+			if( t_a_stride == 1 && t_x_stride == 1 )
+			{
+				constexpr size_t lanes = 8;
+				Ty acc[lanes] = { };
+				for( ; i + lanes <= t_count; i += lanes )
+				{
+					for( size_t j = 0; j < lanes; ++j )
+					{
+						acc[j] += t_a[i + j] * t_x[i + j];
+					}
+				}
+				for( size_t j = 0; j < lanes; ++j )
+				{
+					sum += acc[j];
+				}
+			}
+			for( ; i < t_count; ++i )
+			{
+				sum += t_a[static_cast<std::ptrdiff_t>( i ) * t_a_stride] * t_x[static_cast<std::ptrdiff_t>( i ) * t_x_stride];
+			}
+			return sum;
+		}
+
+#if defined( ND_ARRAY_USE_CBLAS )
+		/// \brief Describes a matrix as a row-major BLAS operand (t_trans, t_ld), if one of its strides is 1
+		template<typename Ty>
+		[[nodiscard]] bool blas_layout( const matrix_ref<Ty>& t_m, CBLAS_TRANSPOSE& t_trans, int& t_ld ) noexcept
+		{
+			const auto rows = static_cast<std::ptrdiff_t>( t_m.rows );
+			const auto cols = static_cast<std::ptrdiff_t>( t_m.cols );
+			std::ptrdiff_t ld = 0;
+			if( ( t_m.col_stride == 1 || cols <= 1 ) && ( rows <= 1 || t_m.row_stride >= std::max<std::ptrdiff_t>( cols, 1 ) ) )
+			{
+				t_trans = CblasNoTrans;
+				ld      = rows <= 1 ? std::max<std::ptrdiff_t>( cols, 1 ) : t_m.row_stride;
+			}
+			else if( ( t_m.row_stride == 1 || rows <= 1 ) && ( cols <= 1 || t_m.col_stride >= std::max<std::ptrdiff_t>( rows, 1 ) ) )
+			{
+				t_trans = CblasTrans;
+				ld      = cols <= 1 ? std::max<std::ptrdiff_t>( rows, 1 ) : t_m.col_stride;
+			}
+			else
+			{
+				return false;
+			}
+			t_ld = static_cast<int>( ld );
+			return t_m.rows <= INT_MAX && t_m.cols <= INT_MAX && ld <= INT_MAX;
+		}
+
+		[[nodiscard]] constexpr CBLAS_TRANSPOSE blas_flip( CBLAS_TRANSPOSE t_trans ) noexcept { return t_trans == CblasNoTrans ? CblasTrans : CblasNoTrans; }
+
+		/// \brief C = A * B through cblas_?gemm; false if the element type or a layout is not supported
+		template<typename Ty>
+		[[nodiscard]] bool blas_gemm( const matrix_ref<const Ty>& t_a, const matrix_ref<const Ty>& t_b, const matrix_ref<Ty>& t_c ) noexcept
+		{
+			if constexpr( std::is_same_v<Ty, float> || std::is_same_v<Ty, double> )
+			{
+				CBLAS_TRANSPOSE a_trans, b_trans, c_trans;
+				int lda, ldb, ldc;
+				if( !blas_layout( t_a, a_trans, lda ) || !blas_layout( t_b, b_trans, ldb ) || !blas_layout( t_c, c_trans, ldc ) )
+				{
+					return false;
+				}
+				const auto gemm = []( auto... t_args )
+				{
+					if constexpr( std::is_same_v<Ty, float> )
+					{
+						cblas_sgemm( t_args... );
+					}
+					else
+					{
+						cblas_dgemm( t_args... );
+					}
+				};
+				const int m     = static_cast<int>( t_c.rows );
+				const int n     = static_cast<int>( t_c.cols );
+				const int depth = static_cast<int>( t_a.cols );
+				if( c_trans == CblasNoTrans )
+				{
+					gemm( CblasRowMajor, a_trans, b_trans, m, n, depth, Ty( 1 ), t_a.data, lda, t_b.data, ldb, Ty( 0 ), t_c.data, ldc );
+				}
+				else
+				{
+					// A column-major result is the row-major transpose: C^T = B^T * A^T
+					gemm( CblasRowMajor, blas_flip( b_trans ), blas_flip( a_trans ), n, m, depth, Ty( 1 ), t_b.data, ldb, t_a.data, lda, Ty( 0 ), t_c.data, ldc );
+				}
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		/// \brief y = A * x through cblas_?gemv; false if the element type, layout or vector strides are not supported
+		template<typename Ty>
+		[[nodiscard]] bool blas_gemv( const matrix_ref<const Ty>& t_a, const Ty* t_x, std::ptrdiff_t t_x_stride, Ty* t_y, std::ptrdiff_t t_y_stride ) noexcept
+		{
+			if constexpr( std::is_same_v<Ty, float> || std::is_same_v<Ty, double> )
+			{
+				CBLAS_TRANSPOSE a_trans;
+				int lda;
+				if( !blas_layout( t_a, a_trans, lda ) || t_x_stride < 1 || t_y_stride < 1 || t_x_stride > INT_MAX || t_y_stride > INT_MAX )
+				{
+					return false;
+				}
+				const auto gemv = []( auto... t_args )
+				{
+					if constexpr( std::is_same_v<Ty, float> )
+					{
+						cblas_sgemv( t_args... );
+					}
+					else
+					{
+						cblas_dgemv( t_args... );
+					}
+				};
+				const int m     = static_cast<int>( t_a.rows );
+				const int depth = static_cast<int>( t_a.cols );
+				const int incx  = static_cast<int>( t_x_stride );
+				const int incy  = static_cast<int>( t_y_stride );
+				if( a_trans == CblasNoTrans )
+				{
+					gemv( CblasRowMajor, CblasNoTrans, m, depth, Ty( 1 ), t_a.data, lda, t_x, incx, Ty( 0 ), t_y, incy );
+				}
+				else
+				{
+					gemv( CblasRowMajor, CblasTrans, depth, m, Ty( 1 ), t_a.data, lda, t_x, incx, Ty( 0 ), t_y, incy );
+				}
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+#endif
+
+		/// \brief C = A * B for one matrix of any strides
+		template<typename Ty>
+		void gemm( const matrix_ref<const Ty>& t_a, const matrix_ref<const Ty>& t_b, const matrix_ref<Ty>& t_c, gemm_workspace<Ty>& t_workspace )
+		{
+			if( t_c.rows == 0 || t_c.cols == 0 )
+			{
+				return;
+			}
+			if( t_a.cols == 0 )
+			{
+				for( size_t i = 0; i < t_c.rows; ++i )
+				{
+					for( size_t j = 0; j < t_c.cols; ++j )
+					{
+						t_c( i, j ) = Ty( 0 );
+					}
+				}
+				return;
+			}
+#if defined( ND_ARRAY_USE_CBLAS )
+			if( blas_gemm( t_a, t_b, t_c ) )
+			{
+				return;
+			}
+#endif
+			gemm_blocked( t_a, t_b, t_c, t_workspace );
+		}
+
+		/// \brief y = A * x for one matrix of any strides
+		template<typename Ty>
+		void gemv( const matrix_ref<const Ty>& t_a, const Ty* t_x, std::ptrdiff_t t_x_stride, Ty* t_y, std::ptrdiff_t t_y_stride )
+		{
+			const auto at = []( auto* t_ptr, std::ptrdiff_t t_stride, size_t t_index ) -> auto& { return t_ptr[static_cast<std::ptrdiff_t>( t_index ) * t_stride]; };
+			if( t_a.rows == 0 )
+			{
+				return;
+			}
+#if defined( ND_ARRAY_USE_CBLAS )
+			if( t_a.cols > 0 && blas_gemv( t_a, t_x, t_x_stride, t_y, t_y_stride ) )
+			{
+				return;
+			}
+#endif
+			if( t_a.rows_contiguous( ) || t_a.cols == 0 )
+			{
+				// One dot product per row
+				for( size_t i = 0; i < t_a.rows; ++i )
+				{
+					at( t_y, t_y_stride, i ) = dot_strided( &t_a( i, 0 ), t_a.col_stride, t_x, t_x_stride, t_a.cols );
+				}
+				return;
+			}
+
+			// Columns are contiguous: accumulate y += A(:, k) * x(k)
+			for( size_t i = 0; i < t_a.rows; ++i )
+			{
+				at( t_y, t_y_stride, i ) = Ty( 0 );
+			}
+			for( size_t k = 0; k < t_a.cols; ++k )
+			{
+				const Ty xk      = at( t_x, t_x_stride, k );
+				const Ty* column = &t_a( 0, k );
+				if( t_a.row_stride == 1 && t_y_stride == 1 )
+				{
+					for( size_t i = 0; i < t_a.rows; ++i )
+					{
+						t_y[i] += column[i] * xk;
+					}
+				}
+				else
+				{
+					for( size_t i = 0; i < t_a.rows; ++i )
+					{
+						at( t_y, t_y_stride, i ) += at( column, t_a.row_stride, i ) * xk;
+					}
+				}
+			}
+		}
+
+		/// \brief Matrix formed by the last two dimensions of a view
+		template<typename Ty, size_t MaxRank>
+		[[nodiscard]] matrix_ref<Ty> trailing_matrix( nd_span<Ty, MaxRank> t_span ) noexcept
+		{
+			const size_t rank = t_span.rank( );
+			return { t_span.data( ), t_span.extent( rank - 2 ), t_span.extent( rank - 1 ), t_span.stride( rank - 2 ), t_span.stride( rank - 1 ) };
+		}
+
+		/// \brief Strides of an operand along each batch dimension of the result; 0 where it is broadcast
+		template<typename Ty, size_t MaxRank, size_t ResultRank>
+		[[nodiscard]] std::array<std::ptrdiff_t, ResultRank> batch_strides( const nd_span<Ty, MaxRank>& t_operand, const std::array<size_t, ResultRank>& t_result, size_t t_rank )
+		{
+			std::array<std::ptrdiff_t, ResultRank> strides { };
+			const size_t offset = t_rank - t_operand.rank( );
+			for( size_t d = offset; d + 2 < t_rank; ++d )
+			{
+				const size_t extent = t_operand.extent( d - offset );
+				if( extent == t_result[d] )
+				{
+					strides[d] = t_operand.stride( d - offset );
+				}
+				else if( extent != 1 )
+				{
+					throw std::invalid_argument( "matmul batch extents do not match" );
+				}
+			}
+			return strides;
+		}
+
+		/// \brief Batched C = A * B over the leading dimensions of C
+		template<typename Policy, typename Ty, size_t RankA, size_t RankB, size_t RankC>
+		void matmul_spans( const Policy& t_policy, const nd_span<const Ty, RankA>& t_a, const nd_span<const Ty, RankB>& t_b, const nd_span<Ty, RankC>& t_c )
+		{
+			ND_ARRAY_TRACE_SCOPE( "matmul" );
+			if( t_a.rank( ) < 2 || t_b.rank( ) < 2 || t_c.rank( ) < 2 )
+			{
+				throw std::invalid_argument( "matmul requires operands of rank 2 or more" );
+			}
+			if( t_a.rank( ) > t_c.rank( ) || t_b.rank( ) > t_c.rank( ) )
+			{
+				throw std::invalid_argument( "matmul operands have more batch dimensions than the result" );
+			}
+
+			const auto a = trailing_matrix( t_a );
+			const auto b = trailing_matrix( t_b );
+			const auto c = trailing_matrix( t_c );
+			if( a.rows != c.rows || b.cols != c.cols || a.cols != b.rows )
+			{
+				throw std::invalid_argument( "matmul extents do not match" );
+			}
+
+			const size_t batch = t_c.rank( ) - 2;
+			std::array<size_t, RankC> extents { };
+			size_t batch_count = 1;
+			for( size_t d = 0; d < t_c.rank( ); ++d )
+			{
+				extents[d] = t_c.extent( d );
+				batch_count *= d < batch ? extents[d] : 1;
+			}
+			const auto a_strides = batch_strides( t_a, extents, t_c.rank( ) );
+			const auto b_strides = batch_strides( t_b, extents, t_c.rank( ) );
+
+			// Matrix t_index of the batch, restricted to rows [t_first, t_last)
+			const auto multiply = [&]( size_t t_index, size_t t_first, size_t t_last, gemm_workspace<Ty>& t_workspace )
+			{
+				auto a_i = a;
+				auto b_i = b;
+				auto c_i = c;
+				for( size_t d = batch; d-- > 0; )
+				{
+					const auto i = static_cast<std::ptrdiff_t>( t_index % extents[d] );
+					t_index /= extents[d];
+					a_i.data += i * a_strides[d];
+					b_i.data += i * b_strides[d];
+					c_i.data += i * t_c.stride( d );
+				}
+				gemm( a_i.row_range( t_first, t_last ), b_i, c_i.row_range( t_first, t_last ), t_workspace );
+			};
+
+			if( batch_count > 1 )
+			{
+				run_rows( t_policy, batch_count,
+				          [&]( size_t t_first, size_t t_last )
+				          {
+					          gemm_workspace<Ty> workspace;
+					          for( size_t i = t_first; i < t_last; ++i )
+					          {
+						          multiply( i, 0, c.rows, workspace );
+					          }
+				          } );
+			}
+			else if( batch_count == 1 )
+			{
+				run_rows( t_policy, c.rows,
+				          [&]( size_t t_first, size_t t_last )
+				          {
+					          gemm_workspace<Ty> workspace;
+					          multiply( 0, t_first, t_last, workspace );
+				          } );
+			}
+		}
+
+		/// \brief y = A * x for a matrix A and vectors x, y
+		template<typename Policy, typename Ty, size_t RankA, size_t RankX, size_t RankY>
+		void matvec_spans( const Policy& t_policy, const nd_span<const Ty, RankA>& t_a, const nd_span<const Ty, RankX>& t_x, nd_span<Ty, RankY> t_y )
+		{
+			ND_ARRAY_TRACE_SCOPE( "matvec" );
+			if( t_a.rank( ) != 2 || t_x.rank( ) != 1 || t_y.rank( ) != 1 )
+			{
+				throw std::invalid_argument( "matvec requires a matrix and two vectors" );
+			}
+			const auto a = trailing_matrix( t_a );
+			if( t_x.extent( 0 ) != a.cols || t_y.extent( 0 ) != a.rows )
+			{
+				throw std::invalid_argument( "matvec extents do not match" );
+			}
+			const std::ptrdiff_t y_stride = t_y.stride( 0 );
+			run_rows( t_policy, a.rows,
+			          [&]( size_t t_first, size_t t_last )
+			          { gemv( a.row_range( t_first, t_last ), t_x.data( ), t_x.stride( 0 ), t_y.data( ) + static_cast<std::ptrdiff_t>( t_first ) * y_stride, y_stride ); } );
+		}
+
+		template<typename Ty, size_t MaxRank, typename Layout>
+		[[nodiscard]] nd_span<const Ty, MaxRank> linalg_operand( const nd_span<Ty, MaxRank, Layout>& t_span )
+		{
+			return as_const_span( t_span );
+		}
+
+		template<typename Ty, size_t MaxRank, typename Allocator, size_t InlineCapacity>
+		[[nodiscard]] nd_span<const Ty, MaxRank> linalg_operand( const nd_array<Ty, MaxRank, Allocator, InlineCapacity>& t_array ) noexcept
+		{
+			return t_array.as_span( );
+		}
+
+		template<typename Ty, size_t MaxRank, typename Layout>
+		[[nodiscard]] nd_span<Ty, MaxRank> linalg_target( nd_span<Ty, MaxRank, Layout> t_span ) noexcept
+		{
+			static_assert( !std::is_const_v<Ty>, "The result of a matrix product must be writable" );
+			std::array<size_t, MaxRank> extents { };
+			std::array<std::ptrdiff_t, MaxRank> strides { };
+			for( size_t i = 0; i < t_span.rank( ); ++i )
+			{
+				extents[i] = t_span.extent( i );
+				strides[i] = t_span.stride( i );
+			}
+			return nd_span<Ty, MaxRank>( t_span.data( ), extents, strides, t_span.rank( ) );
+		}
+
+		template<typename Ty, size_t MaxRank, typename Allocator, size_t InlineCapacity>
+		[[nodiscard]] nd_span<Ty, MaxRank> linalg_target( nd_array<Ty, MaxRank, Allocator, InlineCapacity>& t_array ) noexcept
+		{
+			return t_array.as_span( );
+		}
+
+		/// \brief Array type returned by the allocating matmul() and matvec()
+		template<typename Source>
+		using linalg_result_t = nd_array<std::remove_const_t<typename Source::value_type>, Source::max_rank( )>;
+
+		template<typename Policy, typename A, typename B, typename C>
+		inline constexpr bool is_linalg_call_v = is_execution_policy_v<Policy> && is_nd_container<A>::value && is_nd_container<B>::value &&
+		                                         is_nd_container<std::remove_cv_t<std::remove_reference_t<C>>>::value;
+	} // namespace detail
+
+	/// \brief Matrix product c = a * b over the last two dimensions, batched over the leading ones
+	/// \tparam Policy Execution policy (cppa::seq or cppa::par / parallel_policy)
+	/// \param t_a Left operand, extents [..., M, K]
+	/// \param t_b Right operand, extents [..., K, N]
+	/// \param t_c Result, extents [..., M, N]; an nd_array or a writable nd_span of any strides
+	/// \throws std::invalid_argument if a rank is below 2, the matrix extents do not match, or the batch
+	///         extents of an operand are neither equal to those of t_c nor 1
+	/// \note Operands with fewer dimensions than t_c are broadcast over the missing leading dimensions
+	template<typename Policy, typename A, typename B, typename C, std::enable_if_t<detail::is_linalg_call_v<Policy, A, B, C>, int> = 0>
+	void matmul( const Policy& t_policy, const A& t_a, const B& t_b, C&& t_c )
+	{
+		detail::matmul_spans( t_policy, detail::linalg_operand( t_a ), detail::linalg_operand( t_b ), detail::linalg_target( t_c ) );
+	}
+
+	/// \brief Matrix product c = a * b over the last two dimensions, batched over the leading ones
+	/// \param t_a Left operand, extents [..., M, K]
+	/// \param t_b Right operand, extents [..., K, N]
+	/// \param t_c Result, extents [..., M, N]
+	/// \throws std::invalid_argument if the extents do not match
+	template<typename A, typename B, typename C, std::enable_if_t<detail::is_linalg_call_v<sequential_policy, A, B, C>, int> = 0>
+	void matmul( const A& t_a, const B& t_b, C&& t_c )
+	{
+		matmul( seq, t_a, t_b, std::forward<C>( t_c ) );
+	}
+
+	/// \brief Matrix product of a and b into a new array
+	/// \param t_policy Execution policy
+	/// \param t_a Left operand, extents [..., M, K]
+	/// \param t_b Right operand, extents [..., K, N]
+	/// \return Array of extents [batch..., M, N], the batch extents broadcast from both operands
+	/// \throws std::invalid_argument if the extents do not match or the result rank exceeds MaxRank
+	template<typename Policy, typename A, typename B, std::enable_if_t<detail::is_linalg_call_v<Policy, A, B, A>, int> = 0>
+	[[nodiscard]] detail::linalg_result_t<A> matmul( const Policy& t_policy, const A& t_a, const B& t_b )
+	{
+		const auto a = detail::linalg_operand( t_a );
+		const auto b = detail::linalg_operand( t_b );
+		if( a.rank( ) < 2 || b.rank( ) < 2 )
+		{
+			throw std::invalid_argument( "matmul requires operands of rank 2 or more" );
+		}
+
+		const size_t rank = std::max( a.rank( ), b.rank( ) );
+		std::vector<size_t> extents( rank );
+		for( size_t d = 0; d + 2 < rank; ++d )
+		{
+			const size_t a_extent = d + a.rank( ) >= rank ? a.extent( d + a.rank( ) - rank ) : 1;
+			const size_t b_extent = d + b.rank( ) >= rank ? b.extent( d + b.rank( ) - rank ) : 1;
+			if( a_extent != b_extent && a_extent != 1 && b_extent != 1 )
+			{
+				throw std::invalid_argument( "matmul batch extents do not match" );
+			}
+			extents[d] = a_extent == 1 ? b_extent : a_extent;
+		}
+		extents[rank - 2] = a.extent( a.rank( ) - 2 );
+		extents[rank - 1] = b.extent( b.rank( ) - 1 );
+
+		detail::linalg_result_t<A> result( extents );
+		detail::matmul_spans( t_policy, a, b, result.as_span( ) );
+		return result;
+	}
+
+	/// \brief Matrix product of a and b into a new array
+	/// \param t_a Left operand, extents [..., M, K]
+	/// \param t_b Right operand, extents [..., K, N]
+	/// \return Array of extents [batch..., M, N]
+	/// \throws std::invalid_argument if the extents do not match
+	template<typename A, typename B, std::enable_if_t<detail::is_linalg_call_v<sequential_policy, A, B, A>, int> = 0>
+	[[nodiscard]] detail::linalg_result_t<A> matmul( const A& t_a, const B& t_b )
+	{
+		return matmul( seq, t_a, t_b );
+	}
+
+	/// \brief Matrix-vector product y = a * x
+	/// \tparam Policy Execution policy; cppa::par splits the rows of a across threads
+	/// \param t_a Matrix, extents [M, K], any strides
+	/// \param t_x Vector of extent K
+	/// \param t_y Result vector of extent M; an nd_array or a writable nd_span
+	/// \throws std::invalid_argument unless t_a has rank 2, t_x and t_y rank 1 and the extents match
+	template<typename Policy, typename A, typename X, typename Y, std::enable_if_t<detail::is_linalg_call_v<Policy, A, X, Y>, int> = 0>
+	void matvec( const Policy& t_policy, const A& t_a, const X& t_x, Y&& t_y )
+	{
+		detail::matvec_spans( t_policy, detail::linalg_operand( t_a ), detail::linalg_operand( t_x ), detail::linalg_target( t_y ) );
+	}
+
+	/// \brief Matrix-vector product y = a * x
+	/// \param t_a Matrix, extents [M, K]
+	/// \param t_x Vector of extent K
+	/// \param t_y Result vector of extent M
+	/// \throws std::invalid_argument if the ranks or extents do not match
+	template<typename A, typename X, typename Y, std::enable_if_t<detail::is_linalg_call_v<sequential_policy, A, X, Y>, int> = 0>
+	void matvec( const A& t_a, const X& t_x, Y&& t_y )
+	{
+		matvec( seq, t_a, t_x, std::forward<Y>( t_y ) );
+	}
+
+	/// \brief Matrix-vector product of a and x into a new vector
+	/// \param t_policy Execution policy
+	/// \param t_a Matrix, extents [M, K]
+	/// \param t_x Vector of extent K
+	/// \return Vector of extent M
+	/// \throws std::invalid_argument if the ranks or extents do not match
+	template<typename Policy, typename A, typename X, std::enable_if_t<detail::is_linalg_call_v<Policy, A, X, A>, int> = 0>
+	[[nodiscard]] detail::linalg_result_t<A> matvec( const Policy& t_policy, const A& t_a, const X& t_x )
+	{
+		const auto a = detail::linalg_operand( t_a );
+		if( a.rank( ) != 2 )
+		{
+			throw std::invalid_argument( "matvec requires a matrix and two vectors" );
+		}
+		detail::linalg_result_t<A> result( a.extent( 0 ) );
+		detail::matvec_spans( t_policy, a, detail::linalg_operand( t_x ), result.as_span( ) );
+		return result;
+	}
+
+	/// \brief Matrix-vector product of a and x into a new vector
+	/// \param t_a Matrix, extents [M, K]
+	/// \param t_x Vector of extent K
+	/// \return Vector of extent M
+	/// \throws std::invalid_argument if the ranks or extents do not match
+	template<typename A, typename X, std::enable_if_t<detail::is_linalg_call_v<sequential_policy, A, X, A>, int> = 0>
+	[[nodiscard]] detail::linalg_result_t<A> matvec( const A& t_a, const X& t_x )
+	{
+		return matvec( seq, t_a, t_x );
+	}
+} // namespace cppa
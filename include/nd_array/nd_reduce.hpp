@@ -0,0 +1,722 @@
+#pragma once
+
+#include "nd_array.hpp"
+
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+/// \file nd_reduce.hpp
+/// \brief Reductions of nd_span / nd_array along any set of axes
+///
+/// reduce() folds the elements along the given axes into an nd_array holding the remaining
+/// dimensions; sum(), prod(), min(), max(), mean(), argmin() and argmax() cover the common cases.
+/// The loop order follows the strides of the operand rather than its index order: dimensions are
+/// sorted by stride and merged where they nest, so the innermost loop always walks the smallest
+/// stride. When that dimension is reduced, each output folds the row with eight independent
+/// accumulators in pairwise blocks; when it is kept, whole rows of outputs are updated element by
+/// element. Both inner loops are unit-stride for contiguous data, so the compiler vectorizes them.
+///
+/// Floating-point sums are pairwise along the innermost dimension and Kahan-compensated when rows
+/// of outputs are accumulated, so the error does not grow with the number of reduced elements.
+/// With cppa::par the outermost kept dimension is split across threads, each writing its own outputs.
+///
+/// \code
+/// nd_array<float> image(480, 640);
+/// auto column_sums = cppa::sum(image, {0});               // extent 640
+/// auto row_means   = cppa::mean(cppa::par, image, {1});   // extent 480, rows split across threads
+/// auto brightest   = cppa::argmax(image, 1);              // column index of each row's maximum
+/// auto centered    = evaluate(image - row_means.expand_dims(1));  // with nd_expr.hpp
+/// \endcode
+///
+/// \note Reducing every axis yields an array of rank 1 and extent 1. Reducing an empty range yields
+///       the initial value (the identity of the built-in operations).
+
+namespace cppa
+{
+	/// \brief Sum reduction; the identity is 0
+	struct sum_op
+	{
+		template<typename Ty>
+		[[nodiscard]] static constexpr Ty identity( ) noexcept
+		{
+			return Ty( 0 );
+		}
+
+		template<typename Ty>
+		[[nodiscard]] constexpr Ty operator( )( const Ty& t_lhs, const Ty& t_rhs ) const
+		{
+			return t_lhs + t_rhs;
+		}
+	};
+
+	/// \brief Product reduction; the identity is 1
+	struct prod_op
+	{
+		template<typename Ty>
+		[[nodiscard]] static constexpr Ty identity( ) noexcept
+		{
+			return Ty( 1 );
+		}
+
+		template<typename Ty>
+		[[nodiscard]] constexpr Ty operator( )( const Ty& t_lhs, const Ty& t_rhs ) const
+		{
+			return t_lhs * t_rhs;
+		}
+	};
+
+	/// \brief Minimum reduction; the identity is +infinity, or the largest value for types without one
+	struct min_op
+	{
+		template<typename Ty>
+		[[nodiscard]] static constexpr Ty identity( ) noexcept
+		{
+			return std::numeric_limits<Ty>::has_infinity ? std::numeric_limits<Ty>::infinity( ) : std::numeric_limits<Ty>::max( );
+		}
+
+		template<typename Ty>
+		[[nodiscard]] constexpr Ty operator( )( const Ty& t_lhs, const Ty& t_rhs ) const
+		{
+			return t_rhs < t_lhs ? t_rhs : t_lhs;
+		}
+	};
+
+	/// \brief Maximum reduction; the identity is -infinity, or the lowest value for types without one
+	struct max_op
+	{
+		template<typename Ty>
+		[[nodiscard]] static constexpr Ty identity( ) noexcept
+		{
+			return std::numeric_limits<Ty>::has_infinity ? -std::numeric_limits<Ty>::infinity( ) : std::numeric_limits<Ty>::lowest( );
+		}
+
+		template<typename Ty>
+		[[nodiscard]] constexpr Ty operator( )( const Ty& t_lhs, const Ty& t_rhs ) const
+		{
+			return t_lhs < t_rhs ? t_rhs : t_lhs;
+		}
+	};
+
+	namespace detail
+	{
+		/// \brief One dimension of a reduction loop with its strides in the operand and in the output
+		struct reduce_dim
+		{
+			size_t extent;             ///< Number of indices
+			std::ptrdiff_t in_stride;  ///< Stride in the operand
+			std::ptrdiff_t out_stride; ///< Stride in the output, 0 along reduced dimensions
+		};
+
+		/// \brief Orders the dimensions of a reduction for the loop nest
+		/// \return Number of entries written to t_dims, outermost first; at least 1
+		///
+		/// Singleton dimensions are dropped and the rest sorted by decreasing operand stride magnitude, so
+		/// the innermost loop walks the smallest stride. Neighbours are merged when both the operand and
+		/// the output strides nest, which only merges reduced with reduced and kept with kept dimensions.
+		template<size_t MaxRank>
+		[[nodiscard]] size_t reduce_loop_dims( const std::array<size_t, MaxRank>& t_extents, const std::array<std::ptrdiff_t, MaxRank>& t_in_strides,
+		                                       const std::array<std::ptrdiff_t, MaxRank>& t_out_strides, size_t t_rank, std::array<reduce_dim, MaxRank>& t_dims )
+		{
+			const auto magnitude = []( std::ptrdiff_t t_stride ) { return t_stride < 0 ? -t_stride : t_stride; };
+
+			size_t count = 0;
+			for( size_t i = 0; i < t_rank; ++i )
+			{
+				if( t_extents[i] == 1 )
+					continue;
+				const reduce_dim dim { t_extents[i], t_in_strides[i], t_out_strides[i] };
+				size_t pos = count++;
+				while( pos > 0 && magnitude( t_dims[pos - 1].in_stride ) < magnitude( dim.in_stride ) )
+				{
+					t_dims[pos] = t_dims[pos - 1];
+					--pos;
+				}
+				t_dims[pos] = dim;
+			}
+
+			size_t merged = 0;
+			for( size_t k = 0; k < count; ++k )
+			{
+				const reduce_dim inner = t_dims[k];
+				if( merged > 0 )
+				{
+					reduce_dim& outer       = t_dims[merged - 1];
+					const auto inner_extent = static_cast<std::ptrdiff_t>( inner.extent );
+					const bool in_nested    = outer.in_stride == inner.in_stride * inner_extent;
+					const bool out_nested   = outer.out_stride == inner.out_stride * inner_extent;
+					if( in_nested && out_nested )
+					{
+						outer = { outer.extent * inner.extent, inner.in_stride, inner.out_stride };
+						continue;
+					}
+				}
+				t_dims[merged++] = inner;
+			}
+
+			if( merged == 0 )
+			{
+				t_dims[0] = { 1, 0, 0 };
+				merged    = 1;
+			}
+			return merged;
+		}
+
+		/// \brief Calls t_func( in_offset, out_offset, count ) for every row of the innermost loop dimension
+		/// \param t_dims Loop dimensions, outermost first
+		/// \param t_count Number of loop dimensions
+		/// \param t_split Dimension restricted to [t_first, t_last); all others are walked completely
+		template<size_t MaxRank, typename Func>
+		void for_each_reduce_row( const std::array<reduce_dim, MaxRank>& t_dims, size_t t_count, size_t t_split, size_t t_first, size_t t_last, Func&& t_func )
+		{
+			if( t_first >= t_last )
+			{
+				return;
+			}
+
+			std::array<size_t, MaxRank> first { };
+			std::array<size_t, MaxRank> last { };
+			for( size_t d = 0; d < t_count; ++d )
+			{
+				last[d] = t_dims[d].extent;
+			}
+			first[t_split] = t_first;
+			last[t_split]  = t_last;
+
+			const size_t inner                = t_count - 1;
+			std::array<size_t, MaxRank> index = first;
+			while( true )
+			{
+				std::ptrdiff_t in_offset  = 0;
+				std::ptrdiff_t out_offset = 0;
+				for( size_t d = 0; d < t_count; ++d )
+				{
+					in_offset += static_cast<std::ptrdiff_t>( index[d] ) * t_dims[d].in_stride;
+					out_offset += static_cast<std::ptrdiff_t>( index[d] ) * t_dims[d].out_stride;
+				}
+				t_func( in_offset, out_offset, last[inner] - first[inner] );
+
+				bool advanced = false;
+				for( size_t d = inner; d-- > 0; )
+				{
+					if( ++index[d] < last[d] )
+					{
+						advanced = true;
+						break;
+					}
+					index[d] = first[d];
+				}
+				if( !advanced )
+				{
+					return;
+				}
+			}
+		}
+
+		/// \brief Folds t_count >= 8 elements with eight independent accumulators combined pairwise
+		template<bool Contiguous, typename Result, typename Ty, typename Op>
+		[[nodiscard]] Result fold_lanes( const Ty* t_in, std::ptrdiff_t t_stride, size_t t_count, const Op& t_op )
+		{
+			constexpr size_t lanes      = 8;
+			const std::ptrdiff_t stride = Contiguous ? 1 : t_stride;
+
+			std::array<Result, lanes> acc;
+			for( size_t l = 0; l < lanes; ++l )
+			{
+				acc[l] = static_cast<Result>( t_in[static_cast<std::ptrdiff_t>( l ) * stride] );
+			}
+			size_t j = lanes;
+			for( ; j + lanes <= t_count; j += lanes )
+			{
+				for( size_t l = 0; l < lanes; ++l )
+				{
+					acc[l] = t_op( acc[l], static_cast<Result>( t_in[static_cast<std::ptrdiff_t>( j + l ) * stride] ) );
+				}
+			}
+			for( size_t width = lanes / 2; width > 0; width /= 2 )
+			{
+				for( size_t l = 0; l < width; ++l )
+				{
+					acc[l] = t_op( acc[l], acc[l + width] );
+				}
+			}
+
+			Result result = acc[0];
+			for( ; j < t_count; ++j )
+			{
+				result = t_op( result, static_cast<Result>( t_in[static_cast<std::ptrdiff_t>( j ) * stride] ) );
+			}
+			return result;
+		}
+
+		/// \brief Folds t_count >= 1 elements of a row with t_op, splitting long rows in halves (pairwise)
+		template<typename Result, typename Ty, typename Op>
+		[[nodiscard]] Result fold_row( const Ty* t_in, std::ptrdiff_t t_stride, size_t t_count, const Op& t_op )
+		{
+			constexpr size_t lanes = 8;
+			constexpr size_t block = 128;
+			if( t_count > block )
+			{
+				const size_t half = t_count / 2 / lanes * lanes;
+				return t_op( fold_row<Result>( t_in, t_stride, half, t_op ),
+				             fold_row<Result>( t_in + static_cast<std::ptrdiff_t>( half ) * t_stride, t_stride, t_count - half, t_op ) );
+			}
+			if( t_count >= lanes )
+			{
+				return t_stride == 1 ? fold_lanes<true, Result>( t_in, t_stride, t_count, t_op ) : fold_lanes<false, Result>( t_in, t_stride, t_count, t_op );
+			}
+
+			Result result = static_cast<Result>( t_in[0] );
+			for( size_t j = 1; j < t_count; ++j )
+			{
+				result = t_op( result, static_cast<Result>( t_in[static_cast<std::ptrdiff_t>( j ) * t_stride] ) );
+			}
+			return result;
+		}
+
+		/// \brief Combines a row of operand elements into a row of outputs, element by element
+		template<bool Contiguous, typename Result, typename Ty, typename Op>
+		void accumulate_row( Result* t_out, std::ptrdiff_t t_out_stride, const Ty* t_in, std::ptrdiff_t t_in_stride, size_t t_count, const Op& t_op )
+		{
+			const std::ptrdiff_t out_stride = Contiguous ? 1 : t_out_stride;
+			const std::ptrdiff_t in_stride  = Contiguous ? 1 : t_in_stride;
+			for( size_t j = 0; j < t_count; ++j )
+			{
+				Result& out = t_out[static_cast<std::ptrdiff_t>( j ) * out_stride];
+				out         = t_op( out, static_cast<Result>( t_in[static_cast<std::ptrdiff_t>( j ) * in_stride] ) );
+			}
+		}
+
+		/// \brief Adds a row of operand elements to a row of outputs with Kahan compensation
+		/// \param t_comp Running compensation of each output, at the same offsets as t_out
+		template<bool Contiguous, typename Result, typename Ty>
+		void accumulate_row_compensated( Result* t_out, Result* t_comp, std::ptrdiff_t t_out_stride, const Ty* t_in, std::ptrdiff_t t_in_stride, size_t t_count )
+		{
+			const std::ptrdiff_t out_stride = Contiguous ? 1 : t_out_stride;
+			const std::ptrdiff_t in_stride  = Contiguous ? 1 : t_in_stride;
+			for( size_t j = 0; j < t_count; ++j )
+			{
+				const std::ptrdiff_t at = static_cast<std::ptrdiff_t>( j ) * out_stride;
+				const Result value      = static_cast<Result>( t_in[static_cast<std::ptrdiff_t>( j ) * in_stride] ) - t_comp[at];
+				const Result sum        = t_out[at] + value;
+				t_comp[at]              = ( sum - t_out[at] ) - value;
+				t_out[at]               = sum;
+			}
+		}
+
+		/// \brief Result shape of a reduction: the kept extents in order, or {1} if every axis is reduced
+		/// \throws std::out_of_range if an axis is not below the rank
+		/// \throws std::invalid_argument if an axis is listed twice
+		template<size_t MaxRank, typename Span>
+		[[nodiscard]] std::vector<size_t> reduced_extents( const Span& t_src, std::initializer_list<size_t> t_axes, std::array<bool, MaxRank>& t_reduced )
+		{
+			t_reduced = { };
+			for( const size_t axis: t_axes )
+			{
+				if( axis >= t_src.rank( ) )
+				{
+					throw std::out_of_range( "Reduction axis out of range" );
+				}
+				if( t_reduced[axis] )
+				{
+					throw std::invalid_argument( "Duplicate reduction axis" );
+				}
+				t_reduced[axis] = true;
+			}
+
+			std::vector<size_t> extents;
+			for( size_t i = 0; i < t_src.rank( ); ++i )
+			{
+				if( !t_reduced[i] )
+				{
+					extents.push_back( t_src.extent( i ) );
+				}
+			}
+			if( extents.empty( ) )
+			{
+				extents.push_back( 1 );
+			}
+			return extents;
+		}
+
+		/// \brief Folds the elements of t_src along t_axes into a new array initialized with t_init
+		template<typename Policy, typename Ty, size_t MaxRank, typename Result, typename Op>
+		[[nodiscard]] nd_array<Result, MaxRank> reduce_axes( const Policy& t_policy, const nd_span<const Ty, MaxRank>& t_src, std::initializer_list<size_t> t_axes,
+		                                                     const Result& t_init, const Op& t_op )
+		{
+			ND_ARRAY_TRACE_SCOPE( "reduce" );
+			std::array<bool, MaxRank> reduced;
+			nd_array<Result, MaxRank> result( reduced_extents<MaxRank>( t_src, t_axes, reduced ) );
+			result.fill( t_init );
+			if( t_src.size( ) == 0 )
+			{
+				return result;
+			}
+
+			std::array<size_t, MaxRank> extents { };
+			std::array<std::ptrdiff_t, MaxRank> in_strides { };
+			std::array<std::ptrdiff_t, MaxRank> out_strides { };
+			for( size_t i = 0, k = 0; i < t_src.rank( ); ++i )
+			{
+				extents[i]     = t_src.extent( i );
+				in_strides[i]  = t_src.stride( i );
+				out_strides[i] = reduced[i] ? 0 : result.stride( k++ );
+			}
+			std::array<reduce_dim, MaxRank> dims;
+			const size_t count     = reduce_loop_dims<MaxRank>( extents, in_strides, out_strides, t_src.rank( ), dims );
+			const reduce_dim inner = dims[count - 1];
+
+			// Rows of outputs accumulate one element per reduced index, so float sums carry a compensation term
+			constexpr bool compensated = std::is_floating_point_v<Result> && std::is_same_v<Op, sum_op>;
+			const bool inner_reduced   = inner.out_stride == 0;
+			std::vector<Result> compensation( compensated && !inner_reduced ? result.size( ) : 0 );
+
+			const Ty* in    = t_src.data( );
+			Result* out     = result.data( );
+			Result* comp    = compensation.data( );
+			const bool unit = inner.in_stride == 1 && inner.out_stride == 1;
+			const auto row  = [&]( std::ptrdiff_t t_in_offset, std::ptrdiff_t t_out_offset, size_t t_count )
+			{
+				if( inner_reduced )
+				{
+					Result& target = out[t_out_offset];
+					target         = t_op( target, fold_row<Result>( in + t_in_offset, inner.in_stride, t_count, t_op ) );
+				}
+				else if constexpr( compensated )
+				{
+					if( unit )
+					{
+						accumulate_row_compensated<true>( out + t_out_offset, comp + t_out_offset, 1, in + t_in_offset, 1, t_count );
+					}
+					else
+					{
+						accumulate_row_compensated<false>( out + t_out_offset, comp + t_out_offset, inner.out_stride, in + t_in_offset, inner.in_stride, t_count );
+					}
+				}
+				else if( unit )
+				{
+					accumulate_row<true>( out + t_out_offset, 1, in + t_in_offset, 1, t_count, t_op );
+				}
+				else
+				{
+					accumulate_row<false>( out + t_out_offset, inner.out_stride, in + t_in_offset, inner.in_stride, t_count, t_op );
+				}
+			};
+
+			// Threads split the outermost kept dimension, so no two threads write the same output
+			size_t split = count;
+			for( size_t d = 0; d < count; ++d )
+			{
+				if( dims[d].out_stride != 0 )
+				{
+					split = d;
+					break;
+				}
+			}
+			if( split == count )
+			{
+				simd_dispatch( [&] { for_each_reduce_row( dims, count, 0, 0, dims[0].extent, row ); } );
+			}
+			else
+			{
+				run_rows( t_policy, dims[split].extent,
+				          [&]( size_t t_first, size_t t_last ) { for_each_reduce_row( dims, count, split, t_first, t_last, row ); } );
+			}
+
+			for( size_t i = 0; i < compensation.size( ); ++i )
+			{
+				out[i] -= comp[i];
+			}
+			return result;
+		}
+
+		/// \brief Index along t_axis of the element each output position prefers under t_better
+		/// \throws std::out_of_range if t_axis is not below the rank
+		/// \throws std::invalid_argument if the axis is empty and there are outputs
+		template<typename Policy, typename Ty, size_t MaxRank, typename Better>
+		[[nodiscard]] nd_array<size_t, MaxRank> arg_reduce_axis( const Policy& t_policy, const nd_span<const Ty, MaxRank>& t_src, size_t t_axis, Better t_better )
+		{
+			std::array<bool, MaxRank> reduced;
+			nd_array<size_t, MaxRank> result( reduced_extents<MaxRank>( t_src, { t_axis }, reduced ) );
+			if( result.size( ) == 0 || t_src.size( ) == 0 )
+			{
+				if( result.size( ) != 0 )
+				{
+					throw std::invalid_argument( "Cannot reduce an empty axis without an initial value" );
+				}
+				return result;
+			}
+
+			// Positions of the outputs are the elements of the first slab, in the order of the result
+			const auto slab             = t_src.subspan( t_axis, { 0, 1 } );
+			const size_t length         = t_src.extent( t_axis );
+			const std::ptrdiff_t stride = t_src.stride( t_axis );
+			const auto magnitude        = []( std::ptrdiff_t t_stride ) { return t_stride < 0 ? -t_stride : t_stride; };
+			bool axis_is_innermost      = true;
+			for( size_t i = 0; i < t_src.rank( ); ++i )
+			{
+				if( i != t_axis && t_src.extent( i ) > 1 && magnitude( t_src.stride( i ) ) < magnitude( stride ) )
+				{
+					axis_is_innermost = false;
+				}
+			}
+
+			size_t* indices = result.data( );
+			if( axis_is_innermost )
+			{
+				// Each output scans its own row along the axis
+				run_rows( t_policy, result.size( ),
+				          [&]( size_t t_first, size_t t_last )
+				          {
+					          auto it = slab.begin( ) + static_cast<std::ptrdiff_t>( t_first );
+					          for( size_t i = t_first; i < t_last; ++i, ++it )
+					          {
+						          const Ty* row = &*it;
+						          size_t best   = 0;
+						          for( size_t k = 1; k < length; ++k )
+						          {
+							          if( t_better( row[static_cast<std::ptrdiff_t>( k ) * stride], row[static_cast<std::ptrdiff_t>( best ) * stride] ) )
+							          {
+								          best = k;
+							          }
+						          }
+						          indices[i] = best;
+					          }
+				          } );
+				return result;
+			}
+
+			// The axis is an outer loop: compare whole slabs against the running best values
+			std::vector<std::remove_const_t<Ty>> best( result.size( ) );
+			std::copy( slab.begin( ), slab.end( ), best.begin( ) );
+			run_rows( t_policy, result.size( ),
+			          [&]( size_t t_first, size_t t_last )
+			          {
+				          for( size_t k = 1; k < length; ++k )
+				          {
+					          auto it = t_src.subspan( t_axis, { k, k + 1 } ).begin( ) + static_cast<std::ptrdiff_t>( t_first );
+					          for( size_t i = t_first; i < t_last; ++i, ++it )
+					          {
+						          if( t_better( *it, best[i] ) )
+						          {
+							          best[i]    = *it;
+							          indices[i] = k;
+						          }
+					          }
+				          }
+			          } );
+			return result;
+		}
+
+		template<typename Ty, size_t MaxRank, typename Layout>
+		[[nodiscard]] nd_span<const Ty, MaxRank> reduce_operand( const nd_span<Ty, MaxRank, Layout>& t_span )
+		{
+			return as_const_span( t_span );
+		}
+
+		template<typename Ty, size_t MaxRank, typename Allocator, size_t InlineCapacity>
+		[[nodiscard]] nd_span<const Ty, MaxRank> reduce_operand( const nd_array<Ty, MaxRank, Allocator, InlineCapacity>& t_array ) noexcept
+		{
+			return t_array.as_span( );
+		}
+
+		/// \brief Element type of a reduction operand
+		template<typename Source>
+		using reduce_element_t = std::remove_const_t<typename Source::value_type>;
+
+		/// \brief Array type returned by reducing Source into Result elements
+		template<typename Source, typename Result>
+		using reduce_result_t = nd_array<Result, Source::max_rank( )>;
+
+		/// \brief Element type of mean(): floating-point inputs keep their type, others use double
+		template<typename Ty>
+		using mean_t = std::conditional_t<std::is_floating_point_v<Ty>, Ty, double>;
+
+		template<typename Policy, typename Source>
+		inline constexpr bool is_policy_and_operand_v = is_execution_policy_v<Policy> && is_nd_container<Source>::value;
+	} // namespace detail
+
+	/// \brief Folds the elements along t_axes into an array of the remaining dimensions
+	/// \tparam Policy Execution policy (cppa::seq or cppa::par / parallel_policy)
+	/// \param t_src Operand (nd_span or nd_array, any strides)
+	/// \param t_axes Dimensions to reduce, each listed at most once
+	/// \param t_init Initial value of every output, also fixing the result element type
+	/// \param t_op Associative binary operation on the result type (the grouping of operands is unspecified)
+	/// \return Array with the reduced dimensions removed, in their original order
+	/// \throws std::out_of_range if an axis is not below the rank
+	/// \throws std::invalid_argument if an axis is listed twice
+	/// \example
+	/// \code
+	/// auto norms = cppa::reduce(cppa::par, points, {1}, 0.0, [](double a, double b) { return std::hypot(a, b); });
+	/// \endcode
+	template<typename Policy, typename Source, typename Init, typename Op, std::enable_if_t<detail::is_policy_and_operand_v<Policy, Source>, int> = 0>
+	[[nodiscard]] detail::reduce_result_t<Source, Init> reduce( const Policy& t_policy, const Source& t_src, std::initializer_list<size_t> t_axes, Init t_init, Op t_op )
+	{
+		return detail::reduce_axes( t_policy, detail::reduce_operand( t_src ), t_axes, t_init, t_op );
+	}
+
+	/// \brief Folds the elements along t_axes into an array of the remaining dimensions
+	/// \param t_src Operand (nd_span or nd_array, any strides)
+	/// \param t_axes Dimensions to reduce, each listed at most once
+	/// \param t_init Initial value of every output, also fixing the result element type
+	/// \param t_op Associative binary operation on the result type
+	/// \return Array with the reduced dimensions removed, in their original order
+	/// \throws std::out_of_range if an axis is not below the rank
+	/// \throws std::invalid_argument if an axis is listed twice
+	template<typename Source, typename Init, typename Op, std::enable_if_t<detail::is_nd_container<Source>::value, int> = 0>
+	[[nodiscard]] detail::reduce_result_t<Source, Init> reduce( const Source& t_src, std::initializer_list<size_t> t_axes, Init t_init, Op t_op )
+	{
+		return detail::reduce_axes( seq, detail::reduce_operand( t_src ), t_axes, t_init, t_op );
+	}
+
+	/// \brief Folds the elements along t_axes with a built-in operation (sum_op, prod_op, min_op, max_op)
+	/// \param t_policy Execution policy
+	/// \param t_src Operand (nd_span or nd_array, any strides)
+	/// \param t_axes Dimensions to reduce, each listed at most once
+	/// \param t_op Operation providing identity<Ty>(), used as the initial value
+	/// \return Array of the element type with the reduced dimensions removed
+	template<typename Policy, typename Source, typename Op, std::enable_if_t<detail::is_policy_and_operand_v<Policy, Source>, int> = 0>
+	[[nodiscard]] detail::reduce_result_t<Source, detail::reduce_element_t<Source>> reduce( const Policy& t_policy, const Source& t_src, std::initializer_list<size_t> t_axes,
+	                                                                                          Op t_op )
+	{
+		using value_type = detail::reduce_element_t<Source>;
+		return detail::reduce_axes( t_policy, detail::reduce_operand( t_src ), t_axes, Op::template identity<value_type>( ), t_op );
+	}
+
+	/// \brief Folds the elements along t_axes with a built-in operation (sum_op, prod_op, min_op, max_op)
+	/// \param t_src Operand (nd_span or nd_array, any strides)
+	/// \param t_axes Dimensions to reduce, each listed at most once
+	/// \param t_op Operation providing identity<Ty>(), used as the initial value
+	/// \return Array of the element type with the reduced dimensions removed
+	template<typename Source, typename Op, std::enable_if_t<detail::is_nd_container<Source>::value, int> = 0>
+	[[nodiscard]] detail::reduce_result_t<Source, detail::reduce_element_t<Source>> reduce( const Source& t_src, std::initializer_list<size_t> t_axes, Op t_op )
+	{
+		return reduce( seq, t_src, t_axes, t_op );
+	}
+
+	/// \brief Sum along t_axes (pairwise / compensated for floating-point elements)
+	template<typename Policy, typename Source, std::enable_if_t<detail::is_policy_and_operand_v<Policy, Source>, int> = 0>
+	[[nodiscard]] auto sum( const Policy& t_policy, const Source& t_src, std::initializer_list<size_t> t_axes )
+	{
+		return reduce( t_policy, t_src, t_axes, sum_op { } );
+	}
+
+	/// \brief Sum along t_axes (pairwise / compensated for floating-point elements)
+	template<typename Source, std::enable_if_t<detail::is_nd_container<Source>::value, int> = 0>
+	[[nodiscard]] auto sum( const Source& t_src, std::initializer_list<size_t> t_axes )
+	{
+		return reduce( seq, t_src, t_axes, sum_op { } );
+	}
+
+	/// \brief Product along t_axes
+	template<typename Policy, typename Source, std::enable_if_t<detail::is_policy_and_operand_v<Policy, Source>, int> = 0>
+	[[nodiscard]] auto prod( const Policy& t_policy, const Source& t_src, std::initializer_list<size_t> t_axes )
+	{
+		return reduce( t_policy, t_src, t_axes, prod_op { } );
+	}
+
+	/// \brief Product along t_axes
+	template<typename Source, std::enable_if_t<detail::is_nd_container<Source>::value, int> = 0>
+	[[nodiscard]] auto prod( const Source& t_src, std::initializer_list<size_t> t_axes )
+	{
+		return reduce( seq, t_src, t_axes, prod_op { } );
+	}
+
+	/// \brief Minimum along t_axes
+	template<typename Policy, typename Source, std::enable_if_t<detail::is_policy_and_operand_v<Policy, Source>, int> = 0>
+	[[nodiscard]] auto min( const Policy& t_policy, const Source& t_src, std::initializer_list<size_t> t_axes )
+	{
+		return reduce( t_policy, t_src, t_axes, min_op { } );
+	}
+
+	/// \brief Minimum along t_axes
+	template<typename Source, std::enable_if_t<detail::is_nd_container<Source>::value, int> = 0>
+	[[nodiscard]] auto min( const Source& t_src, std::initializer_list<size_t> t_axes )
+	{
+		return reduce( seq, t_src, t_axes, min_op { } );
+	}
+
+	/// \brief Maximum along t_axes
+	template<typename Policy, typename Source, std::enable_if_t<detail::is_policy_and_operand_v<Policy, Source>, int> = 0>
+	[[nodiscard]] auto max( const Policy& t_policy, const Source& t_src, std::initializer_list<size_t> t_axes )
+	{
+		return reduce( t_policy, t_src, t_axes, max_op { } );
+	}
+
+	/// \brief Maximum along t_axes
+	template<typename Source, std::enable_if_t<detail::is_nd_container<Source>::value, int> = 0>
+	[[nodiscard]] auto max( const Source& t_src, std::initializer_list<size_t> t_axes )
+	{
+		return reduce( seq, t_src, t_axes, max_op { } );
+	}
+
+	/// \brief Arithmetic mean along t_axes; integer elements are averaged in double
+	/// \note The mean over an empty range is NaN.
+	template<typename Policy, typename Source, std::enable_if_t<detail::is_policy_and_operand_v<Policy, Source>, int> = 0>
+	[[nodiscard]] auto mean( const Policy& t_policy, const Source& t_src, std::initializer_list<size_t> t_axes )
+	{
+		using result_type = detail::mean_t<detail::reduce_element_t<Source>>;
+		auto result       = reduce( t_policy, t_src, t_axes, result_type( 0 ), sum_op { } );
+
+		size_t count = 1;
+		for( const size_t axis: t_axes )
+		{
+			count *= t_src.extent( axis );
+		}
+		const auto divisor = static_cast<result_type>( count );
+		for( auto& value: result )
+		{
+			value /= divisor;
+		}
+		return result;
+	}
+
+	/// \brief Arithmetic mean along t_axes; integer elements are averaged in double
+	template<typename Source, std::enable_if_t<detail::is_nd_container<Source>::value, int> = 0>
+	[[nodiscard]] auto mean( const Source& t_src, std::initializer_list<size_t> t_axes )
+	{
+		return mean( seq, t_src, t_axes );
+	}
+
+	/// \brief Index of the first maximum along one axis
+	/// \param t_policy Execution policy, splitting the output positions across threads
+	/// \param t_src Operand (nd_span or nd_array, any strides)
+	/// \param t_axis Dimension to search
+	/// \return Array of indices with t_axis removed
+	/// \throws std::out_of_range if t_axis is not below the rank
+	/// \throws std::invalid_argument if t_axis is empty
+	template<typename Policy, typename Source, std::enable_if_t<detail::is_policy_and_operand_v<Policy, Source>, int> = 0>
+	[[nodiscard]] detail::reduce_result_t<Source, size_t> argmax( const Policy& t_policy, const Source& t_src, size_t t_axis )
+	{
+		return detail::arg_reduce_axis( t_policy, detail::reduce_operand( t_src ), t_axis, std::greater<>( ) );
+	}
+
+	/// \brief Index of the first maximum along one axis
+	template<typename Source, std::enable_if_t<detail::is_nd_container<Source>::value, int> = 0>
+	[[nodiscard]] detail::reduce_result_t<Source, size_t> argmax( const Source& t_src, size_t t_axis )
+	{
+		return detail::arg_reduce_axis( seq, detail::reduce_operand( t_src ), t_axis, std::greater<>( ) );
+	}
+
+	/// \brief Index of the first minimum along one axis
+	/// \param t_policy Execution policy, splitting the output positions across threads
+	/// \param t_src Operand (nd_span or nd_array, any strides)
+	/// \param t_axis Dimension to search
+	/// \return Array of indices with t_axis removed
+	/// \throws std::out_of_range if t_axis is not below the rank
+	/// \throws std::invalid_argument if t_axis is empty
+	template<typename Policy, typename Source, std::enable_if_t<detail::is_policy_and_operand_v<Policy, Source>, int> = 0>
+	[[nodiscard]] detail::reduce_result_t<Source, size_t> argmin( const Policy& t_policy, const Source& t_src, size_t t_axis )
+	{
+		return detail::arg_reduce_axis( t_policy, detail::reduce_operand( t_src ), t_axis, std::less<>( ) );
+	}
+
+	/// \brief Index of the first minimum along one axis
+	template<typename Source, std::enable_if_t<detail::is_nd_container<Source>::value, int> = 0>
+	[[nodiscard]] detail::reduce_result_t<Source, size_t> argmin( const Source& t_src, size_t t_axis )
+	{
+		return detail::arg_reduce_axis( seq, detail::reduce_operand( t_src ), t_axis, std::less<>( ) );
+	}
+} // namespace cppa
@@ -0,0 +1,610 @@
+#pragma once
+
+#include "nd_io.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined( ND_ARRAY_USE_LZ4 )
+#	include <lz4.h>
+#endif
+#if defined( ND_ARRAY_USE_ZSTD )
+#	include <zstd.h>
+#endif
+#if defined( ND_ARRAY_USE_ZLIB )
+#	include <zlib.h>
+#endif
+
+/// \file nd_serialize.hpp
+/// \brief Compact, versioned binary serialization of nd_span with zero-copy reading and block compression
+///
+/// serialize() writes a small header (element type, rank, extents and, for column-major views, strides)
+/// followed by the elements. Any view can be written: non-contiguous ones are gathered block-wise on the
+/// fly, never materialized as a whole. view_serialized() returns an nd_span directly over a received
+/// buffer, so reading a message costs a header check and no copy. Passing a block codec compresses the
+/// elements in independent blocks; such payloads are read back with deserialize().
+///
+/// \code
+/// std::ostringstream message;
+/// cppa::serialize(message, activations.T());  // Column-major view, written as is with its strides
+/// socket.send(message.str());
+///
+/// // Receiver: the view points into the buffer, which must outlive it
+/// auto view = cppa::view_serialized<const float>(buffer.data(), buffer.size());
+///
+/// cppa::serialize(message, activations.as_span(), cppa::lz4_codec{});  // Needs ND_ARRAY_USE_LZ4
+/// auto copy = cppa::deserialize<float>(buffer.data(), buffer.size(), cppa::lz4_codec{});
+/// \endcode
+///
+/// Layout, all integers little-endian:
+///
+/// | Offset | Size      | Field                                                              |
+/// |--------|-----------|--------------------------------------------------------------------|
+/// | 0      | 4         | Magic `NDSB`                                                       |
+/// | 4      | 1         | Format version (1)                                                 |
+/// | 5      | 1         | Element kind: `b`ool, `i`nt, `u`nsigned or `f`loat, as in .npy     |
+/// | 6      | 1         | Element size in bytes                                              |
+/// | 7      | 1         | Rank                                                               |
+/// | 8      | 1         | Flags; bit 0: strides follow the extents                           |
+/// | 9      | 1         | Codec id; 0 for uncompressed elements                              |
+/// | 10     | 2         | Reserved, 0                                                        |
+/// | 12     | 4         | Header size; the elements start there, on a 64-byte boundary       |
+/// | 16     | 8         | Size of the uncompressed elements in bytes                         |
+/// | 24     | 8 * rank  | Extents                                                            |
+/// |        | 8 * rank  | Element strides, if flagged; otherwise the elements are row-major  |
+///
+/// Compressed elements are stored as a sequence of blocks, each a 4-byte stored size, a 4-byte raw size
+/// and the stored bytes. Blocks the codec cannot shrink are stored raw (stored size == raw size).
+///
+/// A block codec is any type providing:
+/// \code
+/// struct my_codec {
+///     static constexpr std::uint8_t id = 200;  // Written to the header; ids below 128 are reserved
+///     size_t bound(size_t t_size) const;       // Largest compressed size of t_size bytes
+///     // Compresses into t_dst and returns the compressed size, or 0 if the data did not fit
+///     size_t compress(const std::byte* t_src, size_t t_size, std::byte* t_dst, size_t t_capacity) const;
+///     // Restores exactly t_raw_size bytes into t_dst; throws std::runtime_error on corrupt input
+///     void decompress(const std::byte* t_src, size_t t_size, std::byte* t_dst, size_t t_raw_size) const;
+/// };
+/// \endcode
+///
+/// \note Like the .npy functions, elements are stored in host byte order, which must be little-endian.
+
+namespace cppa
+{
+	/// \brief Fields of a serialized header, as returned by read_serial_header()
+	struct serial_info
+	{
+		char kind           = 0;             ///< Element kind: 'b', 'i', 'u' or 'f'
+		size_t element_size = 0;             ///< Size of one element in bytes
+		std::vector<size_t> extents;         ///< Extents of the stored array
+		std::vector<std::ptrdiff_t> strides; ///< Element strides, empty for row-major elements
+		std::uint8_t codec  = 0;             ///< Codec id, 0 if the elements are not compressed
+		size_t data_offset  = 0;             ///< Offset of the elements (or first block) from the buffer start
+		size_t data_bytes   = 0;             ///< Size of the uncompressed elements in bytes
+
+		/// \brief Returns the number of dimensions
+		[[nodiscard]] size_t rank( ) const noexcept { return extents.size( ); }
+
+		/// \brief Returns true if the elements are stored in compressed blocks
+		[[nodiscard]] bool compressed( ) const noexcept { return codec != 0; }
+	};
+
+#if defined( ND_ARRAY_USE_LZ4 )
+	/// \brief LZ4 block codec, available with ND_ARRAY_USE_LZ4; fast, moderate ratio
+	struct lz4_codec
+	{
+		static constexpr std::uint8_t id = 1;
+
+		[[nodiscard]] size_t bound( size_t t_size ) const { return static_cast<size_t>( LZ4_compressBound( static_cast<int>( t_size ) ) ); }
+
+		[[nodiscard]] size_t compress( const std::byte* t_src, size_t t_size, std::byte* t_dst, size_t t_capacity ) const
+		{
+			const int size = LZ4_compress_default( reinterpret_cast<const char*>( t_src ), reinterpret_cast<char*>( t_dst ), static_cast<int>( t_size ),
+			                                       static_cast<int>( t_capacity ) );
+			return size > 0 ? static_cast<size_t>( size ) : 0;
+		}
+
+		void decompress( const std::byte* t_src, size_t t_size, std::byte* t_dst, size_t t_raw_size ) const
+		{
+			const int size = LZ4_decompress_safe( reinterpret_cast<const char*>( t_src ), reinterpret_cast<char*>( t_dst ), static_cast<int>( t_size ),
+			                                      static_cast<int>( t_raw_size ) );
+			if( size < 0 || static_cast<size_t>( size ) != t_raw_size )
+				throw std::runtime_error( "Corrupt LZ4 block" );
+		}
+	};
+#endif
+
+#if defined( ND_ARRAY_USE_ZSTD )
+	/// \brief Zstandard block codec, available with ND_ARRAY_USE_ZSTD; higher ratio at a tunable cost
+	struct zstd_codec
+	{
+		static constexpr std::uint8_t id = 2;
+
+		int level = 3; ///< Compression level, 1 (fastest) to ZSTD_maxCLevel()
+
+		[[nodiscard]] size_t bound( size_t t_size ) const { return ZSTD_compressBound( t_size ); }
+
+		[[nodiscard]] size_t compress( const std::byte* t_src, size_t t_size, std::byte* t_dst, size_t t_capacity ) const
+		{
+			const size_t size = ZSTD_compress( t_dst, t_capacity, t_src, t_size, level );
+			return ZSTD_isError( size ) ? 0 : size;
+		}
+
+		void decompress( const std::byte* t_src, size_t t_size, std::byte* t_dst, size_t t_raw_size ) const
+		{
+			const size_t size = ZSTD_decompress( t_dst, t_raw_size, t_src, t_size );
+			if( ZSTD_isError( size ) || size != t_raw_size )
+				throw std::runtime_error( "Corrupt zstd block" );
+		}
+	};
+#endif
+
+#if defined( ND_ARRAY_USE_ZLIB )
+	/// \brief Deflate block codec, available with ND_ARRAY_USE_ZLIB
+	struct zlib_codec
+	{
+		static constexpr std::uint8_t id = 3;
+
+		int level = Z_DEFAULT_COMPRESSION; ///< Compression level, 1 (fastest) to 9
+
+		[[nodiscard]] size_t bound( size_t t_size ) const { return static_cast<size_t>( compressBound( static_cast<uLong>( t_size ) ) ); }
+
+		[[nodiscard]] size_t compress( const std::byte* t_src, size_t t_size, std::byte* t_dst, size_t t_capacity ) const
+		{
+			auto size = static_cast<uLongf>( t_capacity );
+			if( compress2( reinterpret_cast<Bytef*>( t_dst ), &size, reinterpret_cast<const Bytef*>( t_src ), static_cast<uLong>( t_size ), level ) != Z_OK )
+				return 0;
+			return static_cast<size_t>( size );
+		}
+
+		void decompress( const std::byte* t_src, size_t t_size, std::byte* t_dst, size_t t_raw_size ) const
+		{
+			auto size = static_cast<uLongf>( t_raw_size );
+			if( uncompress( reinterpret_cast<Bytef*>( t_dst ), &size, reinterpret_cast<const Bytef*>( t_src ), static_cast<uLong>( t_size ) ) != Z_OK ||
+			    size != t_raw_size )
+				throw std::runtime_error( "Corrupt deflate block" );
+		}
+	};
+#endif
+
+	namespace detail
+	{
+		inline constexpr char serial_magic[4]       = { 'N', 'D', 'S', 'B' };
+		inline constexpr std::uint8_t serial_version = 1;
+		inline constexpr size_t serial_fixed_bytes   = 24;
+		inline constexpr size_t serial_alignment     = 64;
+		inline constexpr std::uint8_t serial_strided = 1;
+
+		/// \brief Codec placeholder for reading without a codec; compressed payloads are rejected before use
+		struct no_codec
+		{
+			static constexpr std::uint8_t id = 0;
+
+			void decompress( const std::byte* /*t_src*/, size_t /*t_size*/, std::byte* /*t_dst*/, size_t /*t_raw_size*/ ) const {}
+		};
+
+		/// \brief Stores the low t_bytes bytes of t_value little-endian at t_dst
+		inline void store_le( std::byte* t_dst, std::uint64_t t_value, size_t t_bytes ) noexcept
+		{
+			for( size_t i = 0; i < t_bytes; ++i )
+				t_dst[i] = static_cast<std::byte>( ( t_value >> ( 8 * i ) ) & 0xFF );
+		}
+
+		/// \brief Loads a t_bytes-byte little-endian integer from t_src
+		[[nodiscard]] inline std::uint64_t load_le( const std::byte* t_src, size_t t_bytes ) noexcept
+		{
+			std::uint64_t value = 0;
+			for( size_t i = 0; i < t_bytes; ++i )
+				value |= static_cast<std::uint64_t>( t_src[i] ) << ( 8 * i );
+			return value;
+		}
+
+		/// \brief Writes a little-endian integer of t_bytes bytes to t_out
+		inline void write_le( std::ostream& t_out, std::uint64_t t_value, size_t t_bytes )
+		{
+			std::byte bytes[8];
+			store_le( bytes, t_value, t_bytes );
+			t_out.write( reinterpret_cast<const char*>( bytes ), static_cast<std::streamsize>( t_bytes ) );
+		}
+
+		/// \brief Writes the header of t_span and passes its element bytes, in stored order, to t_sink
+		template<typename Ty, size_t MaxRank, typename Sink>
+		void serialize_impl( std::ostream& t_out, const nd_span<Ty, MaxRank>& t_span, std::uint8_t t_codec, Sink&& t_sink )
+		{
+			using value_type  = std::remove_const_t<Ty>;
+			const size_t rank = t_span.rank( );
+			if( rank == 0 )
+				throw std::invalid_argument( "Rank-0 arrays cannot be serialized" );
+			if( rank > 0xFF )
+				throw std::invalid_argument( "Rank too large for the serial format" );
+
+			std::array<size_t, MaxRank> extents { };
+			std::array<std::ptrdiff_t, MaxRank> strides { };
+			for( size_t i = 0; i < rank; ++i )
+			{
+				extents[i] = t_span.extent( i );
+				strides[i] = t_span.stride( i );
+			}
+			// Column-major views record their strides and are stored as is, like fortran_order in .npy
+			const bool column_major = rank > 1 && !t_span.is_contiguous( ) && is_column_major_contiguous<MaxRank>( extents, strides, rank );
+
+			std::vector<std::byte> header( ( serial_fixed_bytes + 8 * rank * ( column_major ? 2 : 1 ) + serial_alignment - 1 ) / serial_alignment * serial_alignment );
+			const std::string descr = npy_descr<Ty>( );
+			std::memcpy( header.data( ), serial_magic, 4 );
+			header[4] = std::byte { serial_version };
+			header[5] = static_cast<std::byte>( descr[1] );
+			header[6] = static_cast<std::byte>( sizeof( value_type ) );
+			header[7] = static_cast<std::byte>( rank );
+			header[8] = std::byte { column_major ? serial_strided : std::uint8_t( 0 ) };
+			header[9] = std::byte { t_codec };
+			store_le( header.data( ) + 12, header.size( ), 4 );
+			store_le( header.data( ) + 16, t_span.size( ) * sizeof( value_type ), 8 );
+			for( size_t i = 0; i < rank; ++i )
+			{
+				store_le( header.data( ) + serial_fixed_bytes + 8 * i, extents[i], 8 );
+				if( column_major )
+					store_le( header.data( ) + serial_fixed_bytes + 8 * ( rank + i ), static_cast<std::uint64_t>( strides[i] ), 8 );
+			}
+			t_out.write( reinterpret_cast<const char*>( header.data( ) ), static_cast<std::streamsize>( header.size( ) ) );
+
+			if( column_major )
+				t_sink( reinterpret_cast<const std::byte*>( t_span.data( ) ), t_span.size( ) * sizeof( value_type ) );
+			else
+				for_each_row_major_block( t_span, t_sink );
+			if( !t_out )
+				throw std::runtime_error( "Cannot write serialized data" );
+		}
+
+	} // namespace detail
+
+	/// \brief Parses and validates a serialized header without touching the elements
+	/// \param t_data Start of the serialized buffer
+	/// \param t_size Size of the buffer in bytes
+	/// \return The header fields
+	/// \throws std::runtime_error if the magic, version or header are invalid, or an uncompressed buffer is truncated
+	/// \note Useful to dispatch on the element type of a message before viewing it.
+	[[nodiscard]] inline serial_info read_serial_header( const void* t_data, size_t t_size )
+	{
+		const auto* bytes = static_cast<const std::byte*>( t_data );
+		if( t_size < detail::serial_fixed_bytes || std::memcmp( bytes, detail::serial_magic, 4 ) != 0 )
+			throw std::runtime_error( "Not serialized nd_array data" );
+		if( static_cast<std::uint8_t>( bytes[4] ) != detail::serial_version )
+			throw std::runtime_error( "Unsupported serial format version " + std::to_string( static_cast<unsigned>( bytes[4] ) ) );
+
+		serial_info info;
+		info.kind          = static_cast<char>( bytes[5] );
+		info.element_size  = static_cast<size_t>( bytes[6] );
+		const auto rank    = static_cast<size_t>( bytes[7] );
+		const auto flags   = static_cast<std::uint8_t>( bytes[8] );
+		info.codec         = static_cast<std::uint8_t>( bytes[9] );
+		info.data_offset   = static_cast<size_t>( detail::load_le( bytes + 12, 4 ) );
+		const auto payload = detail::load_le( bytes + 16, 8 );
+		if( info.element_size == 0 || rank == 0 || ( flags & ~detail::serial_strided ) != 0 )
+			throw std::runtime_error( "Invalid serialized header" );
+		const size_t fields = detail::serial_fixed_bytes + 8 * rank * ( flags & detail::serial_strided ? 2 : 1 );
+		if( info.data_offset < fields || info.data_offset % detail::serial_alignment != 0 )
+			throw std::runtime_error( "Invalid serialized header" );
+		if( info.data_offset > t_size )
+			throw std::runtime_error( "Truncated serialized header" );
+
+		size_t count = 1;
+		for( size_t i = 0; i < rank; ++i )
+		{
+			const auto extent = detail::load_le( bytes + detail::serial_fixed_bytes + 8 * i, 8 );
+			if( extent > std::numeric_limits<size_t>::max( ) || ( extent != 0 && count > std::numeric_limits<size_t>::max( ) / extent ) )
+				throw std::runtime_error( "Invalid extents in serialized header" );
+			info.extents.push_back( static_cast<size_t>( extent ) );
+			count *= static_cast<size_t>( extent );
+		}
+		if( count > std::numeric_limits<size_t>::max( ) / info.element_size || payload != count * info.element_size )
+			throw std::runtime_error( "Serialized data size does not match the extents" );
+		info.data_bytes = static_cast<size_t>( payload );
+		if( !info.compressed( ) && info.data_bytes > t_size - info.data_offset )
+			throw std::runtime_error( "Truncated serialized data" );
+
+		if( flags & detail::serial_strided )
+		{
+			// The last strided element must lie inside the stored ones
+			size_t last = 0;
+			for( size_t i = 0; i < rank; ++i )
+			{
+				const auto stride = static_cast<std::ptrdiff_t>( detail::load_le( bytes + detail::serial_fixed_bytes + 8 * ( rank + i ), 8 ) );
+				if( stride < 0 )
+					throw std::runtime_error( "Invalid strides in serialized header" );
+				info.strides.push_back( stride );
+				if( count == 0 || stride == 0 || info.extents[i] < 2 )
+					continue;
+				if( info.extents[i] - 1 > ( count - 1 - last ) / static_cast<size_t>( stride ) )
+					throw std::runtime_error( "Invalid strides in serialized header" );
+				last += ( info.extents[i] - 1 ) * static_cast<size_t>( stride );
+			}
+		}
+		return info;
+	}
+
+	namespace detail
+	{
+		/// \brief Checks that a serialized header describes Ty and fits MaxRank
+		template<typename Ty, size_t MaxRank>
+		void check_serial_type( const serial_info& t_info )
+		{
+			const std::string descr = npy_descr<Ty>( );
+			if( t_info.kind != descr[1] || t_info.element_size != sizeof( Ty ) )
+				throw std::invalid_argument( "Element type " + descr + " does not match the serialized type " + t_info.kind + std::to_string( t_info.element_size ) );
+			if( t_info.rank( ) > MaxRank )
+				throw std::invalid_argument( "Rank exceeds MaxRank" );
+		}
+
+		/// \brief Builds a view of t_info's shape over elements at t_data
+		template<typename Ty, size_t MaxRank>
+		[[nodiscard]] nd_span<Ty, MaxRank> make_serial_span( Ty* t_data, const serial_info& t_info )
+		{
+			const size_t rank = t_info.rank( );
+			std::array<size_t, MaxRank> extents { };
+			std::array<std::ptrdiff_t, MaxRank> strides { };
+			for( size_t i = 0; i < rank; ++i )
+			{
+				extents[i] = t_info.extents[i];
+				if( !t_info.strides.empty( ) )
+					strides[i] = t_info.strides[i];
+			}
+			if( t_info.strides.empty( ) )
+				stride_computer<MaxRank>::compute( strides, extents, rank );
+			return nd_span<Ty, MaxRank>( t_info.data_bytes == 0 ? nullptr : t_data, extents, strides, rank );
+		}
+
+		/// \brief Decompresses the blocks following the header into t_dst (t_info.data_bytes bytes)
+		/// \throws std::runtime_error if a block is truncated or corrupt
+		template<typename Codec>
+		void decompress_blocks( const std::byte* t_data, size_t t_size, const serial_info& t_info, const Codec& t_codec, std::byte* t_dst )
+		{
+			size_t offset = t_info.data_offset;
+			for( size_t written = 0; written < t_info.data_bytes; )
+			{
+				if( t_size - offset < 8 )
+					throw std::runtime_error( "Truncated serialized block" );
+				const auto stored = static_cast<size_t>( load_le( t_data + offset, 4 ) );
+				const auto raw    = static_cast<size_t>( load_le( t_data + offset + 4, 4 ) );
+				offset += 8;
+				if( stored > t_size - offset )
+					throw std::runtime_error( "Truncated serialized block" );
+				if( raw == 0 || raw > t_info.data_bytes - written || stored > raw )
+					throw std::runtime_error( "Invalid serialized block" );
+				if( stored == raw )
+					std::memcpy( t_dst + written, t_data + offset, raw );
+				else
+					t_codec.decompress( t_data + offset, stored, t_dst + written, raw );
+				offset += stored;
+				written += raw;
+			}
+		}
+
+		/// \brief Reads serialized elements into a new row-major array, decompressing them with t_codec
+		template<typename Ty, size_t MaxRank, typename Codec>
+		[[nodiscard]] nd_array<Ty, MaxRank> deserialize_impl( const void* t_data, size_t t_size, const Codec& t_codec )
+		{
+			const serial_info info = read_serial_header( t_data, t_size );
+			check_serial_type<Ty, MaxRank>( info );
+			if( info.codec != 0 && info.codec != Codec::id )
+				throw std::invalid_argument( "Data is compressed with codec " + std::to_string( info.codec ) + ", which was not passed" );
+
+			const auto* bytes = static_cast<const std::byte*>( t_data );
+			nd_array<Ty, MaxRank> result( info.extents );
+			if( info.data_bytes == 0 )
+				return result;
+
+			if( !info.compressed( ) )
+			{
+				const std::byte* elements = bytes + info.data_offset;
+				if( info.strides.empty( ) )
+				{
+					std::memcpy( result.data( ), elements, info.data_bytes );
+				}
+				else if( reinterpret_cast<std::uintptr_t>( elements ) % alignof( Ty ) == 0 )
+				{
+					result.copy_from( make_serial_span<const Ty, MaxRank>( reinterpret_cast<const Ty*>( elements ), info ) );
+				}
+				else
+				{
+					// Strided views need aligned elements, so misaligned buffers are copied once more
+					std::vector<Ty> aligned( info.data_bytes / sizeof( Ty ) );
+					std::memcpy( aligned.data( ), elements, info.data_bytes );
+					result.copy_from( make_serial_span<const Ty, MaxRank>( aligned.data( ), info ) );
+				}
+				ND_ARRAY_COUNT( deep_copies, 1 );
+				ND_ARRAY_COUNT( copied_bytes, info.data_bytes );
+				return result;
+			}
+
+			if( info.strides.empty( ) )
+			{
+				decompress_blocks( bytes, t_size, info, t_codec, reinterpret_cast<std::byte*>( result.data( ) ) );
+			}
+			else
+			{
+				std::vector<Ty> stored( info.data_bytes / sizeof( Ty ) );
+				decompress_blocks( bytes, t_size, info, t_codec, reinterpret_cast<std::byte*>( stored.data( ) ) );
+				result.copy_from( make_serial_span<const Ty, MaxRank>( stored.data( ), info ) );
+			}
+			ND_ARRAY_COUNT( deep_copies, 1 );
+			ND_ARRAY_COUNT( copied_bytes, info.data_bytes );
+			return result;
+		}
+	} // namespace detail
+
+	/// \brief Writes a view in the serial format
+	/// \param t_out Destination stream, opened in binary mode
+	/// \param t_span View to write; any strides are accepted
+	/// \throws std::invalid_argument for rank-0 views
+	/// \throws std::runtime_error if the stream fails
+	/// \note Row-major and column-major contiguous views are written with a single write (the latter with
+	///       its strides), other views are gathered in row-major order through a small buffer.
+	/// \example
+	/// \code
+	/// std::ostringstream message;
+	/// cppa::serialize(message, frames.subspan(0, {first, last}));
+	/// \endcode
+	template<typename Ty, size_t MaxRank>
+	void serialize( std::ostream& t_out, const nd_span<Ty, MaxRank>& t_span )
+	{
+		detail::serialize_impl( t_out, t_span, 0,
+		                        [&t_out]( const std::byte* t_bytes, size_t t_size )
+		                        { t_out.write( reinterpret_cast<const char*>( t_bytes ), static_cast<std::streamsize>( t_size ) ); } );
+	}
+
+	/// \brief Writes a view in the serial format, compressing the elements block by block
+	/// \tparam Codec Block codec, see the file documentation
+	/// \param t_out Destination stream, opened in binary mode
+	/// \param t_span View to write; any strides are accepted
+	/// \param t_codec Codec compressing each block
+	/// \param t_block_bytes Uncompressed size of a block; larger blocks compress better, smaller ones need less memory
+	/// \throws std::invalid_argument for rank-0 views, a block size of 0 or above 4 GiB, or a reserved codec id
+	/// \throws std::runtime_error if the stream fails
+	/// \example
+	/// \code
+	/// cppa::serialize(message, gradients.as_span(), cppa::zstd_codec{ 5 });
+	/// \endcode
+	template<typename Codec, typename Ty, size_t MaxRank>
+	void serialize( std::ostream& t_out, const nd_span<Ty, MaxRank>& t_span, const Codec& t_codec, size_t t_block_bytes = size_t( 1 ) << 20 )
+	{
+		static_assert( Codec::id != 0, "Codec id 0 marks uncompressed data" );
+		if( t_block_bytes == 0 || t_block_bytes > 0xFFFFFFFF )
+			throw std::invalid_argument( "Block size must be between 1 byte and 4 GiB" );
+
+		const size_t block = std::min( t_block_bytes, std::max<size_t>( 1, t_span.size( ) * sizeof( std::remove_const_t<Ty> ) ) );
+		std::vector<std::byte> staging;
+		std::vector<std::byte> packed;
+		size_t filled = 0;
+
+		const auto emit = [&]( const std::byte* t_block, size_t t_size )
+		{
+			if( packed.empty( ) )
+				packed.resize( t_codec.bound( block ) );
+			const size_t size  = t_codec.compress( t_block, t_size, packed.data( ), packed.size( ) );
+			const bool as_is   = size == 0 || size >= t_size;
+			const size_t bytes = as_is ? t_size : size;
+			detail::write_le( t_out, bytes, 4 );
+			detail::write_le( t_out, t_size, 4 );
+			t_out.write( reinterpret_cast<const char*>( as_is ? t_block : packed.data( ) ), static_cast<std::streamsize>( bytes ) );
+		};
+
+		detail::serialize_impl( t_out, t_span, Codec::id,
+		                        [&]( const std::byte* t_bytes, size_t t_size )
+		                        {
+			                        while( t_size > 0 )
+			                        {
+				                        // Whole blocks of contiguous input are compressed in place
+				                        if( filled == 0 && t_size >= block )
+				                        {
+					                        emit( t_bytes, block );
+					                        t_bytes += block;
+					                        t_size -= block;
+					                        continue;
+				                        }
+				                        if( staging.empty( ) )
+					                        staging.resize( block );
+				                        const size_t take = std::min( block - filled, t_size );
+				                        std::memcpy( staging.data( ) + filled, t_bytes, take );
+				                        filled += take;
+				                        t_bytes += take;
+				                        t_size -= take;
+				                        if( filled == block )
+				                        {
+					                        emit( staging.data( ), block );
+					                        filled = 0;
+				                        }
+			                        }
+		                        } );
+		if( filled > 0 )
+			emit( staging.data( ), filled );
+		if( !t_out )
+			throw std::runtime_error( "Cannot write serialized data" );
+	}
+
+	/// \brief Writes an array in the serial format
+	/// \see serialize(std::ostream&, const nd_span<Ty, MaxRank>&)
+	template<typename Ty, size_t MaxRank, typename Allocator, size_t InlineCapacity>
+	void serialize( std::ostream& t_out, const nd_array<Ty, MaxRank, Allocator, InlineCapacity>& t_array )
+	{
+		serialize( t_out, t_array.as_span( ) );
+	}
+
+	/// \brief Writes an array in the serial format, compressing the elements block by block
+	/// \see serialize(std::ostream&, const nd_span<Ty, MaxRank>&, const Codec&, size_t)
+	template<typename Codec, typename Ty, size_t MaxRank, typename Allocator, size_t InlineCapacity>
+	void serialize( std::ostream& t_out, const nd_array<Ty, MaxRank, Allocator, InlineCapacity>& t_array, const Codec& t_codec,
+	                size_t t_block_bytes = size_t( 1 ) << 20 )
+	{
+		serialize( t_out, t_array.as_span( ), t_codec, t_block_bytes );
+	}
+
+	/// \brief Views serialized elements in place, without copying them
+	/// \tparam Ty Element type matching the serialized type; const for read-only buffers
+	/// \tparam MaxRank Maximum number of dimensions supported
+	/// \param t_data Start of the serialized buffer; must stay alive and unchanged while the view is used
+	/// \param t_size Size of the buffer in bytes; trailing bytes after the elements are ignored
+	/// \return View of the elements, with the stored strides for column-major data
+	/// \throws std::runtime_error if the header is malformed or the buffer is truncated
+	/// \throws std::invalid_argument if Ty does not match the stored type, the rank exceeds MaxRank, the
+	///                               elements are compressed, or the buffer is misaligned for Ty
+	/// \note The elements start at a 64-byte offset, so buffers aligned for Ty (e.g. from new or malloc) qualify.
+	/// \example
+	/// \code
+	/// std::vector<std::byte> buffer = receive();
+	/// auto tensor = cppa::view_serialized<const float>(buffer.data(), buffer.size());
+	/// \endcode
+	template<typename Ty, size_t MaxRank = 8>
+	[[nodiscard]] nd_span<Ty, MaxRank> view_serialized( std::conditional_t<std::is_const_v<Ty>, const void*, void*> t_data, size_t t_size )
+	{
+		using value_type       = std::remove_const_t<Ty>;
+		const serial_info info = read_serial_header( t_data, t_size );
+		detail::check_serial_type<value_type, MaxRank>( info );
+		if( info.compressed( ) )
+			throw std::invalid_argument( "Compressed data cannot be viewed in place; use deserialize()" );
+
+		auto* elements = reinterpret_cast<Ty*>( static_cast<std::conditional_t<std::is_const_v<Ty>, const std::byte*, std::byte*>>( t_data ) + info.data_offset );
+		if( reinterpret_cast<std::uintptr_t>( elements ) % alignof( value_type ) != 0 )
+			throw std::invalid_argument( "Serialized data is not aligned for the element type" );
+		return detail::make_serial_span<Ty, MaxRank>( elements, info );
+	}
+
+	/// \brief Reads uncompressed serialized elements into a new row-major array
+	/// \tparam Ty Element type matching the serialized type
+	/// \tparam MaxRank Maximum number of dimensions supported
+	/// \param t_data Start of the serialized buffer; need not be aligned
+	/// \param t_size Size of the buffer in bytes
+	/// \throws std::runtime_error if the header is malformed or the buffer is truncated
+	/// \throws std::invalid_argument if Ty does not match the stored type, the rank exceeds MaxRank or the
+	///                               elements are compressed
+	template<typename Ty, size_t MaxRank = 8>
+	[[nodiscard]] nd_array<Ty, MaxRank> deserialize( const void* t_data, size_t t_size )
+	{
+		return detail::deserialize_impl<Ty, MaxRank>( t_data, t_size, detail::no_codec { } );
+	}
+
+	/// \brief Reads serialized elements, compressed with t_codec or uncompressed, into a new row-major array
+	/// \tparam Ty Element type matching the serialized type
+	/// \tparam MaxRank Maximum number of dimensions supported
+	/// \tparam Codec Block codec, see the file documentation
+	/// \param t_data Start of the serialized buffer; need not be aligned
+	/// \param t_size Size of the buffer in bytes
+	/// \param t_codec Codec the elements were compressed with
+	/// \throws std::runtime_error if the header or a block is malformed, or the buffer is truncated
+	/// \throws std::invalid_argument if Ty does not match the stored type, the rank exceeds MaxRank or the
+	///                               elements were compressed with another codec
+	/// \note Row-major data is decompressed straight into the array; column-major data is decompressed into a
+	///       temporary buffer and transposed.
+	template<typename Ty, size_t MaxRank = 8, typename Codec>
+	[[nodiscard]] nd_array<Ty, MaxRank> deserialize( const void* t_data, size_t t_size, const Codec& t_codec )
+	{
+		return detail::deserialize_impl<Ty, MaxRank>( t_data, t_size, t_codec );
+	}
+
+} // namespace cppa
@@ -0,0 +1,254 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+/// \file nd_simd.hpp
+/// \brief Runtime selection of the instruction set used by the bulk kernels
+///
+/// The bulk algorithms (fill, apply, transform, copies, reductions, expressions and the nd_linalg and
+/// nd_stencil kernels) run each block of work through simd_dispatch(). On x86 with GCC or Clang every
+/// block is compiled three times: for the baseline of the build (SSE2 on x86-64), for AVX2 + FMA and for
+/// AVX-512 (F, BW, DQ, VL), with the whole call tree of the block inlined so the auto-vectorizer sees it
+/// at each width. The CPU is queried once, on first use, and every block then calls the clone of the
+/// best instruction set the CPU and the operating system support. Other targets run the baseline
+/// build, which is NEON on AArch64.
+///
+/// \code
+/// std::printf("nd_array kernels: %s\n", cppa::simd_isa_name(cppa::active_simd_isa()));  // "avx512"
+/// cppa::set_simd_isa(cppa::simd_isa::avx2);  // Pin a path, e.g. to compare timings
+/// \endcode
+///
+/// The environment variable `ND_ARRAY_SIMD` (`sse2`, `avx2`, `avx512`, ...) selects the initial path
+/// when the CPU supports it. Defining `ND_ARRAY_DISABLE_SIMD_DISPATCH` compiles only the baseline.
+///
+/// \note Clones with FMA may contract `a * b + c` in element functions, so floating-point results can
+///       differ in the last bit between paths. Pin `sse2` where results must match bit for bit.
+
+#if !defined( ND_ARRAY_DISABLE_SIMD_DISPATCH ) && ( defined( __x86_64__ ) || defined( __i386__ ) || defined( _M_X64 ) ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+/// \def ND_ARRAY_SIMD_DISPATCH
+/// \brief Defined to 1 when AVX2 and AVX-512 clones of the bulk kernels are compiled
+#	define ND_ARRAY_SIMD_DISPATCH 1
+#	include <cpuid.h>
+#	define ND_ARRAY_SIMD_CLONE_AVX2 __attribute__( ( target( "avx2,fma" ), flatten ) )
+#	define ND_ARRAY_SIMD_CLONE_AVX512 __attribute__( ( target( "avx2,fma,avx512f,avx512bw,avx512dq,avx512vl" ), flatten ) )
+#endif
+
+namespace cppa
+{
+	/// \brief Instruction sets the bulk kernels can be compiled for
+	enum class simd_isa
+	{
+		scalar, ///< No vector instruction set is known for the target
+		sse2,   ///< x86 baseline
+		avx2,   ///< x86 AVX2 with FMA
+		avx512, ///< x86 AVX-512 F, BW, DQ and VL
+		neon    ///< ARM Advanced SIMD
+	};
+
+	/// \brief Gets the lowercase name of an instruction set, as accepted by ND_ARRAY_SIMD
+	[[nodiscard]] constexpr const char* simd_isa_name( simd_isa t_isa ) noexcept
+	{
+		switch( t_isa )
+		{
+			case simd_isa::sse2:
+				return "sse2";
+			case simd_isa::avx2:
+				return "avx2";
+			case simd_isa::avx512:
+				return "avx512";
+			case simd_isa::neon:
+				return "neon";
+			case simd_isa::scalar:
+				break;
+		}
+		return "scalar";
+	}
+
+	namespace detail
+	{
+		/// \brief Instruction set every function of this build is compiled for
+		[[nodiscard]] constexpr simd_isa baseline_simd_isa( ) noexcept
+		{
+#if defined( __AVX512F__ ) && defined( __AVX512BW__ ) && defined( __AVX512DQ__ ) && defined( __AVX512VL__ )
+			return simd_isa::avx512;
+#elif defined( __AVX2__ ) && defined( __FMA__ )
+			return simd_isa::avx2;
+#elif defined( __x86_64__ ) || defined( _M_X64 ) || defined( __SSE2__ ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+			return simd_isa::sse2;
+#elif defined( __ARM_NEON ) || defined( __aarch64__ ) || defined( _M_ARM64 )
+			return simd_isa::neon;
+#else
+			return simd_isa::scalar;
+#endif
+		}
+
+		/// \brief Best instruction set the CPU and the operating system support, among the ones this build has clones for
+		[[nodiscard]] inline simd_isa query_simd_isa( ) noexcept
+		{
+#if defined( ND_ARRAY_SIMD_DISPATCH )
+			unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+			if( __get_cpuid_max( 0, nullptr ) < 7 )
+			{
+				return baseline_simd_isa( );
+			}
+			__cpuid_count( 1, 0, eax, ebx, ecx, edx );
+			const bool fma     = ( ecx & ( 1U << 12 ) ) != 0;
+			const bool osxsave = ( ecx & ( 1U << 27 ) ) != 0;
+			const bool avx     = ( ecx & ( 1U << 28 ) ) != 0;
+			if( !osxsave || !avx )
+			{
+				return baseline_simd_isa( );
+			}
+			// The operating system must save the YMM (and for AVX-512 the opmask and ZMM) registers
+			unsigned xcr0_low = 0, xcr0_high = 0;
+			__asm__ volatile( "xgetbv" : "=a"( xcr0_low ), "=d"( xcr0_high ) : "c"( 0 ) );
+			if( ( xcr0_low & 0x6U ) != 0x6U )
+			{
+				return baseline_simd_isa( );
+			}
+			__cpuid_count( 7, 0, eax, ebx, ecx, edx );
+			const bool avx2   = ( ebx & ( 1U << 5 ) ) != 0;
+			const bool avx512 = ( ebx & ( 1U << 16 ) ) != 0 && ( ebx & ( 1U << 17 ) ) != 0 && ( ebx & ( 1U << 30 ) ) != 0 && ( ebx & ( 1U << 31 ) ) != 0;
+			if( avx2 && fma && avx512 && ( xcr0_low & 0xE6U ) == 0xE6U )
+			{
+				return simd_isa::avx512;
+			}
+			if( avx2 && fma && baseline_simd_isa( ) != simd_isa::avx512 )
+			{
+				return simd_isa::avx2;
+			}
+#endif
+			return baseline_simd_isa( );
+		}
+
+		/// \brief Parses an ND_ARRAY_SIMD value
+		/// \return False if t_name does not name an instruction set
+		[[nodiscard]] inline bool parse_simd_isa( const char* t_name, simd_isa& t_isa ) noexcept
+		{
+			for( auto isa: { simd_isa::scalar, simd_isa::sse2, simd_isa::avx2, simd_isa::avx512, simd_isa::neon } )
+			{
+				if( std::strcmp( t_name, simd_isa_name( isa ) ) == 0 )
+				{
+					t_isa = isa;
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/// \brief Checks whether a path exists for t_isa in this build and on this CPU
+		[[nodiscard]] inline bool simd_isa_available( simd_isa t_isa, simd_isa t_detected ) noexcept
+		{
+			if( t_isa == baseline_simd_isa( ) )
+			{
+				return true;
+			}
+			// Only x86 has clones, each one requiring the instruction sets before it
+			const bool x86 = baseline_simd_isa( ) == simd_isa::sse2 || baseline_simd_isa( ) == simd_isa::avx2 || baseline_simd_isa( ) == simd_isa::avx512;
+			return x86 && ( t_isa == simd_isa::avx2 || t_isa == simd_isa::avx512 ) && t_isa > baseline_simd_isa( ) && t_isa <= t_detected;
+		}
+
+		/// \brief Value of the environment variable ND_ARRAY_SIMD, parsed; t_fallback if unset, unknown or unavailable
+		[[nodiscard]] inline simd_isa environment_simd_isa( simd_isa t_fallback ) noexcept
+		{
+			simd_isa isa = t_fallback;
+#if defined( _MSC_VER )
+			char* value = nullptr;
+			size_t size = 0;
+			if( _dupenv_s( &value, &size, "ND_ARRAY_SIMD" ) == 0 && value != nullptr )
+			{
+				if( !parse_simd_isa( value, isa ) || !simd_isa_available( isa, t_fallback ) )
+				{
+					isa = t_fallback;
+				}
+				std::free( value );
+			}
+#else
+			const char* value = std::getenv( "ND_ARRAY_SIMD" ); // NOLINT(concurrency-mt-unsafe)
+			if( value != nullptr && ( !parse_simd_isa( value, isa ) || !simd_isa_available( isa, t_fallback ) ) )
+			{
+				isa = t_fallback;
+			}
+#endif
+			return isa;
+		}
+
+		/// \brief Result of the CPU query, made once
+		[[nodiscard]] inline simd_isa cached_simd_isa( ) noexcept
+		{
+			static const simd_isa detected = query_simd_isa( );
+			return detected;
+		}
+
+		/// \brief Instruction set the kernels currently dispatch to, shared by all translation units
+		[[nodiscard]] inline std::atomic<simd_isa>& active_simd_isa_slot( ) noexcept
+		{
+			static std::atomic<simd_isa> active { environment_simd_isa( cached_simd_isa( ) ) };
+			return active;
+		}
+	} // namespace detail
+
+	/// \brief Gets the best instruction set this build has a path for and the CPU supports
+	[[nodiscard]] inline simd_isa detected_simd_isa( ) noexcept { return detail::cached_simd_isa( ); }
+
+	/// \brief Gets the instruction set the bulk kernels dispatch to
+	/// \return detected_simd_isa(), unless ND_ARRAY_SIMD or set_simd_isa() chose another available path
+	[[nodiscard]] inline simd_isa active_simd_isa( ) noexcept { return detail::active_simd_isa_slot( ).load( std::memory_order_relaxed ); }
+
+	/// \brief Checks whether the kernels can dispatch to an instruction set in this build and on this CPU
+	[[nodiscard]] inline bool simd_isa_supported( simd_isa t_isa ) noexcept { return detail::simd_isa_available( t_isa, detected_simd_isa( ) ); }
+
+	/// \brief Selects the instruction set of all subsequent bulk kernels, in every thread
+	/// \param t_isa Instruction set to use
+	/// \return The previously active instruction set
+	/// \throws std::invalid_argument if simd_isa_supported( t_isa ) is false
+	/// \note Kernels already running finish on the path they started with
+	inline simd_isa set_simd_isa( simd_isa t_isa )
+	{
+		if( !simd_isa_supported( t_isa ) )
+		{
+			throw std::invalid_argument( "Instruction set is not supported by this build or CPU" );
+		}
+		return detail::active_simd_isa_slot( ).exchange( t_isa, std::memory_order_relaxed );
+	}
+
+	namespace detail
+	{
+		/// \brief Registry of the clones of one kernel body, indexed by simd_isa
+		///
+		/// Each clone calls the body with its whole call tree inlined, compiled for its instruction set.
+		template<typename Body>
+		struct simd_kernel
+		{
+			using result_type = std::invoke_result_t<Body&>;
+			using clone_type  = result_type ( * )( Body& );
+
+			static result_type baseline( Body& t_body ) { return t_body( ); }
+
+#if defined( ND_ARRAY_SIMD_DISPATCH )
+			ND_ARRAY_SIMD_CLONE_AVX2 static result_type avx2( Body& t_body ) { return t_body( ); }
+
+			ND_ARRAY_SIMD_CLONE_AVX512 static result_type avx512( Body& t_body ) { return t_body( ); }
+
+			static constexpr clone_type clones[] = { baseline, baseline, avx2, avx512, baseline };
+#else
+			static constexpr clone_type clones[] = { baseline, baseline, baseline, baseline, baseline };
+#endif
+		};
+
+		/// \brief Runs t_body( ) compiled for the active instruction set
+		/// \param t_body Block of work, typically one range of rows of a bulk kernel
+		/// \return The result of t_body( )
+		template<typename Body>
+		decltype( auto ) simd_dispatch( Body&& t_body )
+		{
+			return simd_kernel<std::remove_reference_t<Body>>::clones[static_cast<size_t>( active_simd_isa( ) )]( t_body );
+		}
+	} // namespace detail
+} // namespace cppa
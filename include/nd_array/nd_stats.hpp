@@ -0,0 +1,133 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+/// \file nd_stats.hpp
+/// \brief Opt-in counters and trace hooks for finding hidden allocations and copies
+///
+/// Defining `ND_ARRAY_ENABLE_STATS` (the `ND_ARRAY_ENABLE_STATS` CMake option) makes nd_array count,
+/// per thread, the buffers it allocates, its deep copies, the strided copies that fall back to
+/// element-wise loops, the iterations over non-contiguous views and the failed reshapes. Bulk operations
+/// additionally report their begin and end to a trace callback, which can forward them to ITT, Perfetto
+/// or any other profiler. Without the macro all hooks expand to nothing, the counters stay zero and
+/// no callback is ever called.
+///
+/// \code
+/// cppa::reset_thread_stats();
+/// run_pipeline(frame);
+/// const cppa::nd_stats stats = cppa::thread_stats();
+/// std::printf("%zu allocations, %zu deep copies\n", stats.allocations, stats.deep_copies);
+///
+/// cppa::set_trace_callback([](cppa::trace_phase t_phase, const char* t_name) {
+///     if (t_phase == cppa::trace_phase::begin)
+///         __itt_task_begin(domain, __itt_null, __itt_null, __itt_string_handle_create(t_name));
+///     else
+///         __itt_task_end(domain);
+/// });
+/// \endcode
+///
+/// \note The macro must be defined alike in every translation unit of a program.
+/// \note Counters belong to the thread doing the work: rows of `par` operations count on the worker thread.
+
+namespace cppa
+{
+	/// \brief True if this build counts statistics and calls the trace callback
+#if defined( ND_ARRAY_ENABLE_STATS )
+	inline constexpr bool stats_enabled = true;
+#else
+	inline constexpr bool stats_enabled = false;
+#endif
+
+	/// \brief Counters of one thread, collected when ND_ARRAY_ENABLE_STATS is defined
+	struct nd_stats
+	{
+		size_t allocations              = 0; ///< Element buffers obtained from the allocator (inline storage is not counted)
+		size_t allocated_bytes          = 0; ///< Bytes of those buffers
+		size_t deep_copies              = 0; ///< nd_array copy constructions, copy assignments and conversions from views
+		size_t copied_bytes             = 0; ///< Bytes of elements written by those copies
+		size_t element_wise_copies      = 0; ///< Strided copies that could not copy whole rows with memcpy
+		size_t noncontiguous_iterations = 0; ///< Iterations started over views that are not contiguous
+		size_t reshape_failures         = 0; ///< reshape() calls rejected because the view is not contiguous
+	};
+
+	/// \brief Point of a bulk operation reported to the trace callback
+	enum class trace_phase
+	{
+		begin, ///< The operation starts on the calling thread
+		end    ///< The operation finished, also when it threw
+	};
+
+	/// \brief Trace callback, called with the phase and the static name of a bulk operation (e.g. "matmul")
+	/// \note Called from any thread that runs a bulk operation; must not throw
+	using trace_callback = void ( * )( trace_phase t_phase, const char* t_name );
+
+	namespace detail
+	{
+		/// \brief Counters of the calling thread
+		[[nodiscard]] inline nd_stats& thread_stats_slot( ) noexcept
+		{
+			static thread_local nd_stats stats;
+			return stats;
+		}
+
+		/// \brief Trace callback shared by all threads
+		[[nodiscard]] inline std::atomic<trace_callback>& trace_callback_slot( ) noexcept
+		{
+			static std::atomic<trace_callback> callback { nullptr };
+			return callback;
+		}
+
+		/// \brief Reports begin on construction and end on destruction to the trace callback, if one is set
+		class trace_scope
+		{
+		public:
+			explicit trace_scope( const char* t_name ) noexcept : m_callback( trace_callback_slot( ).load( std::memory_order_acquire ) ), m_name( t_name )
+			{
+				if( m_callback != nullptr )
+				{
+					m_callback( trace_phase::begin, m_name );
+				}
+			}
+
+			~trace_scope( )
+			{
+				if( m_callback != nullptr )
+				{
+					m_callback( trace_phase::end, m_name );
+				}
+			}
+
+			trace_scope( const trace_scope& )            = delete;
+			trace_scope& operator=( const trace_scope& ) = delete;
+
+		private:
+			trace_callback m_callback; ///< Callback at begin, so begin and end always pair up
+			const char* m_name;        ///< Name of the operation
+		};
+	} // namespace detail
+
+	/// \brief Gets the counters of the calling thread (all zero without ND_ARRAY_ENABLE_STATS)
+	[[nodiscard]] inline nd_stats thread_stats( ) noexcept { return detail::thread_stats_slot( ); }
+
+	/// \brief Sets the counters of the calling thread to zero
+	inline void reset_thread_stats( ) noexcept { detail::thread_stats_slot( ) = nd_stats { }; }
+
+	/// \brief Installs the trace callback for bulk operations on all threads
+	/// \param t_callback Callback, or nullptr to stop tracing
+	/// \return The previous callback
+	/// \note Has no effect on the operations without ND_ARRAY_ENABLE_STATS
+	inline trace_callback set_trace_callback( trace_callback t_callback ) noexcept { return detail::trace_callback_slot( ).exchange( t_callback, std::memory_order_acq_rel ); }
+} // namespace cppa
+
+/// \def ND_ARRAY_COUNT
+/// \brief Adds an amount to a counter of nd_stats for the calling thread; the amount is not evaluated when disabled
+/// \def ND_ARRAY_TRACE_SCOPE
+/// \brief Reports the rest of the enclosing scope to the trace callback as the bulk operation `name`
+#if defined( ND_ARRAY_ENABLE_STATS )
+#	define ND_ARRAY_COUNT( counter, amount ) ( ::cppa::detail::thread_stats_slot( ).counter += ( amount ) )
+#	define ND_ARRAY_TRACE_SCOPE( name ) const ::cppa::detail::trace_scope nd_array_trace_scope_( name )
+#else
+#	define ND_ARRAY_COUNT( counter, amount ) static_cast<void>( 0 )
+#	define ND_ARRAY_TRACE_SCOPE( name ) static_cast<void>( 0 )
+#endif
@@ -0,0 +1,675 @@
+#pragma once
+
+#include "nd_array.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/// \file nd_stencil.hpp
+/// \brief Stencil and correlation kernels over nd_span / nd_array with halo handling at the borders
+///
+/// stencil() calls a kernel for every output element with a stencil_window, an accessor of the
+/// neighbouring input elements by offset from the centre. The extents are split into an interior,
+/// where every neighbour within the halo exists, and the boundary around it. Interior windows point
+/// straight into the input and advance by one stride per element, with no range checks or copies;
+/// boundary windows are gathered into a small buffer first, completing the neighbourhood according
+/// to the boundary_mode. correlate() applies a weight array the same way, and its interior loops run
+/// tap by tap over whole rows, which the compiler vectorizes for unit-stride rows.
+///
+/// \code
+/// nd_array<float> image(480, 640), smoothed(480, 640);
+/// cppa::stencil(image, smoothed, {1, 1}, cppa::boundary_mode::nearest,
+///               [](const auto& w) { return 0.25f * (w(-1, 0) + w(1, 0) + w(0, -1) + w(0, 1)); });
+///
+/// nd_array<float> gauss(5, 5);                                   // weights, centred at (2, 2)
+/// auto blurred = cppa::correlate(cppa::par, image, gauss, cppa::boundary_mode::reflect);
+/// auto padded  = cppa::correlate(image, gauss, {cppa::boundary_mode::constant, 1.0f});
+/// \endcode
+///
+/// \note The output must not overlap the input. With cppa::par the outermost dimension is split
+///       across threads; the kernel is then called concurrently and must not modify shared state.
+
+namespace cppa
+{
+	/// \brief How stencil windows are completed beyond the extents of the input
+	enum class boundary_mode
+	{
+		constant, ///< Missing elements take a fixed value (default 0)
+		nearest,  ///< The nearest edge element is repeated: a a | a b c | c c
+		reflect,  ///< Mirrored about the edge element, which is not repeated: c b | a b c | b a
+		wrap      ///< Periodic continuation: b c | a b c | a b
+	};
+
+	/// \brief Boundary handling of a stencil: a boundary_mode and the value used by boundary_mode::constant
+	/// \tparam Ty Element type of the stencil input
+	template<typename Ty>
+	struct boundary
+	{
+		boundary_mode mode = boundary_mode::constant; ///< How missing elements are filled
+		Ty value { };                                 ///< Value of missing elements for boundary_mode::constant
+
+		/// \brief Constant zero boundary
+		constexpr boundary( ) = default;
+
+		/// \brief Boundary of the given mode
+		/// \param t_mode How missing elements are filled
+		/// \param t_value Value of missing elements for boundary_mode::constant
+		constexpr boundary( boundary_mode t_mode, Ty t_value = Ty { } ) : mode( t_mode ), value( t_value ) {} // NOLINT(google-explicit-constructor)
+	};
+
+	/// \class stencil_window
+	/// \brief Read-only accessor of the neighbourhood of one stencil output, indexed by offset from its centre
+	/// \tparam Ty Element type
+	/// \tparam MaxRank Maximum number of dimensions
+	///
+	/// w(di, dj) reads the element di rows and dj columns away from the centre. Offsets must lie within
+	/// the halo passed to stencil(); they are checked only through ND_ARRAY_ASSERT.
+	template<typename Ty, size_t MaxRank = 8>
+	class stencil_window
+	{
+	public:
+		using value_type  = Ty;             ///< Type of elements
+		using size_type   = size_t;         ///< Type for sizes and indices
+		using stride_type = std::ptrdiff_t; ///< Signed offset and stride in elements
+
+		/// \brief Creates a window centred on t_center
+		/// \param t_center Centre element
+		/// \param t_strides Strides of the neighbourhood, at least t_rank of them
+		/// \param t_rank Number of dimensions
+		stencil_window( const Ty* t_center, const stride_type* t_strides, size_type t_rank ) noexcept : m_center( t_center ), m_strides( t_strides ), m_rank( t_rank ) {}
+
+		/// \brief Reads the element at the given offsets from the centre
+		/// \param t_offsets One signed offset per dimension
+		/// \return Reference to the neighbouring element
+		template<typename... Offsets>
+		[[nodiscard]] const Ty& operator( )( Offsets... t_offsets ) const noexcept
+		{
+			static_assert( sizeof...( Offsets ) <= MaxRank, "Too many offsets" );
+			ND_ARRAY_ASSERT( sizeof...( Offsets ) == m_rank, "Offset count must match rank" );
+			stride_type offset = 0;
+			size_type dim      = 0;
+			( ( offset += static_cast<stride_type>( t_offsets ) * m_strides[dim++] ), ... );
+			return m_center[offset];
+		}
+
+		/// \brief Reads the centre element
+		[[nodiscard]] const Ty& center( ) const noexcept { return *m_center; }
+
+		/// \brief Gets the number of dimensions
+		[[nodiscard]] size_type rank( ) const noexcept { return m_rank; }
+
+	private:
+		const Ty* m_center;           ///< Centre element
+		const stride_type* m_strides; ///< Strides of the neighbourhood
+		size_type m_rank;             ///< Number of dimensions
+	};
+
+	namespace detail
+	{
+		/// \brief Maps t_index to an index within [0, t_extent) according to t_mode
+		/// \return False if the element is missing and takes the constant boundary value
+		[[nodiscard]] inline bool boundary_index( std::ptrdiff_t t_index, size_t t_extent, boundary_mode t_mode, size_t& t_result ) noexcept
+		{
+			const auto extent = static_cast<std::ptrdiff_t>( t_extent );
+			if( t_index >= 0 && t_index < extent )
+			{
+				t_result = static_cast<size_t>( t_index );
+				return true;
+			}
+			std::ptrdiff_t index = 0;
+			switch( t_mode )
+			{
+				case boundary_mode::constant:
+					return false;
+				case boundary_mode::nearest:
+					index = t_index < 0 ? 0 : extent - 1;
+					break;
+				case boundary_mode::reflect:
+					if( extent > 1 )
+					{
+						const std::ptrdiff_t period = 2 * ( extent - 1 );
+						index                       = ( t_index % period + period ) % period;
+						index                       = index < extent ? index : period - index;
+					}
+					break;
+				case boundary_mode::wrap:
+					index = ( t_index % extent + extent ) % extent;
+					break;
+			}
+			t_result = static_cast<size_t>( index );
+			return true;
+		}
+
+		/// \brief Extents of the neighbourhood: t_before elements before the centre and t_after after it
+		template<size_t MaxRank>
+		struct stencil_halo
+		{
+			std::array<size_t, MaxRank> before { }; ///< Elements before the centre in each dimension
+			std::array<size_t, MaxRank> after { };  ///< Elements after the centre in each dimension
+			size_t rank = 0;                        ///< Number of dimensions
+
+			/// \brief Number of elements of the neighbourhood
+			[[nodiscard]] size_t window_size( ) const noexcept
+			{
+				size_t size = 1;
+				for( size_t d = 0; d < rank; ++d )
+				{
+					size *= before[d] + after[d] + 1;
+				}
+				return size;
+			}
+
+			/// \brief Row-major strides of a gathered neighbourhood
+			[[nodiscard]] std::array<std::ptrdiff_t, MaxRank> window_strides( ) const noexcept
+			{
+				std::array<std::ptrdiff_t, MaxRank> strides { };
+				std::ptrdiff_t stride = 1;
+				for( size_t d = rank; d-- > 0; )
+				{
+					strides[d] = stride;
+					stride *= static_cast<std::ptrdiff_t>( before[d] + after[d] + 1 );
+				}
+				return strides;
+			}
+		};
+
+		/// \brief Splits rows [t_first, t_last) of the outermost dimension into interior runs and boundary points
+		///
+		/// t_row( index, first, last ) is called for every run [first, last) of the innermost dimension whose
+		/// whole neighbourhood lies inside the extents, with index[rank - 1] == first. t_point( index ) is
+		/// called for every other element. For rank 1 the rows are the elements themselves.
+		template<size_t MaxRank, typename RowFunc, typename PointFunc>
+		void for_each_stencil_region( const std::array<size_t, MaxRank>& t_extents, const stencil_halo<MaxRank>& t_halo, size_t t_first, size_t t_last, RowFunc&& t_row,
+		                              PointFunc&& t_point )
+		{
+			const size_t inner = t_halo.rank - 1;
+			const size_t n     = t_extents[inner];
+			std::array<size_t, MaxRank> index { };
+			index[0] = t_first;
+
+			const auto visit_row = [&]( size_t t_begin, size_t t_end )
+			{
+				bool interior = true;
+				for( size_t d = 0; interior && d < inner; ++d )
+				{
+					interior = index[d] >= t_halo.before[d] && index[d] + t_halo.after[d] < t_extents[d];
+				}
+				const size_t run_first = std::max( t_begin, t_halo.before[inner] );
+				const size_t run_last  = n > t_halo.after[inner] ? std::min( t_end, n - t_halo.after[inner] ) : 0;
+				if( !interior || run_first >= run_last )
+				{
+					for( index[inner] = t_begin; index[inner] < t_end; ++index[inner] )
+					{
+						t_point( std::as_const( index ) );
+					}
+					return;
+				}
+				for( index[inner] = t_begin; index[inner] < run_first; ++index[inner] )
+				{
+					t_point( std::as_const( index ) );
+				}
+				index[inner] = run_first;
+				t_row( std::as_const( index ), run_first, run_last );
+				for( index[inner] = run_last; index[inner] < t_end; ++index[inner] )
+				{
+					t_point( std::as_const( index ) );
+				}
+			};
+
+			if( inner == 0 )
+			{
+				visit_row( t_first, t_last );
+				return;
+			}
+			for( ;; )
+			{
+				visit_row( 0, n );
+				for( size_t d = inner;; )
+				{
+					--d;
+					if( ++index[d] < ( d == 0 ? t_last : t_extents[d] ) )
+					{
+						break;
+					}
+					if( d == 0 )
+					{
+						return;
+					}
+					index[d] = 0;
+				}
+			}
+		}
+
+		/// \brief Copies the neighbourhood of t_index into t_window in row-major order, completing it according to t_boundary
+		template<typename Ty, size_t MaxRank>
+		void gather_window( const nd_span<const Ty, MaxRank>& t_src, const stencil_halo<MaxRank>& t_halo, const std::array<size_t, MaxRank>& t_index,
+		                    const boundary<Ty>& t_boundary, Ty* t_window )
+		{
+			const size_t rank = t_halo.rank;
+			std::array<size_t, MaxRank> offset { };
+			for( Ty* out = t_window;; ++out )
+			{
+				std::ptrdiff_t position = 0;
+				bool present            = true;
+				for( size_t d = 0; present && d < rank; ++d )
+				{
+					size_t mapped = 0;
+					present       = boundary_index( static_cast<std::ptrdiff_t>( t_index[d] + offset[d] ) - static_cast<std::ptrdiff_t>( t_halo.before[d] ), t_src.extent( d ),
+					                                t_boundary.mode, mapped );
+					position += static_cast<std::ptrdiff_t>( mapped ) * t_src.stride( d );
+				}
+				*out = present ? t_src.data( )[position] : t_boundary.value;
+
+				size_t d = rank;
+				while( d > 0 && ++offset[d - 1] > t_halo.before[d - 1] + t_halo.after[d - 1] )
+				{
+					offset[--d] = 0;
+				}
+				if( d == 0 )
+				{
+					return;
+				}
+			}
+		}
+
+		/// \brief Offset of element t_index in a view of the given strides
+		template<size_t MaxRank>
+		[[nodiscard]] std::ptrdiff_t stencil_offset( const std::array<size_t, MaxRank>& t_index, const std::array<std::ptrdiff_t, MaxRank>& t_strides, size_t t_rank ) noexcept
+		{
+			std::ptrdiff_t offset = 0;
+			for( size_t d = 0; d < t_rank; ++d )
+			{
+				offset += static_cast<std::ptrdiff_t>( t_index[d] ) * t_strides[d];
+			}
+			return offset;
+		}
+
+		/// \brief Strides of a view as an array
+		template<typename Ty, size_t MaxRank>
+		[[nodiscard]] std::array<std::ptrdiff_t, MaxRank> stencil_strides( const nd_span<Ty, MaxRank>& t_span ) noexcept
+		{
+			std::array<std::ptrdiff_t, MaxRank> strides { };
+			for( size_t d = 0; d < t_span.rank( ); ++d )
+			{
+				strides[d] = t_span.stride( d );
+			}
+			return strides;
+		}
+
+		/// \brief Validates the extents of a stencil and returns the extents of the output
+		template<typename Ty, typename OutTy, size_t MaxRank>
+		[[nodiscard]] std::array<size_t, MaxRank> stencil_extents( const nd_span<const Ty, MaxRank>& t_src, const nd_span<OutTy, MaxRank>& t_dst, size_t t_halo_rank )
+		{
+			bool same_extents = t_src.rank( ) == t_dst.rank( );
+			std::array<size_t, MaxRank> extents { };
+			for( size_t d = 0; same_extents && d < t_src.rank( ); ++d )
+			{
+				extents[d]   = t_src.extent( d );
+				same_extents = extents[d] == t_dst.extent( d );
+			}
+			if( !same_extents )
+			{
+				throw std::invalid_argument( "stencil extents do not match" );
+			}
+			if( t_halo_rank != t_src.rank( ) )
+			{
+				throw std::invalid_argument( "stencil halo rank must match rank" );
+			}
+			return extents;
+		}
+
+		template<typename Policy, typename Ty, typename OutTy, size_t MaxRank, typename Kernel>
+		void stencil_spans( const Policy& t_policy, const nd_span<const Ty, MaxRank>& t_src, nd_span<OutTy, MaxRank> t_dst, std::initializer_list<size_t> t_halo,
+		                    const boundary<Ty>& t_boundary, Kernel& t_kernel )
+		{
+			static_assert( !std::is_const_v<OutTy>, "The output of a stencil must be writable" );
+			ND_ARRAY_TRACE_SCOPE( "stencil" );
+			const auto extents = stencil_extents( t_src, t_dst, t_halo.size( ) );
+			if( t_src.size( ) == 0 )
+			{
+				return;
+			}
+
+			stencil_halo<MaxRank> halo;
+			halo.rank = t_src.rank( );
+			std::copy( t_halo.begin( ), t_halo.end( ), halo.before.begin( ) );
+			halo.after                = halo.before;
+			const auto src_strides    = stencil_strides( t_src );
+			const auto dst_strides    = stencil_strides( t_dst );
+			const auto window_strides = halo.window_strides( );
+			const size_t inner        = halo.rank - 1;
+			const std::ptrdiff_t center_offset = stencil_offset( halo.before, window_strides, halo.rank );
+
+			run_rows( t_policy, extents[0],
+			          [&]( size_t t_first, size_t t_last )
+			          {
+				          std::vector<Ty> window( halo.window_size( ) );
+				          for_each_stencil_region<MaxRank>(
+				              extents, halo, t_first, t_last,
+				              [&]( const std::array<size_t, MaxRank>& t_index, size_t t_run_first, size_t t_run_last )
+				              {
+					              const Ty* src = t_src.data( ) + stencil_offset( t_index, src_strides, halo.rank );
+					              OutTy* dst    = t_dst.data( ) + stencil_offset( t_index, dst_strides, halo.rank );
+					              for( size_t j = t_run_first; j < t_run_last; ++j, src += src_strides[inner], dst += dst_strides[inner] )
+					              {
+						              *dst = t_kernel( stencil_window<Ty, MaxRank>( src, src_strides.data( ), halo.rank ) );
+					              }
+				              },
+				              [&]( const std::array<size_t, MaxRank>& t_index )
+				              {
+					              gather_window( t_src, halo, t_index, t_boundary, window.data( ) );
+					              t_dst.data( )[stencil_offset( t_index, dst_strides, halo.rank )] =
+					                  t_kernel( stencil_window<Ty, MaxRank>( window.data( ) + center_offset, window_strides.data( ), halo.rank ) );
+				              } );
+			          } );
+		}
+
+		/// \brief t_acc[j] = t_weight * t_in[j * t_stride] for j < t_length, or += unless Assign
+		template<bool Assign, typename Acc, typename Ty>
+		void correlate_tap( Acc* t_acc, const Ty* t_in, std::ptrdiff_t t_stride, Acc t_weight, size_t t_length ) noexcept
+		{
+			const auto update = [t_acc, t_weight]( size_t t_j, const Ty& t_value )
+			{
+				if constexpr( Assign )
+				{
+					t_acc[t_j] = t_weight * static_cast<Acc>( t_value );
+				}
+				else
+				{
+					t_acc[t_j] += t_weight * static_cast<Acc>( t_value );
+				}
+			};
+			if( t_stride == 1 )
+			{
+				for( size_t j = 0; j < t_length; ++j )
+				{
+					update( j, t_in[j] );
+				}
+			}
+			else
+			{
+				for( size_t j = 0; j < t_length; ++j )
+				{
+					update( j, t_in[static_cast<std::ptrdiff_t>( j ) * t_stride] );
+				}
+			}
+		}
+
+		template<typename Policy, typename Ty, typename WeightTy, typename OutTy, size_t MaxRank>
+		void correlate_spans( const Policy& t_policy, const nd_span<const Ty, MaxRank>& t_src, const nd_span<const WeightTy, MaxRank>& t_weights, nd_span<OutTy, MaxRank> t_dst,
+		                      const boundary<Ty>& t_boundary )
+		{
+			static_assert( !std::is_const_v<OutTy>, "The output of a correlation must be writable" );
+			ND_ARRAY_TRACE_SCOPE( "correlate" );
+			using acc_type     = std::common_type_t<Ty, WeightTy>;
+			const auto extents = stencil_extents( t_src, t_dst, t_weights.rank( ) );
+			if( t_weights.size( ) == 0 )
+			{
+				throw std::invalid_argument( "correlate requires non-empty weights" );
+			}
+			if( t_src.size( ) == 0 )
+			{
+				return;
+			}
+
+			stencil_halo<MaxRank> halo;
+			halo.rank = t_src.rank( );
+			for( size_t d = 0; d < halo.rank; ++d )
+			{
+				halo.before[d] = t_weights.extent( d ) / 2;
+				halo.after[d]  = t_weights.extent( d ) - 1 - halo.before[d];
+			}
+			const auto src_strides = stencil_strides( t_src );
+			const auto dst_strides = stencil_strides( t_dst );
+			const size_t inner     = halo.rank - 1;
+
+			// Taps in row-major window order: offset from the centre in the input, and weight
+			std::vector<std::ptrdiff_t> tap_offsets;
+			std::vector<acc_type> tap_weights;
+			tap_offsets.reserve( t_weights.size( ) );
+			tap_weights.reserve( t_weights.size( ) );
+			std::array<size_t, MaxRank> tap { };
+			for( ;; )
+			{
+				std::ptrdiff_t offset        = 0;
+				std::ptrdiff_t weight_offset = 0;
+				for( size_t d = 0; d < halo.rank; ++d )
+				{
+					offset += ( static_cast<std::ptrdiff_t>( tap[d] ) - static_cast<std::ptrdiff_t>( halo.before[d] ) ) * src_strides[d];
+					weight_offset += static_cast<std::ptrdiff_t>( tap[d] ) * t_weights.stride( d );
+				}
+				tap_offsets.push_back( offset );
+				tap_weights.push_back( static_cast<acc_type>( t_weights.data( )[weight_offset] ) );
+
+				size_t d = halo.rank;
+				while( d > 0 && ++tap[d - 1] == t_weights.extent( d - 1 ) )
+				{
+					tap[--d] = 0;
+				}
+				if( d == 0 )
+				{
+					break;
+				}
+			}
+
+			run_rows( t_policy, extents[0],
+			          [&]( size_t t_first, size_t t_last )
+			          {
+				          std::vector<Ty> window( tap_weights.size( ) );
+				          std::vector<acc_type> row( extents[inner] );
+				          for_each_stencil_region<MaxRank>(
+				              extents, halo, t_first, t_last,
+				              [&]( const std::array<size_t, MaxRank>& t_index, size_t t_run_first, size_t t_run_last )
+				              {
+					              const size_t length         = t_run_last - t_run_first;
+					              const Ty* src               = t_src.data( ) + stencil_offset( t_index, src_strides, halo.rank );
+					              OutTy* dst                  = t_dst.data( ) + stencil_offset( t_index, dst_strides, halo.rank );
+					              const std::ptrdiff_t stride = src_strides[inner];
+					              // Unit-stride outputs of the accumulator type are accumulated in place
+					              acc_type* acc = row.data( );
+					              if constexpr( std::is_same_v<OutTy, acc_type> )
+					              {
+						              acc = dst_strides[inner] == 1 ? dst : acc;
+					              }
+					              correlate_tap<true>( acc, src + tap_offsets[0], stride, tap_weights[0], length );
+					              for( size_t tap = 1; tap < tap_weights.size( ); ++tap )
+					              {
+						              correlate_tap<false>( acc, src + tap_offsets[tap], stride, tap_weights[tap], length );
+					              }
+					              if( acc == row.data( ) )
+					              {
+						              for( size_t j = 0; j < length; ++j )
+						              {
+							              dst[static_cast<std::ptrdiff_t>( j ) * dst_strides[inner]] = static_cast<OutTy>( acc[j] );
+						              }
+					              }
+				              },
+				              [&]( const std::array<size_t, MaxRank>& t_index )
+				              {
+					              gather_window( t_src, halo, t_index, t_boundary, window.data( ) );
+					              acc_type sum = acc_type( 0 );
+					              for( size_t tap = 0; tap < tap_weights.size( ); ++tap )
+					              {
+						              sum += tap_weights[tap] * static_cast<acc_type>( window[tap] );
+					              }
+					              t_dst.data( )[stencil_offset( t_index, dst_strides, halo.rank )] = static_cast<OutTy>( sum );
+				              } );
+			          } );
+		}
+
+		template<typename Ty, size_t MaxRank, typename Layout>
+		[[nodiscard]] nd_span<const Ty, MaxRank> stencil_operand( const nd_span<Ty, MaxRank, Layout>& t_span )
+		{
+			return as_const_span( t_span );
+		}
+
+		template<typename Ty, size_t MaxRank, typename Allocator, size_t InlineCapacity>
+		[[nodiscard]] nd_span<const Ty, MaxRank> stencil_operand( const nd_array<Ty, MaxRank, Allocator, InlineCapacity>& t_array ) noexcept
+		{
+			return t_array.as_span( );
+		}
+
+		template<typename Ty, size_t MaxRank, typename Layout>
+		[[nodiscard]] nd_span<Ty, MaxRank> stencil_target( nd_span<Ty, MaxRank, Layout> t_span ) noexcept
+		{
+			std::array<size_t, MaxRank> extents { };
+			std::array<std::ptrdiff_t, MaxRank> strides { };
+			for( size_t i = 0; i < t_span.rank( ); ++i )
+			{
+				extents[i] = t_span.extent( i );
+				strides[i] = t_span.stride( i );
+			}
+			return nd_span<Ty, MaxRank>( t_span.data( ), extents, strides, t_span.rank( ) );
+		}
+
+		template<typename Ty, size_t MaxRank, typename Allocator, size_t InlineCapacity>
+		[[nodiscard]] nd_span<Ty, MaxRank> stencil_target( nd_array<Ty, MaxRank, Allocator, InlineCapacity>& t_array ) noexcept
+		{
+			return t_array.as_span( );
+		}
+
+		/// \brief Element type of a stencil input
+		template<typename Source>
+		using stencil_value_t = std::remove_const_t<typename Source::value_type>;
+
+		/// \brief Window type passed to the kernels of a stencil over Source
+		template<typename Source>
+		using stencil_window_t = stencil_window<stencil_value_t<Source>, Source::max_rank( )>;
+
+		/// \brief Array type returned by the allocating stencil()
+		template<typename Source, typename Kernel>
+		using stencil_result_t = nd_array<std::decay_t<std::invoke_result_t<Kernel&, const stencil_window_t<Source>&>>, Source::max_rank( )>;
+
+		/// \brief Array type returned by the allocating correlate()
+		template<typename Source, typename Weights>
+		using correlate_result_t = nd_array<std::common_type_t<stencil_value_t<Source>, stencil_value_t<Weights>>, Source::max_rank( )>;
+
+		template<typename Policy, typename Src, typename Other>
+		inline constexpr bool is_stencil_call_v = is_execution_policy_v<Policy> && is_nd_container<Src>::value && is_nd_container<std::remove_cv_t<std::remove_reference_t<Other>>>::value;
+	} // namespace detail
+
+	/// \brief Writes t_kernel( window ) to every element of t_dst, the window centred on the same element of t_src
+	/// \tparam Policy Execution policy; cppa::par splits the outermost dimension across threads
+	/// \param t_src Input, any strides
+	/// \param t_dst Output with the extents of t_src; an nd_array or a writable nd_span
+	/// \param t_halo Largest offset the kernel reads in each dimension, in both directions
+	/// \param t_boundary Completion of windows that reach beyond t_src; a boundary_mode or {mode, value}
+	/// \param t_kernel Callable taking a stencil_window and returning the output element
+	/// \throws std::invalid_argument if the extents differ or t_halo does not have one entry per dimension
+	/// \example
+	/// \code
+	/// cppa::stencil(cppa::par, field, next, {1, 1, 1}, cppa::boundary_mode::wrap,
+	///               [](const auto& w) { return (w(-1, 0, 0) + w(1, 0, 0) + w(0, -1, 0) + w(0, 1, 0) + w(0, 0, -1) + w(0, 0, 1)) / 6.0; });
+	/// \endcode
+	template<typename Policy, typename Src, typename Dst, typename Kernel, std::enable_if_t<detail::is_stencil_call_v<Policy, Src, Dst>, int> = 0>
+	void stencil( const Policy& t_policy, const Src& t_src, Dst&& t_dst, std::initializer_list<size_t> t_halo, const boundary<detail::stencil_value_t<Src>>& t_boundary,
+	              Kernel&& t_kernel )
+	{
+		detail::stencil_spans( t_policy, detail::stencil_operand( t_src ), detail::stencil_target( t_dst ), t_halo, t_boundary, t_kernel );
+	}
+
+	/// \brief Writes t_kernel( window ) to every element of t_dst, the window centred on the same element of t_src
+	/// \param t_src Input, any strides
+	/// \param t_dst Output with the extents of t_src
+	/// \param t_halo Largest offset the kernel reads in each dimension
+	/// \param t_boundary Completion of windows that reach beyond t_src
+	/// \param t_kernel Callable taking a stencil_window and returning the output element
+	/// \throws std::invalid_argument if the extents differ or t_halo does not have one entry per dimension
+	template<typename Src, typename Dst, typename Kernel, std::enable_if_t<detail::is_stencil_call_v<sequential_policy, Src, Dst>, int> = 0>
+	void stencil( const Src& t_src, Dst&& t_dst, std::initializer_list<size_t> t_halo, const boundary<detail::stencil_value_t<Src>>& t_boundary, Kernel&& t_kernel )
+	{
+		stencil( seq, t_src, std::forward<Dst>( t_dst ), t_halo, t_boundary, t_kernel );
+	}
+
+	/// \brief Applies t_kernel around every element of t_src into a new array
+	/// \param t_policy Execution policy
+	/// \param t_src Input, any strides
+	/// \param t_halo Largest offset the kernel reads in each dimension
+	/// \param t_boundary Completion of windows that reach beyond t_src
+	/// \param t_kernel Callable taking a stencil_window and returning the output element
+	/// \return Array with the extents of t_src holding the kernel results
+	/// \throws std::invalid_argument if t_halo does not have one entry per dimension
+	template<typename Policy, typename Src, typename Kernel, std::enable_if_t<detail::is_stencil_call_v<Policy, Src, Src>, int> = 0>
+	[[nodiscard]] detail::stencil_result_t<Src, Kernel> stencil( const Policy& t_policy, const Src& t_src, std::initializer_list<size_t> t_halo,
+	                                                             const boundary<detail::stencil_value_t<Src>>& t_boundary, Kernel&& t_kernel )
+	{
+		const auto src = detail::stencil_operand( t_src );
+		detail::stencil_result_t<Src, Kernel> result( std::vector<size_t>( src.extents( ).begin( ), src.extents( ).end( ) ) );
+		detail::stencil_spans( t_policy, src, result.as_span( ), t_halo, t_boundary, t_kernel );
+		return result;
+	}
+
+	/// \brief Applies t_kernel around every element of t_src into a new array
+	/// \param t_src Input, any strides
+	/// \param t_halo Largest offset the kernel reads in each dimension
+	/// \param t_boundary Completion of windows that reach beyond t_src
+	/// \param t_kernel Callable taking a stencil_window and returning the output element
+	/// \return Array with the extents of t_src holding the kernel results
+	/// \throws std::invalid_argument if t_halo does not have one entry per dimension
+	template<typename Src, typename Kernel, std::enable_if_t<detail::is_stencil_call_v<sequential_policy, Src, Src>, int> = 0>
+	[[nodiscard]] detail::stencil_result_t<Src, Kernel> stencil( const Src& t_src, std::initializer_list<size_t> t_halo, const boundary<detail::stencil_value_t<Src>>& t_boundary,
+	                                                             Kernel&& t_kernel )
+	{
+		return stencil( seq, t_src, t_halo, t_boundary, t_kernel );
+	}
+
+	/// \brief Correlates t_src with t_weights: each output is the weighted sum of the input elements around it
+	/// \tparam Policy Execution policy; cppa::par splits the outermost dimension across threads
+	/// \param t_src Input, any strides
+	/// \param t_weights Weights of the rank of t_src, centred at extent / 2 in each dimension
+	/// \param t_dst Output with the extents of t_src; an nd_array or a writable nd_span
+	/// \param t_boundary Completion of windows that reach beyond t_src (default: constant zero)
+	/// \throws std::invalid_argument if the extents or ranks differ or t_weights is empty
+	/// \note The weights are not mirrored; pass t_weights.flip(d) views for a convolution.
+	template<typename Policy, typename Src, typename Weights, typename Dst,
+	         std::enable_if_t<detail::is_stencil_call_v<Policy, Src, Dst> && detail::is_nd_container<Weights>::value, int> = 0>
+	void correlate( const Policy& t_policy, const Src& t_src, const Weights& t_weights, Dst&& t_dst, const boundary<detail::stencil_value_t<Src>>& t_boundary = { } )
+	{
+		detail::correlate_spans( t_policy, detail::stencil_operand( t_src ), detail::stencil_operand( t_weights ), detail::stencil_target( t_dst ), t_boundary );
+	}
+
+	/// \brief Correlates t_src with t_weights into t_dst
+	/// \param t_src Input, any strides
+	/// \param t_weights Weights of the rank of t_src, centred at extent / 2 in each dimension
+	/// \param t_dst Output with the extents of t_src
+	/// \param t_boundary Completion of windows that reach beyond t_src (default: constant zero)
+	/// \throws std::invalid_argument if the extents or ranks differ or t_weights is empty
+	template<typename Src, typename Weights, typename Dst,
+	         std::enable_if_t<detail::is_stencil_call_v<sequential_policy, Src, Dst> && detail::is_nd_container<Weights>::value, int> = 0>
+	void correlate( const Src& t_src, const Weights& t_weights, Dst&& t_dst, const boundary<detail::stencil_value_t<Src>>& t_boundary = { } )
+	{
+		correlate( seq, t_src, t_weights, std::forward<Dst>( t_dst ), t_boundary );
+	}
+
+	/// \brief Correlates t_src with t_weights into a new array
+	/// \param t_policy Execution policy
+	/// \param t_src Input, any strides
+	/// \param t_weights Weights of the rank of t_src, centred at extent / 2 in each dimension
+	/// \param t_boundary Completion of windows that reach beyond t_src (default: constant zero)
+	/// \return Array with the extents of t_src, of the common type of the input and weight elements
+	/// \throws std::invalid_argument if the ranks differ or t_weights is empty
+	template<typename Policy, typename Src, typename Weights, std::enable_if_t<detail::is_stencil_call_v<Policy, Src, Weights>, int> = 0>
+	[[nodiscard]] detail::correlate_result_t<Src, Weights> correlate( const Policy& t_policy, const Src& t_src, const Weights& t_weights,
+	                                                                  const boundary<detail::stencil_value_t<Src>>& t_boundary = { } )
+	{
+		const auto src = detail::stencil_operand( t_src );
+		detail::correlate_result_t<Src, Weights> result( std::vector<size_t>( src.extents( ).begin( ), src.extents( ).end( ) ) );
+		detail::correlate_spans( t_policy, src, detail::stencil_operand( t_weights ), result.as_span( ), t_boundary );
+		return result;
+	}
+
+	/// \brief Correlates t_src with t_weights into a new array
+	/// \param t_src Input, any strides
+	/// \param t_weights Weights of the rank of t_src, centred at extent / 2 in each dimension
+	/// \param t_boundary Completion of windows that reach beyond t_src (default: constant zero)
+	/// \return Array with the extents of t_src
+	/// \throws std::invalid_argument if the ranks differ or t_weights is empty
+	template<typename Src, typename Weights, std::enable_if_t<detail::is_stencil_call_v<sequential_policy, Src, Weights>, int> = 0>
+	[[nodiscard]] detail::correlate_result_t<Src, Weights> correlate( const Src& t_src, const Weights& t_weights, const boundary<detail::stencil_value_t<Src>>& t_boundary = { } )
+	{
+		return correlate( seq, t_src, t_weights, t_boundary );
+	}
+} // namespace cppa
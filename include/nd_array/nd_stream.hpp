@@ -0,0 +1,290 @@
+#pragma once
+
+#include "nd_array.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/// \file nd_stream.hpp
+/// \brief Multi-buffered streaming of fixed-shape nd_array batches from a producer thread
+///
+/// batch_stream allocates a small ring of equally shaped nd_array buffers once and runs a fill function
+/// on its own thread, which writes the next batch into a free buffer while the consumer still works on
+/// the previous ones. With two buffers (double buffering) loading batch n + 1 overlaps processing batch
+/// n; three buffers also absorb jitter in either stage. No memory is allocated per batch.
+///
+/// \code
+/// cppa::batch_stream<float> stream({256, 3, 224, 224}, [&reader](cppa::nd_span<float> t_batch) {
+///     return reader.read_records(t_batch);  // Rows written; 0 ends the stream
+/// }, 3);
+/// while (auto batch = stream.next()) {
+///     model.forward(batch.view());           // The buffer goes back to the producer when batch dies
+/// }
+/// \endcode
+
+namespace cppa
+{
+	/// \class batch_stream
+	/// \brief Producer thread filling a ring of preallocated nd_array buffers, consumed in order
+	/// \tparam Ty Element type
+	/// \tparam MaxRank Maximum number of dimensions (default: 8)
+	/// \tparam Allocator Allocator of the buffers (default: std::allocator)
+	///
+	/// The fill function receives a view of a whole buffer and returns the number of rows (entries of the
+	/// first dimension) it wrote. Returning fewer rows than the buffer holds yields a short batch, returning
+	/// 0 ends the stream after the batches already filled. An exception thrown by the fill function also
+	/// ends the stream and is rethrown by next() once the batches before it are consumed.
+	///
+	/// \note next() may be called from several consumer threads. Batches must be released before the
+	///       stream is destroyed; destroying the stream waits for a running fill call to return.
+	template<typename Ty, size_t MaxRank = 8, typename Allocator = std::allocator<Ty>>
+	class batch_stream
+	{
+	public:
+		using array_type    = nd_array<Ty, MaxRank, Allocator>;      ///< Type of the buffers
+		using span_type     = nd_span<Ty, MaxRank>;                  ///< View of one buffer
+		using size_type     = size_t;                                ///< Type for sizes and indices
+		using fill_function = std::function<size_type( span_type )>; ///< Writes a batch and returns its rows
+
+		/// \class batch
+		/// \brief Lease of one filled buffer, returned to the producer on destruction or release()
+		class batch
+		{
+		public:
+			/// \brief Constructs an empty lease, as returned by next() at the end of the stream
+			batch( ) noexcept = default;
+
+			batch( batch&& t_other ) noexcept
+			    : m_stream( std::exchange( t_other.m_stream, nullptr ) ), m_slot( t_other.m_slot ), m_rows( t_other.m_rows ), m_sequence( t_other.m_sequence )
+			{
+			}
+
+			batch& operator=( batch&& t_other ) noexcept
+			{
+				if( this != &t_other )
+				{
+					release( );
+					m_stream   = std::exchange( t_other.m_stream, nullptr );
+					m_slot     = t_other.m_slot;
+					m_rows     = t_other.m_rows;
+					m_sequence = t_other.m_sequence;
+				}
+				return *this;
+			}
+
+			batch( const batch& )            = delete;
+			batch& operator=( const batch& ) = delete;
+
+			~batch( ) { release( ); }
+
+			/// \brief True if the lease holds a buffer
+			explicit operator bool( ) const noexcept { return m_stream != nullptr; }
+
+			/// \brief Gets a view of the filled rows of the buffer
+			/// \throws std::logic_error if the lease is empty
+			[[nodiscard]] span_type view( ) const
+			{
+				if( m_stream == nullptr )
+				{
+					throw std::logic_error( "Empty batch has no view" );
+				}
+				span_type whole = m_stream->m_buffers[m_slot].as_span( );
+				return m_rows == whole.extent( 0 ) ? whole : whole.subspan( 0, { 0, m_rows } );
+			}
+
+			/// \brief Number of rows the fill function wrote (0 for an empty lease)
+			[[nodiscard]] size_type rows( ) const noexcept { return m_stream != nullptr ? m_rows : 0; }
+
+			/// \brief Position of the batch in the stream, starting at 0
+			[[nodiscard]] size_type sequence( ) const noexcept { return m_sequence; }
+
+			/// \brief Returns the buffer to the producer; the lease becomes empty
+			void release( ) noexcept
+			{
+				if( m_stream != nullptr )
+				{
+					std::exchange( m_stream, nullptr )->recycle( m_slot );
+				}
+			}
+
+		private:
+			friend class batch_stream;
+
+			batch( batch_stream* t_stream, size_type t_slot, size_type t_rows, size_type t_sequence ) noexcept
+			    : m_stream( t_stream ), m_slot( t_slot ), m_rows( t_rows ), m_sequence( t_sequence )
+			{
+			}
+
+			batch_stream* m_stream = nullptr; ///< Stream owning the buffer, null for an empty lease
+			size_type m_slot       = 0;       ///< Index of the buffer
+			size_type m_rows       = 0;       ///< Rows written by the fill function
+			size_type m_sequence   = 0;       ///< Position in the stream
+		};
+
+		/// \brief Allocates the buffers and starts the producer thread
+		/// \param t_extents Shape of every batch; the first dimension counts rows
+		/// \param t_fill Function writing the next batch, called on the producer thread
+		/// \param t_buffers Number of buffers (2 = double buffering)
+		/// \param t_alloc Allocator of the buffers
+		/// \throws std::invalid_argument if the shape has rank 0, t_fill is empty or t_buffers is 0
+		batch_stream( std::initializer_list<size_type> t_extents, fill_function t_fill, size_type t_buffers = 2, const Allocator& t_alloc = Allocator( ) )
+		    : batch_stream( std::vector<size_type>( t_extents ), std::move( t_fill ), t_buffers, t_alloc )
+		{
+		}
+
+		/// \brief Allocates the buffers and starts the producer thread
+		/// \tparam Container Type of container holding extents (e.g., std::vector<size_t>)
+		/// \param t_extents Shape of every batch; the first dimension counts rows
+		/// \param t_fill Function writing the next batch, called on the producer thread
+		/// \param t_buffers Number of buffers (2 = double buffering)
+		/// \param t_alloc Allocator of the buffers
+		/// \throws std::invalid_argument if the shape has rank 0, t_fill is empty or t_buffers is 0
+		template<typename Container, std::enable_if_t<!std::is_integral_v<Container>, int> = 0>
+		batch_stream( const Container& t_extents, fill_function t_fill, size_type t_buffers = 2, const Allocator& t_alloc = Allocator( ) ) : m_fill( std::move( t_fill ) )
+		{
+			if( t_extents.size( ) == 0 )
+			{
+				throw std::invalid_argument( "Batch rank must be at least 1" );
+			}
+			if( !m_fill )
+			{
+				throw std::invalid_argument( "Fill function must not be empty" );
+			}
+			if( t_buffers == 0 )
+			{
+				throw std::invalid_argument( "Buffer count must not be zero" );
+			}
+			m_buffers.reserve( t_buffers );
+			for( size_type i = 0; i < t_buffers; ++i )
+			{
+				m_buffers.emplace_back( t_extents, t_alloc );
+				m_free.push_back( i );
+			}
+			m_producer = std::thread( [this] { produce( ); } );
+		}
+
+		batch_stream( const batch_stream& )            = delete;
+		batch_stream& operator=( const batch_stream& ) = delete;
+
+		/// \brief Stops the producer after its current fill call and joins it
+		~batch_stream( )
+		{
+			{
+				const std::lock_guard<std::mutex> lock( m_mutex );
+				m_stopping = true;
+			}
+			m_changed.notify_all( );
+			m_producer.join( );
+		}
+
+		/// \brief Waits for the next filled batch
+		/// \return Lease of the batch, or an empty lease once the stream has ended
+		/// \throws Any exception thrown by the fill function, after the batches filled before it
+		[[nodiscard]] batch next( )
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			m_changed.wait( lock, [this] { return !m_ready.empty( ) || m_finished; } );
+			if( !m_ready.empty( ) )
+			{
+				const ready_batch ready = m_ready.front( );
+				m_ready.pop_front( );
+				return batch( this, ready.slot, ready.rows, ready.sequence );
+			}
+			if( m_error != nullptr )
+			{
+				std::rethrow_exception( m_error );
+			}
+			return batch( );
+		}
+
+		/// \brief Number of buffers in the ring
+		[[nodiscard]] size_type buffer_count( ) const noexcept { return m_buffers.size( ); }
+
+		/// \brief Gets the shape of every batch
+		[[nodiscard]] detail::extents_view<size_type> extents( ) const noexcept { return m_buffers.front( ).extents( ); }
+
+	private:
+		/// \brief Filled buffer waiting for a consumer
+		struct ready_batch
+		{
+			size_type slot;
+			size_type rows;
+			size_type sequence;
+		};
+
+		fill_function m_fill;              ///< Writes the next batch, only called by the producer
+		std::vector<array_type> m_buffers; ///< Ring of buffers, allocated once
+		std::mutex m_mutex;                ///< Guards the queues and flags below
+		std::condition_variable m_changed; ///< Signals a ready or a free buffer, the end or a stop
+		std::deque<size_type> m_free;      ///< Buffers the producer may fill
+		std::deque<ready_batch> m_ready;   ///< Filled buffers in stream order
+		std::exception_ptr m_error;        ///< Exception that ended the stream
+		bool m_finished = false;           ///< The producer filled its last batch
+		bool m_stopping = false;           ///< The stream is being destroyed
+		std::thread m_producer;            ///< Runs produce(), started last
+
+		void recycle( size_type t_slot ) noexcept
+		{
+			{
+				const std::lock_guard<std::mutex> lock( m_mutex );
+				m_free.push_back( t_slot );
+			}
+			m_changed.notify_all( );
+		}
+
+		void produce( )
+		{
+			for( size_type sequence = 0;; ++sequence )
+			{
+				size_type slot = 0;
+				{
+					std::unique_lock<std::mutex> lock( m_mutex );
+					m_changed.wait( lock, [this] { return !m_free.empty( ) || m_stopping; } );
+					if( m_stopping )
+					{
+						break;
+					}
+					slot = m_free.front( );
+					m_free.pop_front( );
+				}
+
+				// The buffer belongs to this thread alone until it is queued as ready
+				size_type rows = 0;
+				std::exception_ptr error;
+				try
+				{
+					rows = std::min( m_fill( m_buffers[slot].as_span( ) ), m_buffers[slot].extent( 0 ) );
+				}
+				catch( ... )
+				{
+					error = std::current_exception( );
+				}
+
+				{
+					const std::lock_guard<std::mutex> lock( m_mutex );
+					if( rows > 0 )
+					{
+						m_ready.push_back( { slot, rows, sequence } );
+					}
+					else
+					{
+						m_free.push_back( slot );
+						m_error    = error;
+						m_finished = true;
+					}
+				}
+				m_changed.notify_all( );
+				if( rows == 0 )
+				{
+					break;
+				}
+			}
+		}
+	};
+} // namespace cppa
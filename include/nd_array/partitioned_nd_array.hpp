@@ -0,0 +1,446 @@
+#pragma once
+
+#include "nd_array.hpp"
+
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// \file partitioned_nd_array.hpp
+/// \brief N-dimensional array split along one axis into per-node blocks with halo layers
+///
+/// partitioned_nd_array divides one axis of its index space into contiguous parts, one per NUMA node,
+/// socket or process. Each part is a separate row-major nd_array, allocated and first touched by a
+/// worker thread of its own, so its pages land on the node that later works on it. Parts may carry
+/// ghost (halo) layers on the faces shared with their neighbours, filled by exchange_halos() in-process
+/// or through a user hook, e.g. MPI messages, when neighbouring parts live in other processes.
+///
+/// \code
+/// cppa::partition_options options;
+/// options.halo      = 1;
+/// options.placement = [](size_t t_part) { numa_run_on_node(static_cast<int>(t_part)); };  // libnuma
+/// cppa::partitioned_nd_array<float> grid({8192, 8192}, 2, options);
+///
+/// grid.for_each_part(cppa::par, [&grid](size_t t_part, cppa::nd_span<float> t_local) {
+///     t_local.fill(1.0f);                    // Runs on the thread placed for t_part
+/// });
+/// grid.exchange_halos();                     // Neighbouring boundary rows into the ghost rows
+/// auto padded = grid.local_with_halo(0);     // Input of a stencil over part 0
+/// \endcode
+///
+/// \note Only interior faces get halo layers; the outer faces of the first and last part are left to
+///       the boundary handling of the algorithm (e.g. the boundary modes of nd_stencil.hpp).
+
+namespace cppa
+{
+	/// \brief Options of a partitioned_nd_array
+	struct partition_options
+	{
+		size_t axis = 0;                                                                    ///< Dimension split between the parts
+		size_t halo = 0;                                                                    ///< Ghost layers on each interior face of a part
+		std::pair<size_t, size_t> local_parts = { 0, std::numeric_limits<size_t>::max( ) }; ///< Parts stored in this process, {first, last}
+		std::function<void( size_t )> placement;                                            ///< Called with the part on its worker thread before any work
+	};
+
+	/// \brief Face of a part that a halo layer borders
+	enum class halo_side
+	{
+		lower, ///< Towards the part with the next lower index
+		upper  ///< Towards the part with the next higher index
+	};
+
+	/// \brief One halo layer to fill: a boundary layer owned by one part and the ghost layer of its neighbour
+	/// \tparam Ty Element type
+	/// \tparam MaxRank Maximum number of dimensions supported
+	/// \note Layers of parts stored in another process have the right extents but a null data().
+	template<typename Ty, size_t MaxRank = 8>
+	struct halo_transfer
+	{
+		size_t source_part;                ///< Part owning the boundary layer
+		size_t target_part;                ///< Part whose ghost layer receives it
+		halo_side side;                    ///< Face of the target part the ghost layer is on
+		nd_span<const Ty, MaxRank> source; ///< Owned boundary layer of source_part
+		nd_span<Ty, MaxRank> target;       ///< Ghost layer of target_part
+	};
+
+	/// \class partitioned_nd_array
+	/// \brief Array split along one axis into separately allocated parts with optional halo layers
+	/// \tparam Ty Element type
+	/// \tparam MaxRank Maximum number of dimensions supported (default: 8)
+	/// \tparam Allocator Allocator of the parts (default: std::allocator)
+	///
+	/// Part p owns a contiguous range of the split axis, owned_range(p); the extent is divided as evenly as
+	/// possible. local(p) views the owned elements and local_with_halo(p) additionally the ghost layers. Both
+	/// are plain nd_span views, so any algorithm written against nd_span runs on a part unchanged.
+	template<typename Ty, size_t MaxRank = 8, typename Allocator = std::allocator<Ty>>
+	class partitioned_nd_array
+	{
+	public:
+		using value_type      = Ty;                               ///< Element type
+		using size_type       = size_t;                           ///< Type for sizes and indices
+		using block_type      = nd_array<Ty, MaxRank, Allocator>; ///< Storage of one part
+		using span_type       = nd_span<Ty, MaxRank>;             ///< View of one part
+		using const_span_type = nd_span<const Ty, MaxRank>;       ///< Read-only view of one part
+		using transfer_type   = halo_transfer<Ty, MaxRank>;       ///< Halo layer passed to exchange hooks
+
+		/// \brief Allocates the local parts, each zero-initialized on its own worker thread
+		/// \param t_extents Extents of the whole array
+		/// \param t_parts Number of parts the split axis is divided into
+		/// \param t_options Split axis, halo width, local parts and thread placement
+		/// \param t_alloc Allocator of the parts
+		/// \throws std::invalid_argument if the rank is 0 or exceeds MaxRank, the axis is out of range, t_parts is 0
+		///                               or exceeds the axis extent, or the halo is wider than the smallest part
+		partitioned_nd_array( std::initializer_list<size_type> t_extents, size_type t_parts, partition_options t_options = { },
+		                      const Allocator& t_alloc = Allocator( ) )
+		    : partitioned_nd_array( std::vector<size_type>( t_extents ), t_parts, std::move( t_options ), t_alloc )
+		{
+		}
+
+		/// \brief Allocates the local parts, each zero-initialized on its own worker thread
+		/// \tparam Container Type of container holding extents (e.g., std::vector<size_t>)
+		/// \see partitioned_nd_array(std::initializer_list<size_type>, size_type, partition_options, const Allocator&)
+		template<typename Container, std::enable_if_t<!std::is_integral_v<Container>, int> = 0>
+		partitioned_nd_array( const Container& t_extents, size_type t_parts, partition_options t_options = { }, const Allocator& t_alloc = Allocator( ) )
+		    : m_extents( t_extents.begin( ), t_extents.end( ) ), m_options( std::move( t_options ) )
+		{
+			const size_type rank = m_extents.size( );
+			if( rank == 0 || rank > MaxRank )
+			{
+				throw std::invalid_argument( "Rank must be between 1 and MaxRank" );
+			}
+			if( m_options.axis >= rank )
+			{
+				throw std::invalid_argument( "Partition axis out of range" );
+			}
+			const size_type length = m_extents[m_options.axis];
+			if( t_parts == 0 || t_parts > length )
+			{
+				throw std::invalid_argument( "Part count must be between 1 and the extent of the partition axis" );
+			}
+			if( t_parts > 1 && m_options.halo > length / t_parts )
+			{
+				throw std::invalid_argument( "Halo exceeds the smallest part" );
+			}
+			m_options.local_parts.second = std::min( m_options.local_parts.second, t_parts );
+			if( m_options.local_parts.first > m_options.local_parts.second )
+			{
+				throw std::invalid_argument( "Invalid range of local parts" );
+			}
+
+			// The first length % t_parts parts own one more index than the others
+			m_bounds.resize( t_parts + 1 );
+			for( size_type p = 0; p <= t_parts; ++p )
+			{
+				m_bounds[p] = p * ( length / t_parts ) + std::min( p, length % t_parts );
+			}
+
+			m_blocks.resize( t_parts );
+			run_parts( [this, &t_alloc]( size_type t_part )
+			           {
+				           std::vector<size_type> extents = m_extents;
+				           extents[m_options.axis]        = lower_halo( t_part ) + part_size( t_part ) + upper_halo( t_part );
+				           m_blocks[t_part]               = block_type( extents, t_alloc );
+			           } );
+		}
+
+		/// \brief Number of parts of the split axis, local or not
+		[[nodiscard]] size_type part_count( ) const noexcept { return m_blocks.size( ); }
+
+		/// \brief Dimension split between the parts
+		[[nodiscard]] size_type axis( ) const noexcept { return m_options.axis; }
+
+		/// \brief Ghost layers on each interior face
+		[[nodiscard]] size_type halo( ) const noexcept { return m_options.halo; }
+
+		/// \brief Gets the extents of the whole array
+		[[nodiscard]] detail::extents_view<size_type> extents( ) const noexcept { return { m_extents.data( ), m_extents.size( ) }; }
+
+		/// \brief Checks whether part t_part is stored in this process
+		[[nodiscard]] bool is_local( size_type t_part ) const noexcept { return t_part >= m_options.local_parts.first && t_part < m_options.local_parts.second; }
+
+		/// \brief Gets the range of the split axis owned by a part
+		/// \return Pair of {start (inclusive), end (exclusive)} global indices
+		/// \throws std::out_of_range if t_part is not a part
+		[[nodiscard]] std::pair<size_type, size_type> owned_range( size_type t_part ) const
+		{
+			check_part( t_part );
+			return { m_bounds[t_part], m_bounds[t_part + 1] };
+		}
+
+		/// \brief Finds the part owning a global index of the split axis
+		/// \throws std::out_of_range if t_index is outside the axis
+		[[nodiscard]] size_type part_of( size_type t_index ) const
+		{
+			if( t_index >= m_extents[m_options.axis] )
+			{
+				throw std::out_of_range( "Index out of bounds" );
+			}
+			return static_cast<size_type>( std::upper_bound( m_bounds.begin( ), m_bounds.end( ), t_index ) - m_bounds.begin( ) ) - 1;
+		}
+
+		/// \brief Accesses an element by its global indices
+		/// \param t_indices One index per dimension of the whole array
+		/// \return Reference to the element in the owning part
+		/// \throws std::out_of_range if an index is out of bounds or the owning part is not local
+		template<typename... Indices>
+		[[nodiscard]] Ty& operator( )( Indices... t_indices )
+		{
+			return const_cast<Ty&>( std::as_const( *this )( t_indices... ) );
+		}
+
+		/// \brief Accesses an element by its global indices (const)
+		/// \throws std::out_of_range if an index is out of bounds or the owning part is not local
+		template<typename... Indices>
+		[[nodiscard]] const Ty& operator( )( Indices... t_indices ) const
+		{
+			static_assert( sizeof...( t_indices ) <= MaxRank, "Too many indices" );
+			const std::array<size_type, sizeof...( t_indices )> idx = { static_cast<size_type>( t_indices )... };
+			if( sizeof...( t_indices ) != m_extents.size( ) )
+			{
+				throw std::out_of_range( "Index count does not match the rank" );
+			}
+			const size_type part = part_of( idx[m_options.axis] );
+			if( !is_local( part ) )
+			{
+				throw std::out_of_range( "Element belongs to a part of another process" );
+			}
+
+			const block_type& block = m_blocks[part];
+			std::ptrdiff_t offset   = 0;
+			for( size_type i = 0; i < idx.size( ); ++i )
+			{
+				if( idx[i] >= m_extents[i] )
+				{
+					throw std::out_of_range( "Index out of bounds" );
+				}
+				const size_type local_index = i == m_options.axis ? idx[i] - m_bounds[part] + lower_halo( part ) : idx[i];
+				offset += static_cast<std::ptrdiff_t>( local_index ) * block.stride( i );
+			}
+			return block.data( )[offset];
+		}
+
+		/// \brief Gets the storage of a part, ghost layers included
+		/// \throws std::out_of_range if t_part is not a local part
+		[[nodiscard]] block_type& block( size_type t_part )
+		{
+			check_local( t_part );
+			return m_blocks[t_part];
+		}
+
+		/// \brief Gets the storage of a part, ghost layers included (const)
+		/// \throws std::out_of_range if t_part is not a local part
+		[[nodiscard]] const block_type& block( size_type t_part ) const
+		{
+			check_local( t_part );
+			return m_blocks[t_part];
+		}
+
+		/// \brief Views the elements owned by a part, without its ghost layers
+		/// \throws std::out_of_range if t_part is not a local part
+		[[nodiscard]] span_type local( size_type t_part ) { return owned_view( block( t_part ).as_span( ), t_part ); }
+
+		/// \brief Views the elements owned by a part, without its ghost layers (const)
+		/// \throws std::out_of_range if t_part is not a local part
+		[[nodiscard]] const_span_type local( size_type t_part ) const { return owned_view( block( t_part ).as_span( ), t_part ); }
+
+		/// \brief Views the elements of a part including its ghost layers
+		/// \throws std::out_of_range if t_part is not a local part
+		[[nodiscard]] span_type local_with_halo( size_type t_part ) { return block( t_part ).as_span( ); }
+
+		/// \brief Views the elements of a part including its ghost layers (const)
+		/// \throws std::out_of_range if t_part is not a local part
+		[[nodiscard]] const_span_type local_with_halo( size_type t_part ) const { return block( t_part ).as_span( ); }
+
+		/// \brief Calls t_func( part, local( part ) ) for every local part on the calling thread
+		template<typename Func>
+		void for_each_part( Func&& t_func )
+		{
+			for_each_part( seq, std::forward<Func>( t_func ) );
+		}
+
+		/// \brief Calls t_func( part, local( part ) ) for every local part
+		/// \param t_policy seq runs the parts one after the other on the calling thread; par runs each part on a
+		///                 worker thread of its own, which calls the placement function first
+		/// \param t_func Function receiving the part index and the view of its owned elements
+		/// \throws The first exception thrown by t_func, after all parts finished
+		/// \example
+		/// \code
+		/// grid.for_each_part(cppa::par, [](size_t t_part, cppa::nd_span<float> t_local) {
+		///     t_local.apply([](float& t_x) { t_x *= 0.5f; });  // Node-local memory after placement
+		/// });
+		/// \endcode
+		template<typename Policy, typename Func, std::enable_if_t<is_execution_policy_v<Policy>, int> = 0>
+		void for_each_part( const Policy& /*t_policy*/, Func&& t_func )
+		{
+			if constexpr( std::is_same_v<Policy, parallel_policy> )
+			{
+				run_parts( [this, &t_func]( size_type t_part ) { t_func( t_part, local( t_part ) ); } );
+			}
+			else
+			{
+				for( size_type p = m_options.local_parts.first; p < m_options.local_parts.second; ++p )
+				{
+					t_func( p, local( p ) );
+				}
+			}
+		}
+
+		/// \brief Copies the boundary layers of every local part into the ghost layers of its local neighbours
+		/// \note Faces towards parts of other processes are skipped; use exchange_halos( Func&& ) for them.
+		void exchange_halos( )
+		{
+			exchange_halos(
+			    [this]( const transfer_type& t_transfer )
+			    {
+				    if( is_local( t_transfer.source_part ) && is_local( t_transfer.target_part ) )
+				    {
+					    auto target = t_transfer.target;
+					    target.copy_from( t_transfer.source );
+				    }
+			    } );
+		}
+
+		/// \brief Passes every halo layer with a local source or target to t_exchange
+		/// \tparam Func Callable taking a const transfer_type&
+		/// \param t_exchange Hook filling transfer.target from transfer.source, e.g. a copy for local pairs and
+		///                   an MPI send or receive when one side belongs to another process
+		/// \note Transfers are passed face by face in increasing part order, first towards the upper part, then
+		///       back, so every process calls matching sends and receives in the same order.
+		/// \example
+		/// \code
+		/// grid.exchange_halos([&](const auto& t_transfer) {
+		///     if (!grid.is_local(t_transfer.target_part))
+		///         MPI_Send(t_transfer.source.data(), count, MPI_FLOAT, rank_of(t_transfer.target_part), 0, comm);
+		///     else if (!grid.is_local(t_transfer.source_part))
+		///         MPI_Recv(t_transfer.target.data(), count, MPI_FLOAT, rank_of(t_transfer.source_part), 0, comm, MPI_STATUS_IGNORE);
+		///     else
+		///         t_transfer.target.copy_from(t_transfer.source);
+		/// });
+		/// \endcode
+		template<typename Func>
+		void exchange_halos( Func&& t_exchange )
+		{
+			const size_type halo = m_options.halo;
+			if( halo == 0 )
+			{
+				return;
+			}
+			for( size_type p = 0; p + 1 < part_count( ); ++p )
+			{
+				const size_type q = p + 1;
+				if( !is_local( p ) && !is_local( q ) )
+				{
+					continue;
+				}
+				const size_type p_end = lower_halo( p ) + part_size( p );
+				t_exchange( transfer_type { p, q, halo_side::lower, layer<const Ty>( p, p_end - halo, halo ), layer<Ty>( q, 0, halo ) } );
+				t_exchange( transfer_type { q, p, halo_side::upper, layer<const Ty>( q, halo, halo ), layer<Ty>( p, p_end, halo ) } );
+			}
+		}
+
+	private:
+		std::vector<size_type> m_extents; ///< Extents of the whole array
+		partition_options m_options;      ///< Axis, halo width, local parts and placement
+		std::vector<size_type> m_bounds;  ///< First global index of every part along the axis, and the axis extent
+		std::vector<block_type> m_blocks; ///< Storage of every part; empty for parts of other processes
+
+		[[nodiscard]] size_type part_size( size_type t_part ) const noexcept { return m_bounds[t_part + 1] - m_bounds[t_part]; }
+		[[nodiscard]] size_type lower_halo( size_type t_part ) const noexcept { return t_part > 0 ? m_options.halo : 0; }
+		[[nodiscard]] size_type upper_halo( size_type t_part ) const noexcept { return t_part + 1 < part_count( ) ? m_options.halo : 0; }
+
+		void check_part( size_type t_part ) const
+		{
+			if( t_part >= part_count( ) )
+			{
+				throw std::out_of_range( "Part index out of range" );
+			}
+		}
+
+		void check_local( size_type t_part ) const
+		{
+			check_part( t_part );
+			if( !is_local( t_part ) )
+			{
+				throw std::out_of_range( "Part belongs to another process" );
+			}
+		}
+
+		template<typename View>
+		[[nodiscard]] View owned_view( View t_block, size_type t_part ) const
+		{
+			if( m_options.halo == 0 )
+			{
+				return t_block;
+			}
+			const size_type first = lower_halo( t_part );
+			return t_block.subspan( m_options.axis, { first, first + part_size( t_part ) } );
+		}
+
+		/// \brief Views t_count layers of a part's storage starting at t_first, or their shape only if the part is remote
+		template<typename ElementType>
+		[[nodiscard]] nd_span<ElementType, MaxRank> layer( size_type t_part, size_type t_first, size_type t_count )
+		{
+			if( is_local( t_part ) )
+			{
+				if constexpr( std::is_const_v<ElementType> )
+				{
+					return std::as_const( m_blocks[t_part] ).subspan( m_options.axis, { t_first, t_first + t_count } );
+				}
+				else
+				{
+					return m_blocks[t_part].subspan( m_options.axis, { t_first, t_first + t_count } );
+				}
+			}
+			std::vector<size_type> extents = m_extents;
+			extents[m_options.axis]        = t_count;
+			return nd_span<ElementType, MaxRank>( static_cast<ElementType*>( nullptr ), extents );
+		}
+
+		/// \brief Runs t_func( part ) for every local part, each on a worker thread placed by the placement function
+		template<typename Func>
+		void run_parts( Func&& t_func )
+		{
+			const size_type first = m_options.local_parts.first;
+			const size_type count = m_options.local_parts.second - first;
+			std::vector<std::exception_ptr> errors( count );
+			std::vector<std::thread> workers;
+			workers.reserve( count );
+			for( size_type i = 0; i < count; ++i )
+			{
+				workers.emplace_back(
+				    [this, &t_func, &errors, i, part = first + i]( )
+				    {
+					    try
+					    {
+						    if( m_options.placement )
+						    {
+							    m_options.placement( part );
+						    }
+						    t_func( part );
+					    }
+					    catch( ... )
+					    {
+						    errors[i] = std::current_exception( );
+					    }
+				    } );
+			}
+			for( auto& worker: workers )
+			{
+				worker.join( );
+			}
+			for( const auto& error: errors )
+			{
+				if( error != nullptr )
+				{
+					std::rethrow_exception( error );
+				}
+			}
+		}
+	};
+} // namespace cppa
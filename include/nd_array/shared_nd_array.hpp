@@ -0,0 +1,184 @@
+#pragma once
+
+#include "nd_array.hpp"
+
+#include <memory>
+#include <utility>
+
+/// \file shared_nd_array.hpp
+/// \brief Reference-counted nd_array with copy-on-write views
+///
+/// shared_nd_array shares one nd_array buffer between any number of handles. Copying a handle and taking
+/// subspan/slice/transpose views only bumps an atomic reference count, and every view keeps the buffer
+/// alive. Writing goes through as_mutable_span(), which first copies the viewed elements if another
+/// handle still refers to the buffer, so no handle ever observes another handle's writes.
+///
+/// \code
+/// shared_nd_array<float> frame(std::move(decoded)); // Takes over the buffer, no copy
+/// consumer_a(frame);                                // Each consumer holds a handle
+/// consumer_b(frame.subspan(0, {0, 540}));           // Views share the buffer too
+///
+/// auto roi = frame.subspan(0, {100, 200});
+/// roi.as_mutable_span().fill(0.0f);                 // Copies only the 100 viewed rows
+/// \endcode
+///
+/// \note Handles may be copied and read from several threads. A single handle must not be mutated
+///       concurrently with other uses of the same handle, as for std::shared_ptr.
+
+namespace cppa
+{
+	/// \class shared_nd_array
+	/// \brief Shared, read-mostly view of a reference-counted nd_array buffer
+	/// \tparam Ty Element type
+	/// \tparam MaxRank Maximum number of dimensions (default: 8)
+	/// \tparam Allocator Allocator of the shared buffer and of copy-on-write copies (default: std::allocator)
+	template<typename Ty, size_t MaxRank = 8, typename Allocator = std::allocator<Ty>>
+	class shared_nd_array
+	{
+	public:
+		using array_type        = nd_array<Ty, MaxRank, Allocator>; ///< Owner of the shared buffer
+		using view_type         = nd_span<const Ty, MaxRank>;       ///< Read-only view of the elements
+		using mutable_view_type = nd_span<Ty, MaxRank>;             ///< Writable view returned after copy-on-write
+		using value_type        = Ty;                               ///< Type of elements
+		using size_type         = size_t;                           ///< Type for sizes and indices
+		using stride_type       = std::ptrdiff_t;                   ///< Signed stride in elements
+		using const_reference   = const Ty&;                        ///< Const reference to element
+		using const_pointer     = const Ty*;                        ///< Const pointer to element
+
+		/// \brief Constructs an empty handle that owns no buffer
+		shared_nd_array( ) noexcept : m_view( nullptr, std::array<size_type, MaxRank> { }, std::array<stride_type, MaxRank> { }, size_type { 0 } ) {}
+
+		/// \brief Takes over the buffer of t_array without copying the elements
+		/// \param t_array Array to share; left empty
+		shared_nd_array( array_type&& t_array ) // NOLINT(google-explicit-constructor)
+		    : m_owner( std::make_shared<array_type>( std::move( t_array ) ) )
+		    , m_view( std::as_const( *m_owner ).as_span( ) )
+		{
+		}
+
+		/// \brief Shares a deep copy of t_array
+		/// \param t_array Array to copy
+		explicit shared_nd_array( const array_type& t_array ) : shared_nd_array( array_type( t_array ) ) {}
+
+		/// \brief Gets a read-only view of the elements
+		/// \note The view does not keep the buffer alive on its own
+		[[nodiscard]] const view_type& view( ) const noexcept { return m_view; }
+
+		/// \brief Gets a writable view, copying the viewed elements first if the buffer is shared
+		/// \return View of elements that no other handle refers to
+		/// \note The copy is row-major and holds only the viewed elements, so writing to a small view of a
+		///       large shared buffer copies only that view. Unique handles return a view of their buffer.
+		[[nodiscard]] mutable_view_type as_mutable_span( )
+		{
+			if( m_owner != nullptr && m_owner.use_count( ) > 1 )
+			{
+				auto copy = std::make_shared<array_type>( m_view, m_owner->get_allocator( ) );
+				m_view    = std::as_const( *copy ).as_span( );
+				m_owner   = std::move( copy );
+			}
+
+			std::array<size_type, MaxRank> extents { };
+			std::array<stride_type, MaxRank> strides { };
+			for( size_type i = 0; i < m_view.rank( ); ++i )
+			{
+				extents[i] = m_view.extent( i );
+				strides[i] = m_view.stride( i );
+			}
+			// The buffer is owned by this handle alone, so writing through it is not observable elsewhere
+			return mutable_view_type( const_cast<Ty*>( m_view.data( ) ), extents, strides, m_view.rank( ) ); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+		}
+
+		/// \brief Copies the viewed elements into a new row-major array
+		[[nodiscard]] array_type to_array( ) const
+		{
+			return m_owner != nullptr ? array_type( m_view, m_owner->get_allocator( ) ) : array_type( );
+		}
+
+		/// \brief Number of handles sharing the buffer (0 for an empty handle)
+		[[nodiscard]] long use_count( ) const noexcept { return m_owner.use_count( ); }
+
+		/// \brief True if no other handle shares the buffer, so as_mutable_span() will not copy
+		[[nodiscard]] bool is_unique( ) const noexcept { return m_owner.use_count( ) <= 1; }
+
+		/// \brief Accesses an element for reading
+		/// \param t_indices Multi-dimensional indices (i, j, k, ...)
+		/// \throws std::out_of_range if any index is out of bounds
+		template<typename... Indices>
+		[[nodiscard]] const_reference operator( )( Indices... t_indices ) const
+		{
+			return m_view( t_indices... );
+		}
+
+		/// \brief Gets the extent of a dimension
+		/// \throws std::out_of_range if t_dim >= rank()
+		[[nodiscard]] size_type extent( size_type t_dim ) const { return m_view.extent( t_dim ); }
+
+		/// \brief Gets the stride of a dimension in elements
+		/// \throws std::out_of_range if t_dim >= rank()
+		[[nodiscard]] stride_type stride( size_type t_dim ) const { return m_view.stride( t_dim ); }
+
+		/// \brief Gets the active extents as a view sized to rank()
+		[[nodiscard]] detail::extents_view<size_type> extents( ) const noexcept { return m_view.extents( ); }
+
+		/// \brief Gets the total number of elements in the view
+		[[nodiscard]] size_type size( ) const noexcept { return m_view.size( ); }
+
+		/// \brief Gets the number of dimensions
+		[[nodiscard]] size_type rank( ) const noexcept { return m_view.rank( ); }
+
+		/// \brief Gets a pointer to the first viewed element
+		[[nodiscard]] const_pointer data( ) const noexcept { return m_view.data( ); }
+
+		/// \brief Creates a handle viewing a range of a dimension, sharing the buffer
+		/// \param t_dim Dimension to slice
+		/// \param t_range Half-open range {begin, end}
+		/// \throws std::out_of_range if the dimension or range is invalid
+		[[nodiscard]] shared_nd_array subspan( size_type t_dim, std::pair<size_type, size_type> t_range ) const { return with_view( m_view.subspan( t_dim, t_range ) ); }
+
+		/// \brief Creates a handle viewing every t_step-th element of a range, sharing the buffer
+		/// \param t_dim Dimension to slice
+		/// \param t_range Half-open range {begin, end}
+		/// \param t_step Non-zero step; negative steps walk the range backwards
+		/// \throws std::out_of_range if the dimension or range is invalid
+		/// \throws std::invalid_argument if t_step is zero
+		[[nodiscard]] shared_nd_array subspan( size_type t_dim, std::pair<size_type, size_type> t_range, stride_type t_step ) const
+		{
+			return with_view( m_view.subspan( t_dim, t_range, t_step ) );
+		}
+
+		/// \brief Creates a handle with one dimension fixed, sharing the buffer
+		/// \param t_dim Dimension to remove
+		/// \param t_index Index along t_dim
+		/// \throws std::out_of_range if the dimension or index is invalid
+		[[nodiscard]] shared_nd_array slice( size_type t_dim, size_type t_index ) const { return with_view( m_view.slice( t_dim, t_index ) ); }
+
+		/// \brief Creates a handle with permuted axes, sharing the buffer
+		/// \param t_axes Permutation of axes
+		/// \throws std::invalid_argument if t_axes is not a valid permutation
+		[[nodiscard]] shared_nd_array transpose( std::initializer_list<size_type> t_axes ) const { return with_view( m_view.transpose( t_axes ) ); }
+
+		/// \brief Creates a handle with the last two axes swapped, sharing the buffer
+		[[nodiscard]] shared_nd_array T( ) const { return with_view( m_view.T( ) ); } // NOLINT(readability-identifier-naming)
+
+		/// \brief Creates a handle with one dimension reversed, sharing the buffer
+		/// \throws std::out_of_range if t_dim >= rank()
+		[[nodiscard]] shared_nd_array flip( size_type t_dim ) const { return with_view( m_view.flip( t_dim ) ); }
+
+		/// \brief Creates a reshaped handle, sharing the buffer
+		/// \param t_new_extents New shape extents, with the same total size
+		/// \throws std::invalid_argument if the total size differs
+		/// \throws std::runtime_error if the view is not contiguous
+		[[nodiscard]] shared_nd_array reshape( std::initializer_list<size_type> t_new_extents ) const { return with_view( m_view.reshape( t_new_extents ) ); }
+
+	private:
+		std::shared_ptr<array_type> m_owner; ///< Shared owner of the buffer, null for an empty handle
+		view_type m_view;                    ///< Window of this handle into the shared buffer
+
+		[[nodiscard]] shared_nd_array with_view( const view_type& t_view ) const
+		{
+			shared_nd_array result( *this );
+			result.m_view = t_view;
+			return result;
+		}
+	};
+} // namespace cppa
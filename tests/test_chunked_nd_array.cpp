@@ -0,0 +1,214 @@
+#include "nd_array/chunked_nd_array.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+using namespace cppa;
+
+namespace
+{
+	float value_at( size_t t_i, size_t t_j, size_t t_k ) { return static_cast<float>( t_i * 10000 + t_j * 100 + t_k ); }
+
+	chunked_nd_array<float> make_volume( )
+	{
+		// 7x6x5 in 3x4x2 chunks: 3x2x3 grid with clipped edge chunks
+		chunked_nd_array<float> volume( { 7, 6, 5 }, { 3, 4, 2 }, -1.0f );
+		for( size_t i = 0; i < 7; ++i )
+		{
+			for( size_t j = 0; j < 6; ++j )
+			{
+				for( size_t k = 0; k < 5; ++k )
+				{
+					volume( i, j, k ) = value_at( i, j, k );
+				}
+			}
+		}
+		return volume;
+	}
+} // namespace
+
+TEST_CASE( "chunked_nd_array - Construction and lazy allocation", "[chunked][construction]" )
+{
+	chunked_nd_array<int> grid( { 100, 50 }, { 16, 16 }, 7 );
+
+	SECTION( "Shape queries" )
+	{
+		REQUIRE( grid.rank( ) == 2 );
+		REQUIRE( grid.extent( 0 ) == 100 );
+		REQUIRE( grid.size( ) == 5000 );
+		REQUIRE( grid.chunk_extent( 1 ) == 16 );
+		REQUIRE( grid.chunk_count( ) == 7 * 4 );
+		REQUIRE( grid.allocated_chunk_count( ) == 0 );
+		REQUIRE( grid.fill_value( ) == 7 );
+	}
+
+	SECTION( "Reads through const access do not allocate" )
+	{
+		const auto& cgrid = grid;
+		REQUIRE( cgrid( 99, 49 ) == 7 );
+		REQUIRE( grid.allocated_chunk_count( ) == 0 );
+	}
+
+	SECTION( "Writes allocate only the touched chunk" )
+	{
+		grid( 20, 40 ) = 1;
+		REQUIRE( grid.allocated_chunk_count( ) == 1 );
+		REQUIRE( grid( 20, 40 ) == 1 );
+		REQUIRE( grid( 21, 40 ) == 7 );
+
+		grid( 99, 49 ) = 2;
+		REQUIRE( grid.allocated_chunk_count( ) == 2 );
+
+		grid.clear( );
+		REQUIRE( grid.allocated_chunk_count( ) == 0 );
+		REQUIRE( static_cast<const chunked_nd_array<int>&>( grid )( 20, 40 ) == 7 );
+	}
+
+	SECTION( "Container extents" )
+	{
+		std::vector<size_t> extents = { 4, 4, 4 };
+		std::vector<size_t> chunks  = { 2, 2, 2 };
+		chunked_nd_array<double> cube( extents, chunks );
+		REQUIRE( cube.chunk_count( ) == 8 );
+	}
+
+	SECTION( "Invalid arguments" )
+	{
+		REQUIRE_THROWS_AS( chunked_nd_array<int>( { 4, 4 }, { 2 } ), std::invalid_argument );
+		REQUIRE_THROWS_AS( chunked_nd_array<int>( { 4, 4 }, { 2, 0 } ), std::invalid_argument );
+		REQUIRE_THROWS_AS( grid( 100, 0 ), std::out_of_range );
+		REQUIRE_THROWS_AS( grid.extent( 2 ), std::out_of_range );
+	}
+}
+
+TEST_CASE( "chunked_nd_array - Subspan and slice views", "[chunked][subspan][slice]" )
+{
+	auto volume = make_volume( );
+
+	SECTION( "Element access through views" )
+	{
+		auto roi = volume.subspan( { { 2, 6 }, { 1, 5 } } );
+		REQUIRE( roi.rank( ) == 3 );
+		REQUIRE( roi.extent( 0 ) == 4 );
+		REQUIRE( roi.extent( 2 ) == 5 );
+		REQUIRE( roi( 1, 2, 3 ) == value_at( 3, 3, 3 ) );
+
+		auto plane = volume.slice( 1, 4 );
+		REQUIRE( plane.rank( ) == 2 );
+		REQUIRE( plane.extent( 0 ) == 7 );
+		REQUIRE( plane.extent( 1 ) == 5 );
+		REQUIRE( plane( 6, 4 ) == value_at( 6, 4, 4 ) );
+
+		plane( 0, 0 ) = 123.0f;
+		REQUIRE( volume( 0, 4, 0 ) == 123.0f );
+
+		REQUIRE_THROWS_AS( plane( 7, 0 ), std::out_of_range );
+		REQUIRE_THROWS_AS( volume.subspan( 0, { 3, 8 } ), std::out_of_range );
+		REQUIRE_THROWS_AS( volume.slice( 3, 0 ), std::out_of_range );
+	}
+
+	SECTION( "copy_to gathers only the needed chunks" )
+	{
+		auto roi = volume.subspan( 0, { 2, 6 } ).subspan( 2, { 1, 4 } ).slice( 1, 3 );
+		nd_array<float> dense( 4, 3 );
+		roi.copy_to( dense.as_span( ) );
+		for( size_t i = 0; i < 4; ++i )
+		{
+			for( size_t k = 0; k < 3; ++k )
+			{
+				REQUIRE( dense( i, k ) == value_at( i + 2, 3, k + 1 ) );
+			}
+		}
+
+		nd_array<float> wrong( 3, 3 );
+		REQUIRE_THROWS_AS( roi.copy_to( wrong.as_span( ) ), std::invalid_argument );
+	}
+
+	SECTION( "copy_from writes into sparse storage" )
+	{
+		chunked_nd_array<float> sparse( { 7, 6, 5 }, { 3, 4, 2 } );
+		nd_array<float> block( 2, 2 );
+		block.fill( 5.0f );
+		sparse.slice( 2, 0 ).subspan( { { 2, 4 }, { 3, 5 } } ).copy_from( block.as_span( ) );
+		// Rows 2..3 span two chunk rows, columns 3..4 two chunk columns, all in the first depth chunk
+		REQUIRE( sparse.allocated_chunk_count( ) == 4 );
+		REQUIRE( sparse( 3, 4, 0 ) == 5.0f );
+		REQUIRE( sparse( 3, 4, 1 ) == 0.0f );
+
+		nd_array<float> dense( 7, 6, 5 );
+		sparse.as_view( ).copy_to( dense.as_span( ) );
+		REQUIRE( dense( 2, 3, 0 ) == 5.0f );
+		REQUIRE( dense( 0, 0, 0 ) == 0.0f );
+	}
+}
+
+TEST_CASE( "chunked_nd_array - Per-chunk traversal", "[chunked][iterators]" )
+{
+	auto volume = make_volume( );
+
+	SECTION( "Parts cover the region exactly once" )
+	{
+		auto roi = volume.subspan( { { 1, 7 }, { 2, 6 }, { 1, 4 } } );
+		nd_array<int> hits( 6, 4, 3 );
+		size_t parts = 0;
+		roi.for_each_chunk(
+		    [&]( const std::array<size_t, 8>& t_origin, nd_span<float> t_part )
+		    {
+			    REQUIRE( t_part.rank( ) == 3 );
+			    ++parts;
+			    for( size_t i = 0; i < t_part.extent( 0 ); ++i )
+			    {
+				    for( size_t j = 0; j < t_part.extent( 1 ); ++j )
+				    {
+					    for( size_t k = 0; k < t_part.extent( 2 ); ++k )
+					    {
+						    ++hits( t_origin[0] + i, t_origin[1] + j, t_origin[2] + k );
+						    REQUIRE( t_part( i, j, k ) == value_at( t_origin[0] + i + 1, t_origin[1] + j + 2, t_origin[2] + k + 1 ) );
+					    }
+				    }
+			    }
+		    } );
+		// Rows 1..6 hit chunk rows 0..2, columns 2..5 chunk columns 0..1, depth 1..3 chunk depths 0..1
+		REQUIRE( parts == 3 * 2 * 2 );
+		for( const int count: hits )
+		{
+			REQUIRE( count == 1 );
+		}
+	}
+
+	SECTION( "Unallocated chunks are skipped" )
+	{
+		chunked_nd_array<float> sparse( { 64, 64 }, { 16, 16 } );
+		sparse( 5, 5 )   = 1.0f;
+		sparse( 40, 40 ) = 2.0f;
+
+		const auto& csparse = sparse;
+		size_t parts        = 0;
+		float total         = 0.0f;
+		csparse.for_each_chunk(
+		    [&]( const std::array<size_t, 8>&, nd_span<const float> t_part )
+		    {
+			    ++parts;
+			    REQUIRE( t_part.extent( 0 ) == 16 );
+			    total += t_part.reduce( 0.0f, std::plus<>( ) );
+		    } );
+		REQUIRE( parts == 2 );
+		REQUIRE( total == 3.0f );
+		REQUIRE( sparse.allocated_chunk_count( ) == 2 );
+	}
+
+	SECTION( "Sliced traversal yields lower-rank parts" )
+	{
+		size_t elements = 0;
+		volume.slice( 0, 4 ).for_each_chunk(
+		    [&]( const std::array<size_t, 8>& t_origin, nd_span<float> t_part )
+		    {
+			    REQUIRE( t_part.rank( ) == 2 );
+			    REQUIRE( t_part( 0, 0 ) == value_at( 4, t_origin[0], t_origin[1] ) );
+			    elements += t_part.size( );
+		    } );
+		REQUIRE( elements == 6 * 5 );
+	}
+}
@@ -1,7 +1,14 @@
 #include "nd_array/nd_array.hpp"
 
 #include <catch2/catch_template_test_macros.hpp>
+#include <algorithm>
+#include <array>
 #include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
 #include <vector>
 
 
@@ -63,6 +70,35 @@ TEST_CASE( "nd_array - Construction", "[nd_array][construction]" )
 		REQUIRE( arr.extent( 1 ) == 3 );
 		REQUIRE( arr.extent( 2 ) == 4 );
 	}
+
+	SECTION( "Uninitialized constructor" )
+	{
+		nd_array<float> arr( cppa::uninitialized, 4, 5 );
+		REQUIRE( arr.rank( ) == 2 );
+		REQUIRE( arr.size( ) == 20 );
+		arr.fill( 2.0f );
+		REQUIRE( arr( 3, 4 ) == 2.0f );
+
+		// Non-trivial element types are still constructed
+		nd_array<std::vector<int>> vectors( cppa::uninitialized, 3 );
+		REQUIRE( vectors( 2 ).empty( ) );
+	}
+
+	SECTION( "Parallel first-touch constructor" )
+	{
+		nd_array<double> arr( first_touch_t { 4 }, 10, 3 );
+		REQUIRE( arr.size( ) == 30 );
+		for( const auto& v: arr )
+		{
+			REQUIRE( v == 0.0 );
+		}
+
+		// More threads than rows and empty arrays are fine
+		nd_array<int> wide( first_touch_t { 64 }, 2, 1000 );
+		REQUIRE( wide( 1, 999 ) == 0 );
+		nd_array<int> empty( first_touch_t { 4 }, 0, 8 );
+		REQUIRE( empty.size( ) == 0 );
+	}
 }
 
 TEST_CASE( "nd_array - Element access", "[nd_array][access]" )
@@ -135,6 +171,22 @@ TEST_CASE( "nd_array - Element access", "[nd_array][access]" )
 		REQUIRE_THROWS_AS( arr( 3, 0 ), std::out_of_range );
 		REQUIRE_THROWS_AS( arr( 0, 4 ), std::out_of_range );
 	}
+
+	SECTION( "Unchecked access" )
+	{
+		nd_array<int> arr( 3, 4 );
+		for( size_t i = 0; i < 3; ++i )
+		{
+			for( size_t j = 0; j < 4; ++j )
+			{
+				arr.unchecked( i, j ) = static_cast<int>( i * 4 + j );
+			}
+		}
+
+		const nd_array<int>& carr = arr;
+		REQUIRE( carr.unchecked( 2, 3 ) == 11 );
+		REQUIRE( arr( 1, 2 ) == 6 );
+	}
 }
 
 TEST_CASE( "nd_array - Copy semantics", "[nd_array][copy]" )
@@ -434,6 +486,66 @@ TEST_CASE( "nd_array - Shape transforms", "[nd_array][reshape][transpose][flatte
 	}
 }
 
+TEST_CASE( "nd_array - Materializing transpose", "[nd_array][transpose][copy]" )
+{
+	// Sizes that are not multiples of the tile edge exercise the partial tiles
+	auto make_matrix = []( size_t t_rows, size_t t_cols )
+	{
+		nd_array<int> result( t_rows, t_cols );
+		int value = 0;
+		for( auto& element: result )
+		{
+			element = value++;
+		}
+		return result;
+	};
+
+	SECTION( "Out-of-place transpose of a large matrix" )
+	{
+		const auto m  = make_matrix( 97, 70 );
+		const auto mt = m.transpose_copy( );
+		REQUIRE( mt.extent( 0 ) == 70 );
+		REQUIRE( mt.extent( 1 ) == 97 );
+		REQUIRE( mt.as_span( ).is_contiguous( ) );
+		bool all_equal = true;
+		for( size_t i = 0; i < 97; ++i )
+		{
+			for( size_t j = 0; j < 70; ++j )
+			{
+				all_equal = all_equal && mt( j, i ) == m( i, j );
+			}
+		}
+		REQUIRE( all_equal );
+	}
+
+	SECTION( "Arbitrary axis permutation" )
+	{
+		nd_array<double> cube( 5, 40, 36 );
+		double value = 0.0;
+		for( auto& element: cube )
+		{
+			element = value++;
+		}
+		const auto permuted = cube.transpose_copy( { 2, 0, 1 } );
+		REQUIRE( permuted.extent( 0 ) == 36 );
+		REQUIRE( std::equal( permuted.begin( ), permuted.end( ), cube.transpose( { 2, 0, 1 } ).begin( ) ) );
+		REQUIRE_THROWS_AS( cube.transpose_copy( { 0, 0, 1 } ), std::invalid_argument );
+	}
+
+	SECTION( "In-place transpose of a square matrix" )
+	{
+		auto m             = make_matrix( 67, 67 );
+		const auto reference = m.transpose_copy( );
+		const int* buffer  = m.data( );
+		m.transpose_inplace( );
+		REQUIRE( m.data( ) == buffer );
+		REQUIRE( std::equal( m.begin( ), m.end( ), reference.begin( ) ) );
+
+		auto rectangular = make_matrix( 3, 4 );
+		REQUIRE_THROWS_AS( rectangular.transpose_inplace( ), std::invalid_argument );
+	}
+}
+
 TEST_CASE( "nd_array - Iterators and extents", "[nd_array][iterators][extents][stride]" )
 {
 	SECTION( "Stride values" )
@@ -552,3 +664,355 @@ TEST_CASE( "nd_array - Array to span", "[nd_array][span][view]" )
 		REQUIRE( span( 3 ) == 2.71 );
 	}
 }
+
+TEST_CASE( "nd_array - Execution policies", "[nd_array][operations][parallel]" )
+{
+	SECTION( "Fill and apply match the sequential result" )
+	{
+		nd_array<int> arr( 37, 5, 3 );
+		arr.fill( parallel_policy { 4 }, 2 );
+		arr.apply( par, []( int t_value ) { return t_value * 3; } );
+		REQUIRE( std::all_of( arr.begin( ), arr.end( ), []( int t_value ) { return t_value == 6; } ) );
+	}
+
+	SECTION( "More threads than rows" )
+	{
+		nd_array<int> arr( 3, 4 );
+		arr.fill( parallel_policy { 16 }, 7 );
+		REQUIRE( arr.reduce( parallel_policy { 16 }, 0, std::plus<>( ) ) == 7 * 12 );
+	}
+
+	SECTION( "Reduce and transform_reduce" )
+	{
+		nd_array<long> arr( 100, 10 );
+		long value = 0;
+		for( auto& element: arr )
+		{
+			element = value++;
+		}
+		const long expected = 999 * 1000 / 2;
+		REQUIRE( arr.reduce( 0L, std::plus<>( ) ) == expected );
+		REQUIRE( arr.reduce( parallel_policy { 8 }, 0L, std::plus<>( ) ) == expected );
+		REQUIRE( arr.reduce( par, 5L, std::plus<>( ) ) == expected + 5 );
+		REQUIRE( arr.transform_reduce( parallel_policy { 3 }, 0L, std::plus<>( ), []( long t_value ) { return t_value % 2; } ) == 500 );
+		REQUIRE( arr.transform_reduce( 0L, std::plus<>( ), []( long t_value ) { return t_value % 2; } ) == 500 );
+
+		const nd_array<long> empty;
+		REQUIRE( empty.reduce( par, 42L, std::plus<>( ) ) == 42 );
+	}
+
+	SECTION( "Transform and copy from a strided view" )
+	{
+		nd_array<int> src( 8, 6 );
+		int value = 0;
+		for( auto& element: src )
+		{
+			element = value++;
+		}
+
+		nd_array<double> dst( 6, 8 );
+		dst.transform( parallel_policy { 3 }, src.T( ), []( int t_value ) { return t_value * 0.5; } );
+		REQUIRE( dst( 5, 7 ) == src( 7, 5 ) * 0.5 );
+		REQUIRE( dst( 2, 1 ) == src( 1, 2 ) * 0.5 );
+
+		dst.copy_from( par, src.T( ) );
+		REQUIRE( dst( 4, 3 ) == 22.0 );
+
+		nd_array<double> wrong( 8, 6 );
+		REQUIRE_THROWS_AS( wrong.copy_from( src.T( ) ), std::invalid_argument );
+	}
+
+	SECTION( "Exceptions from worker threads propagate" )
+	{
+		nd_array<int> arr( 16, 2 );
+		arr.fill( 1 );
+		REQUIRE_THROWS_AS( arr.apply( parallel_policy { 4 },
+		                              []( int ) -> int
+		                              { throw std::runtime_error( "worker failed" ); } ),
+		                   std::runtime_error );
+	}
+}
+
+namespace
+{
+	/// \brief Minimal stateful allocator that records allocation traffic
+	template<typename Ty>
+	struct counting_allocator
+	{
+		using value_type = Ty;
+
+		size_t* allocations;
+		size_t* live_elements;
+
+		counting_allocator( size_t* t_allocations, size_t* t_live ) noexcept : allocations( t_allocations ), live_elements( t_live ) {}
+
+		template<typename Other>
+		counting_allocator( const counting_allocator<Other>& t_other ) noexcept : allocations( t_other.allocations ), live_elements( t_other.live_elements )
+		{
+		}
+
+		Ty* allocate( size_t t_count )
+		{
+			++*allocations;
+			*live_elements += t_count;
+			return std::allocator<Ty>( ).allocate( t_count );
+		}
+
+		void deallocate( Ty* t_ptr, size_t t_count ) noexcept
+		{
+			*live_elements -= t_count;
+			std::allocator<Ty>( ).deallocate( t_ptr, t_count );
+		}
+
+		template<typename Other>
+		bool operator==( const counting_allocator<Other>& t_other ) const noexcept
+		{
+			return allocations == t_other.allocations;
+		}
+
+		template<typename Other>
+		bool operator!=( const counting_allocator<Other>& t_other ) const noexcept
+		{
+			return !( *this == t_other );
+		}
+	};
+} // namespace
+
+TEST_CASE( "nd_array - Allocators", "[nd_array][allocator]" )
+{
+	SECTION( "Single allocation through a custom allocator" )
+	{
+		size_t allocations = 0;
+		size_t live        = 0;
+		{
+			using array_type = nd_array<int, 8, counting_allocator<int>>;
+			counting_allocator<int> alloc( &allocations, &live );
+
+			array_type arr( std::allocator_arg, alloc, 3, 4 );
+			REQUIRE( allocations == 1 );
+			REQUIRE( live == 12 );
+			REQUIRE( arr( 2, 3 ) == 0 );
+			REQUIRE( arr.get_allocator( ) == alloc );
+
+			array_type copy( arr );
+			REQUIRE( allocations == 2 );
+			REQUIRE( live == 24 );
+
+			array_type moved( std::move( copy ) );
+			REQUIRE( allocations == 2 );
+
+			array_type from_list( { 2, 2 }, alloc );
+			array_type from_container( std::vector<size_t> { 5 }, alloc );
+			array_type from_span( arr.subspan( 0, { 0, 2 } ), alloc );
+			REQUIRE( allocations == 5 );
+			REQUIRE( from_span.size( ) == 8 );
+		}
+		REQUIRE( live == 0 );
+	}
+
+	SECTION( "Aligned allocator with padded rows" )
+	{
+		REQUIRE( padded_extent<float>( 1000 ) == 1008 );
+		REQUIRE( padded_extent<double>( 3, 32 ) == 4 );
+		REQUIRE( padded_extent<float>( 16 ) == 16 );
+
+		const size_t cols = 10;
+		aligned_nd_array<float> storage( 5, padded_extent<float>( cols ) );
+		REQUIRE( reinterpret_cast<std::uintptr_t>( storage.data( ) ) % 64 == 0 );
+
+		auto image = storage.subspan( 1, { 0, cols } );
+		REQUIRE( image.extent( 1 ) == cols );
+		REQUIRE( image.has_contiguous_rows( ) );
+		REQUIRE_FALSE( image.is_contiguous( ) );
+		for( size_t i = 0; i < image.extent( 0 ); ++i )
+		{
+			REQUIRE( reinterpret_cast<std::uintptr_t>( &image( i, 0 ) ) % 64 == 0 );
+		}
+		REQUIRE_THROWS_AS( image.flatten( ), std::runtime_error );
+	}
+
+	SECTION( "Inline storage for small arrays" )
+	{
+		size_t allocations = 0;
+		size_t live        = 0;
+		{
+			using array_type = nd_array<int, 8, counting_allocator<int>, 16>;
+			counting_allocator<int> alloc( &allocations, &live );
+
+			array_type small( std::allocator_arg, alloc, 4, 4 );
+			small( 3, 3 ) = 7;
+			const auto* bytes = reinterpret_cast<const std::byte*>( &small );
+			REQUIRE( allocations == 0 );
+			REQUIRE( reinterpret_cast<const std::byte*>( small.data( ) ) >= bytes );
+			REQUIRE( reinterpret_cast<const std::byte*>( small.data( ) ) < bytes + sizeof( small ) );
+
+			array_type copy( small );
+			array_type moved( std::move( copy ) );
+			REQUIRE( allocations == 0 );
+			REQUIRE( moved( 3, 3 ) == 7 );
+			REQUIRE( moved.data( ) != small.data( ) );
+
+			// Larger arrays fall back to the allocator and keep pointer-stealing moves
+			array_type large( std::allocator_arg, alloc, 5, 5 );
+			REQUIRE( allocations == 1 );
+			const auto* data = large.data( );
+			array_type stolen( std::move( large ) );
+			REQUIRE( stolen.data( ) == data );
+			REQUIRE( allocations == 1 );
+
+			moved = std::move( stolen );
+			REQUIRE( moved.data( ) == data );
+			REQUIRE( moved.size( ) == 25 );
+			// Smaller copies reuse the heap buffer
+			moved = small;
+			REQUIRE( moved( 3, 3 ) == 7 );
+			REQUIRE( moved.capacity( ) == 25 );
+		}
+		REQUIRE( live == 0 );
+
+		REQUIRE( sizeof( small_nd_array<float, 16> ) >= sizeof( nd_array<float> ) + 16 * sizeof( float ) );
+		small_nd_array<float, 16> transform( 4, 4 );
+		transform.fill( 1.0f );
+		small_nd_array<float, 16> target( 2 );
+		target = std::move( transform );
+		REQUIRE( target.size( ) == 16 );
+		REQUIRE( target( 3, 3 ) == 1.0f );
+	}
+
+#if __has_include( <memory_resource> )
+	SECTION( "Polymorphic allocator backed by an arena" )
+	{
+		std::array<std::byte, 1024> buffer { };
+		std::pmr::monotonic_buffer_resource arena( buffer.data( ), buffer.size( ), std::pmr::null_memory_resource( ) );
+
+		pmr::nd_array<float> arr( { 4, 8 }, &arena );
+		arr.fill( 1.5f );
+
+		const auto* first = reinterpret_cast<const std::byte*>( arr.data( ) );
+		REQUIRE( first >= buffer.data( ) );
+		REQUIRE( first + arr.size( ) * sizeof( float ) <= buffer.data( ) + buffer.size( ) );
+		REQUIRE( arr( 3, 7 ) == 1.5f );
+
+		// Copies default to the global resource, copies with an allocator stay in the arena
+		pmr::nd_array<float> in_arena( arr, &arena );
+		REQUIRE( in_arena.get_allocator( ).resource( ) == &arena );
+		REQUIRE( in_arena( 0, 0 ) == 1.5f );
+	}
+#endif
+}
+
+TEST_CASE( "nd_array - Resize and buffer reuse", "[nd_array][reshape][allocator]" )
+{
+	size_t allocations = 0;
+	size_t live        = 0;
+	using array_type   = nd_array<int, 8, counting_allocator<int>>;
+	counting_allocator<int> alloc( &allocations, &live );
+
+	SECTION( "Copy assignment reuses a large enough buffer" )
+	{
+		array_type target( std::allocator_arg, alloc, 4, 4 );
+		array_type small( std::allocator_arg, alloc, 2, 3 );
+		small( 1, 2 ) = 5;
+		REQUIRE( allocations == 2 );
+
+		const auto* data = target.data( );
+		for( int batch = 0; batch < 3; ++batch )
+		{
+			target = small;
+		}
+		REQUIRE( allocations == 2 );
+		REQUIRE( target.data( ) == data );
+		REQUIRE( target.size( ) == 6 );
+		REQUIRE( target.capacity( ) == 16 );
+		REQUIRE( target( 1, 2 ) == 5 );
+		REQUIRE( target.stride( 0 ) == 3 );
+
+		array_type large( std::allocator_arg, alloc, 5, 5 );
+		target = large;
+		REQUIRE( allocations == 4 );
+		REQUIRE( target.capacity( ) == 25 );
+	}
+
+	SECTION( "Resize keeps leading elements and capacity" )
+	{
+		array_type arr( std::allocator_arg, alloc, 2, 3 );
+		for( size_t i = 0; i < arr.size( ); ++i )
+		{
+			arr.data( )[i] = static_cast<int>( i ) + 1;
+		}
+
+		arr.resize( 2, 2 );
+		REQUIRE( arr.rank( ) == 2 );
+		REQUIRE( arr.extent( 1 ) == 2 );
+		REQUIRE( arr.capacity( ) == 6 );
+		REQUIRE( arr( 1, 1 ) == 4 );
+		REQUIRE( live == 6 );
+
+		arr.resize( { 6 } );
+		REQUIRE( allocations == 1 );
+		REQUIRE( arr( 3 ) == 4 );
+		REQUIRE( arr( 5 ) == 0 );
+
+		arr.resize( 3, 3 );
+		REQUIRE( allocations == 2 );
+		REQUIRE( arr( 1, 2 ) == 0 );
+		REQUIRE( arr( 1, 0 ) == 4 );
+		REQUIRE( live == 9 );
+
+		REQUIRE_THROWS_AS( arr.resize( { 1, 1, 1, 1, 1, 1, 1, 1, 1 } ), std::invalid_argument );
+		REQUIRE( arr.size( ) == 9 );
+	}
+
+	SECTION( "Reserved batches do not allocate" )
+	{
+		array_type batch( alloc );
+		batch.reserve( 64 * 8 );
+		REQUIRE( allocations == 1 );
+		REQUIRE( batch.size( ) == 0 );
+
+		for( size_t rows: { 64, 17, 1, 42 } )
+		{
+			batch.resize( rows, 8 );
+			batch.fill( static_cast<int>( rows ) );
+			REQUIRE( batch.size( ) == rows * 8 );
+		}
+		REQUIRE( allocations == 1 );
+		REQUIRE( batch( 41, 7 ) == 42 );
+	}
+
+	SECTION( "In-place reshape" )
+	{
+		array_type arr( std::allocator_arg, alloc, 2, 6 );
+		arr( 1, 0 ) = 9;
+		const auto* data = arr.data( );
+
+		arr.reshape_inplace( 3, 4 );
+		REQUIRE( arr.extent( 0 ) == 3 );
+		REQUIRE( arr.stride( 0 ) == 4 );
+		REQUIRE( arr( 1, 2 ) == 9 );
+		REQUIRE( arr.data( ) == data );
+
+		arr.reshape_inplace( { 12 } );
+		REQUIRE( arr.rank( ) == 1 );
+		REQUIRE( arr( 6 ) == 9 );
+		REQUIRE_THROWS_AS( arr.reshape_inplace( 5, 5 ), std::invalid_argument );
+		REQUIRE( arr.rank( ) == 1 );
+		REQUIRE( allocations == 1 );
+	}
+
+	SECTION( "Small arrays grow out of the inline buffer" )
+	{
+		small_nd_array<int, 4> arr( 2 );
+		REQUIRE( arr.capacity( ) == 4 );
+		arr( 1 ) = 3;
+		arr.resize( 2, 2 );
+		REQUIRE( arr( 0, 1 ) == 3 );
+
+		arr.resize( 3, 3 );
+		REQUIRE( arr.capacity( ) == 9 );
+		REQUIRE( arr( 0, 1 ) == 3 );
+		REQUIRE( arr( 2, 2 ) == 0 );
+	}
+
+	REQUIRE( live == 0 );
+}
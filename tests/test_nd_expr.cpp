@@ -0,0 +1,262 @@
+#include "nd_array/nd_expr.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+
+
+using namespace cppa;
+
+namespace
+{
+	nd_array<double> iota_array( size_t t_rows, size_t t_cols, double t_start = 0.0 )
+	{
+		nd_array<double> result( t_rows, t_cols );
+		for( size_t i = 0; i < result.size( ); ++i )
+		{
+			result.data( )[i] = t_start + static_cast<double>( i );
+		}
+		return result;
+	}
+} // namespace
+
+TEST_CASE( "nd_expr - Arithmetic", "[nd_expr][operations]" )
+{
+	auto a = iota_array( 3, 4 );
+	auto b = iota_array( 3, 4, 1.0 );
+	auto d = iota_array( 3, 4, 10.0 );
+
+	SECTION( "Fused assignment into an existing array" )
+	{
+		nd_array<double> c( 3, 4 );
+		const double* buffer = c.data( );
+		c                    = a * b + d;
+		REQUIRE( c.data( ) == buffer );
+		for( size_t i = 0; i < 3; ++i )
+		{
+			for( size_t j = 0; j < 4; ++j )
+			{
+				REQUIRE( c( i, j ) == a( i, j ) * b( i, j ) + d( i, j ) );
+			}
+		}
+	}
+
+	SECTION( "Assignment reallocates to the expression extents" )
+	{
+		nd_array<double> c;
+		c = a - b / 2.0;
+		REQUIRE( c.rank( ) == 2 );
+		REQUIRE( c.extent( 0 ) == 3 );
+		REQUIRE( c.extent( 1 ) == 4 );
+		REQUIRE( c( 2, 3 ) == a( 2, 3 ) - b( 2, 3 ) / 2.0 );
+	}
+
+	SECTION( "Scalar operands broadcast on either side" )
+	{
+		nd_array<double> c( 2.0 * a + 1.0 );
+		REQUIRE( c( 1, 1 ) == 2.0 * a( 1, 1 ) + 1.0 );
+
+		c = 10.0 - a / 2.0;
+		REQUIRE( c( 2, 0 ) == 10.0 - a( 2, 0 ) / 2.0 );
+	}
+
+	SECTION( "evaluate deduces the element type" )
+	{
+		nd_array<int> ints( 2, 2 );
+		ints.fill( 3 );
+		auto result = evaluate( ints * 0.5 );
+		static_assert( std::is_same_v<decltype( result ), nd_array<double>>, "int * double yields double" );
+		REQUIRE( result( 1, 1 ) == 1.5 );
+	}
+
+	SECTION( "Compound assignment" )
+	{
+		nd_array<double> c( a );
+		c += b;
+		REQUIRE( c( 1, 2 ) == a( 1, 2 ) + b( 1, 2 ) );
+		c *= 2.0;
+		REQUIRE( c( 1, 2 ) == 2.0 * ( a( 1, 2 ) + b( 1, 2 ) ) );
+		c -= a;
+		c /= 2.0;
+		REQUIRE( c( 0, 3 ) == ( 2.0 * ( a( 0, 3 ) + b( 0, 3 ) ) - a( 0, 3 ) ) / 2.0 );
+	}
+
+	SECTION( "Mismatched extents throw" )
+	{
+		auto other = iota_array( 4, 3 );
+		REQUIRE_THROWS_AS( a + other, std::invalid_argument );
+
+		nd_array<double> c( 2, 2 );
+		auto row = c.subspan( 0, { 0, 1 } );
+		REQUIRE_THROWS_AS( row.assign( a * 2.0 ), std::invalid_argument );
+	}
+}
+
+TEST_CASE( "nd_expr - Comparisons and math functions", "[nd_expr][operations]" )
+{
+	auto a = iota_array( 2, 3, -2.0 );
+
+	SECTION( "Comparisons yield bool elements" )
+	{
+		nd_array<bool> mask( a > 0.0 );
+		REQUIRE_FALSE( mask( 0, 0 ) );
+		REQUIRE_FALSE( mask( 0, 2 ) );
+		REQUIRE( mask( 1, 0 ) );
+
+		nd_array<bool> equal( a == a );
+		REQUIRE( equal( 1, 2 ) );
+		nd_array<bool> lower( a <= -1.0 );
+		REQUIRE( lower( 0, 1 ) );
+		REQUIRE_FALSE( lower( 0, 2 ) );
+	}
+
+	SECTION( "Unary math" )
+	{
+		nd_array<double> c( abs( a ) );
+		REQUIRE( c( 0, 0 ) == 2.0 );
+
+		c = -a;
+		REQUIRE( c( 1, 2 ) == -3.0 );
+
+		c = sqrt( abs( a ) ) + exp( a * 0.0 );
+		REQUIRE( c( 1, 2 ) == std::sqrt( 3.0 ) + 1.0 );
+
+		c = pow( a, 2.0 );
+		REQUIRE( c( 0, 0 ) == 4.0 );
+	}
+
+	SECTION( "Custom functions" )
+	{
+		nd_array<double> relu( map( a, []( double t_value ) { return t_value > 0.0 ? t_value : 0.0; } ) );
+		REQUIRE( relu( 0, 0 ) == 0.0 );
+		REQUIRE( relu( 1, 2 ) == 3.0 );
+	}
+}
+
+TEST_CASE( "nd_expr - Broadcasting", "[nd_expr][stride]" )
+{
+	auto a    = iota_array( 3, 4 );
+	auto bias = nd_array<double>( 4 );
+	for( size_t j = 0; j < 4; ++j )
+	{
+		bias( j ) = 10.0 * static_cast<double>( j );
+	}
+
+	SECTION( "Lower-rank operands are stretched across leading dimensions" )
+	{
+		nd_array<double> c( a + bias );
+		REQUIRE( c.rank( ) == 2 );
+		REQUIRE( c.extent( 0 ) == 3 );
+		for( size_t i = 0; i < 3; ++i )
+		{
+			for( size_t j = 0; j < 4; ++j )
+			{
+				REQUIRE( c( i, j ) == a( i, j ) + bias( j ) );
+			}
+		}
+	}
+
+	SECTION( "Singleton dimensions broadcast on both sides" )
+	{
+		auto column = a.subspan( 1, { 0, 1 } );
+		auto outer  = evaluate( column * bias.expand_dims( 0 ) );
+		REQUIRE( outer.extent( 0 ) == 3 );
+		REQUIRE( outer.extent( 1 ) == 4 );
+		REQUIRE( outer( 2, 3 ) == a( 2, 0 ) * bias( 3 ) );
+	}
+
+	SECTION( "Assignment broadcasts to the destination" )
+	{
+		a += bias;
+		REQUIRE( a( 2, 1 ) == 9.0 + 10.0 );
+
+		nd_array<double> out( 3, 4 );
+		out.as_span( ).assign( bias * 2.0 );
+		REQUIRE( out( 1, 3 ) == 60.0 );
+	}
+
+	SECTION( "Incompatible shapes throw" )
+	{
+		auto other = iota_array( 3, 3 );
+		REQUIRE_THROWS_AS( a + other, std::invalid_argument );
+
+		auto wide = iota_array( 2, 4 );
+		REQUIRE_THROWS_AS( bias += wide, std::invalid_argument );
+	}
+}
+
+TEST_CASE( "nd_expr - Strided operands and aliasing", "[nd_expr][stride]" )
+{
+	SECTION( "Transposed and sliced operands" )
+	{
+		auto a = iota_array( 3, 4 );
+		auto b = iota_array( 4, 3 );
+
+		nd_array<double> c( a.T( ) + b );
+		REQUIRE( c.extent( 0 ) == 4 );
+		for( size_t i = 0; i < 4; ++i )
+		{
+			for( size_t j = 0; j < 3; ++j )
+			{
+				REQUIRE( c( i, j ) == a( j, i ) + b( i, j ) );
+			}
+		}
+
+		c = a.subspan( { { 0, 3 }, { 1, 4 } } ) * 2.0;
+		REQUIRE( c.extent( 1 ) == 3 );
+		REQUIRE( c( 2, 0 ) == 2.0 * a( 2, 1 ) );
+	}
+
+	SECTION( "Assigning into a strided destination view" )
+	{
+		auto a = iota_array( 4, 4 );
+		nd_array<double> out( 4, 4 );
+		out.fill( -1.0 );
+
+		auto column = out.subspan( 1, { 1, 2 } );
+		column.assign( a.subspan( 1, { 0, 1 } ) + 100.0 );
+		for( size_t i = 0; i < 4; ++i )
+		{
+			REQUIRE( out( i, 1 ) == a( i, 0 ) + 100.0 );
+			REQUIRE( out( i, 0 ) == -1.0 );
+		}
+	}
+
+	SECTION( "Element-wise self assignment stays in place" )
+	{
+		auto a               = iota_array( 3, 3 );
+		const double* buffer = a.data( );
+		a                    = a * a;
+		REQUIRE( a.data( ) == buffer );
+		REQUIRE( a( 2, 2 ) == 64.0 );
+	}
+
+	SECTION( "Overlapping operands with a different layout are evaluated through a temporary" )
+	{
+		auto a        = iota_array( 3, 3 );
+		const auto at = iota_array( 3, 3 );
+		a             = a.T( ) + 0.0;
+		for( size_t i = 0; i < 3; ++i )
+		{
+			for( size_t j = 0; j < 3; ++j )
+			{
+				REQUIRE( a( i, j ) == at( j, i ) );
+			}
+		}
+	}
+
+	SECTION( "Reversed operands alias the same memory" )
+	{
+		auto a        = iota_array( 2, 4 );
+		const auto ar = iota_array( 2, 4 );
+		a             = a.flip( 1 ) + 0.0;
+		for( size_t i = 0; i < 2; ++i )
+		{
+			for( size_t j = 0; j < 4; ++j )
+			{
+				REQUIRE( a( i, j ) == ar( i, 3 - j ) );
+			}
+		}
+	}
+}
@@ -0,0 +1,256 @@
+#include "nd_array/nd_io.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+using namespace cppa;
+
+namespace
+{
+	std::string temp_path( const std::string& t_name ) { return ( std::filesystem::temp_directory_path( ) / ( "nd_io_" + t_name ) ).string( ); }
+
+	nd_array<float> iota_array( size_t t_rows, size_t t_cols )
+	{
+		nd_array<float> result( t_rows, t_cols );
+		for( size_t i = 0; i < result.size( ); ++i )
+		{
+			result.data( )[i] = static_cast<float>( i );
+		}
+		return result;
+	}
+
+	std::string read_file( const std::string& t_path )
+	{
+		std::ifstream in( t_path, std::ios::binary );
+		return std::string( std::istreambuf_iterator<char>( in ), std::istreambuf_iterator<char>( ) );
+	}
+
+	void write_file( const std::string& t_path, const std::string& t_bytes )
+	{
+		std::ofstream out( t_path, std::ios::binary | std::ios::trunc );
+		out.write( t_bytes.data( ), static_cast<std::streamsize>( t_bytes.size( ) ) );
+	}
+
+	// Builds a version 1.0 .npy file the way numpy.save lays it out
+	std::string npy_bytes( const std::string& t_dict, const std::string& t_payload )
+	{
+		std::string header = t_dict;
+		header.append( 64 - ( 10 + header.size( ) + 1 ) % 64, ' ' );
+		header += '\n';
+		std::string bytes = "\x93NUMPY";
+		bytes += '\x01';
+		bytes += '\x00';
+		bytes += static_cast<char>( header.size( ) & 0xFF );
+		bytes += static_cast<char>( header.size( ) >> 8 );
+		return bytes + header + t_payload;
+	}
+} // namespace
+
+TEST_CASE( "nd_io - npy round trip", "[nd_io][copy]" )
+{
+	const auto path = temp_path( "round_trip.npy" );
+	auto source     = iota_array( 3, 4 );
+
+	SECTION( "Contiguous arrays" )
+	{
+		save_npy( path, source );
+		const auto contents = read_file( path );
+		REQUIRE( contents.size( ) == 128 + 12 * sizeof( float ) );
+		REQUIRE( contents.find( "{'descr': '<f4', 'fortran_order': False, 'shape': (3, 4), }" ) == 10 );
+		REQUIRE( contents[127] == '\n' );
+
+		auto mapped = map_npy<const float>( path );
+		auto span   = mapped.as_span( );
+		REQUIRE( span.rank( ) == 2 );
+		REQUIRE( span.extent( 0 ) == 3 );
+		REQUIRE( span.extent( 1 ) == 4 );
+		REQUIRE( span.is_contiguous( ) );
+		REQUIRE( reinterpret_cast<const std::byte*>( span.data( ) ) == mapped.file( ).data( ) + 128 );
+		for( size_t i = 0; i < 3; ++i )
+		{
+			for( size_t j = 0; j < 4; ++j )
+			{
+				REQUIRE( span( i, j ) == source( i, j ) );
+			}
+		}
+	}
+
+	SECTION( "Transposed views are stored in Fortran order" )
+	{
+		save_npy( path, source.T( ) );
+		REQUIRE( read_file( path ).find( "'fortran_order': True, 'shape': (4, 3)" ) != std::string::npos );
+
+		auto mapped = map_npy<const float>( path );
+		auto span   = mapped.as_span( );
+		REQUIRE( span.extent( 0 ) == 4 );
+		REQUIRE( span.stride( 0 ) == 1 );
+		REQUIRE( span.stride( 1 ) == 4 );
+		REQUIRE( span( 3, 1 ) == source( 1, 3 ) );
+	}
+
+	SECTION( "Strided views are gathered in row-major order" )
+	{
+		auto sub = source.subspan( 1, { 1, 3 } );
+		save_npy( path, sub );
+
+		auto mapped = map_npy<const float>( path );
+		auto span   = mapped.as_span( );
+		REQUIRE( span.extent( 1 ) == 2 );
+		REQUIRE( span.is_contiguous( ) );
+		for( size_t i = 0; i < 3; ++i )
+		{
+			REQUIRE( span( i, 0 ) == source( i, 1 ) );
+			REQUIRE( span( i, 1 ) == source( i, 2 ) );
+		}
+	}
+
+	SECTION( "Reversed views are gathered in logical order" )
+	{
+		save_npy( path, source.flip( 1 ) );
+
+		auto mapped = map_npy<const float>( path );
+		auto span   = mapped.as_span( );
+		REQUIRE( span.is_contiguous( ) );
+		REQUIRE( span( 0, 0 ) == source( 0, 3 ) );
+		REQUIRE( span( 2, 3 ) == source( 2, 0 ) );
+	}
+
+	SECTION( "One-dimensional shapes use the tuple form" )
+	{
+		nd_array<std::int16_t> values( 5 );
+		values.fill( 7 );
+		save_npy( path, values );
+		REQUIRE( read_file( path ).find( "'descr': '<i2', 'fortran_order': False, 'shape': (5,), }" ) != std::string::npos );
+		auto mapped = map_npy<const std::int16_t>( path );
+		REQUIRE( mapped.as_span( )( 4 ) == 7 );
+	}
+
+	std::filesystem::remove( path );
+}
+
+TEST_CASE( "nd_io - Mapping modes", "[nd_io][operations]" )
+{
+	const auto path = temp_path( "modes.npy" );
+	save_npy( path, iota_array( 2, 3 ) );
+
+	SECTION( "Copy-on-write changes stay private" )
+	{
+		{
+			auto mapped = map_npy<float>( path );
+			REQUIRE( mapped.file( ).mode( ) == map_mode::copy_on_write );
+			mapped.as_span( ).fill( -1.0f );
+			REQUIRE( mapped.as_span( )( 1, 2 ) == -1.0f );
+		}
+		auto reread = map_npy<const float>( path );
+		REQUIRE( reread.as_span( )( 1, 2 ) == 5.0f );
+	}
+
+	SECTION( "Read-write changes reach the file" )
+	{
+		{
+			auto mapped = map_npy<float>( path, map_mode::read_write );
+			mapped.as_span( )( 1, 2 ) = 42.0f;
+			mapped.flush( );
+		}
+		auto reread = map_npy<const float>( path );
+		REQUIRE( reread.as_span( )( 1, 2 ) == 42.0f );
+	}
+
+	SECTION( "Read-only mappings require a const element type" )
+	{
+		REQUIRE_THROWS_AS( map_npy<float>( path, map_mode::read_only ), std::invalid_argument );
+	}
+
+	SECTION( "Mappings are movable" )
+	{
+		auto mapped      = map_npy<const float>( path );
+		const auto* data = mapped.as_span( ).data( );
+		auto moved       = std::move( mapped );
+		REQUIRE( moved.as_span( ).data( ) == data );
+		REQUIRE( moved.file( ).is_open( ) );
+	}
+
+	std::filesystem::remove( path );
+}
+
+TEST_CASE( "nd_io - npy header validation", "[nd_io][construction]" )
+{
+	const auto path = temp_path( "header.npy" );
+
+	SECTION( "Files written by numpy map directly" )
+	{
+		const double payload[] = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+		write_file( path, npy_bytes( "{'descr': '<f8', 'fortran_order': True, 'shape': (2, 3), }",
+		                             std::string( reinterpret_cast<const char*>( payload ), sizeof( payload ) ) ) );
+		auto mapped = map_npy<const double>( path );
+		auto span   = mapped.as_span( );
+		REQUIRE( span.extent( 0 ) == 2 );
+		REQUIRE( span.extent( 1 ) == 3 );
+		REQUIRE( span( 0, 1 ) == 3.0 );
+		REQUIRE( span( 1, 0 ) == 2.0 );
+	}
+
+	SECTION( "Element type mismatch" )
+	{
+		save_npy( path, iota_array( 2, 2 ) );
+		REQUIRE_THROWS_AS( map_npy<const double>( path ), std::invalid_argument );
+		REQUIRE_THROWS_AS( map_npy<const int>( path ), std::invalid_argument );
+	}
+
+	SECTION( "Malformed and truncated files" )
+	{
+		write_file( path, "not a numpy file" );
+		REQUIRE_THROWS_AS( map_npy<const float>( path ), std::runtime_error );
+
+		write_file( path, npy_bytes( "{'descr': '<f4', 'fortran_order': False, 'shape': (100, 100), }", "1234" ) );
+		REQUIRE_THROWS_AS( map_npy<const float>( path ), std::runtime_error );
+
+		write_file( path, npy_bytes( "{'descr': '>f4', 'fortran_order': False, 'shape': (1,), }", "1234" ) );
+		REQUIRE_THROWS_AS( map_npy<const float>( path ), std::invalid_argument );
+	}
+
+	SECTION( "Rank exceeds MaxRank" )
+	{
+		write_file( path, npy_bytes( "{'descr': '<f4', 'fortran_order': False, 'shape': (1, 1, 1), }", "1234" ) );
+		REQUIRE_THROWS_AS( ( map_npy<const float, 2>( path ) ), std::invalid_argument );
+	}
+
+	SECTION( "Missing files" )
+	{
+		REQUIRE_THROWS_AS( map_npy<const float>( temp_path( "does_not_exist.npy" ) ), std::system_error );
+	}
+
+	std::filesystem::remove( path );
+}
+
+TEST_CASE( "nd_io - Raw files", "[nd_io][stride]" )
+{
+	const auto path = temp_path( "raw.bin" );
+	auto source     = iota_array( 4, 4 );
+
+	SECTION( "Round trip with explicit extents" )
+	{
+		save_raw( path, source.T( ) );
+		REQUIRE( read_file( path ).size( ) == 16 * sizeof( float ) );
+
+		auto mapped = map_raw<const float>( path, { 4, 4 } );
+		REQUIRE( mapped.as_span( )( 1, 2 ) == source( 2, 1 ) );
+	}
+
+	SECTION( "Offsets skip a custom header" )
+	{
+		save_raw( path, source );
+		auto mapped = map_raw<const float>( path, { 2, 4 }, 8 * sizeof( float ) );
+		REQUIRE( mapped.as_span( )( 0, 0 ) == source( 2, 0 ) );
+
+		REQUIRE_THROWS_AS( map_raw<const float>( path, { 5, 4 } ), std::runtime_error );
+		REQUIRE_THROWS_AS( map_raw<const float>( path, { 1 }, 2 ), std::invalid_argument );
+	}
+
+	std::filesystem::remove( path );
+}
@@ -0,0 +1,264 @@
+#include "nd_array/nd_linalg.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <stdexcept>
+
+using namespace cppa;
+
+namespace
+{
+	template<typename Ty>
+	nd_array<Ty> pattern_array( size_t t_rows, size_t t_cols, int t_seed )
+	{
+		nd_array<Ty> result( t_rows, t_cols );
+		for( size_t i = 0; i < t_rows; ++i )
+		{
+			for( size_t j = 0; j < t_cols; ++j )
+			{
+				result( i, j ) = static_cast<Ty>( static_cast<int>( ( i * 7 + j * 3 + static_cast<size_t>( t_seed ) ) % 11 ) - 5 );
+			}
+		}
+		return result;
+	}
+
+	// Reference triple loop through the checked accessors
+	template<typename A, typename B, typename C>
+	void naive_matmul( const A& t_a, const B& t_b, C& t_c )
+	{
+		for( size_t i = 0; i < t_a.extent( 0 ); ++i )
+		{
+			for( size_t j = 0; j < t_b.extent( 1 ); ++j )
+			{
+				std::int64_t sum = 0;
+				for( size_t k = 0; k < t_a.extent( 1 ); ++k )
+				{
+					sum += static_cast<std::int64_t>( t_a( i, k ) ) * static_cast<std::int64_t>( t_b( k, j ) );
+				}
+				t_c( i, j ) = static_cast<typename C::value_type>( sum );
+			}
+		}
+	}
+
+	template<typename A, typename B>
+	bool equal_matrices( const A& t_a, const B& t_b )
+	{
+		if( t_a.extent( 0 ) != t_b.extent( 0 ) || t_a.extent( 1 ) != t_b.extent( 1 ) )
+		{
+			return false;
+		}
+		for( size_t i = 0; i < t_a.extent( 0 ); ++i )
+		{
+			for( size_t j = 0; j < t_a.extent( 1 ); ++j )
+			{
+				if( t_a( i, j ) != t_b( i, j ) )
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+} // namespace
+
+TEST_CASE( "nd_linalg - Matrix products", "[nd_linalg][operations]" )
+{
+	SECTION( "Shapes crossing every block boundary" )
+	{
+		// 67 rows (mc = 64), depth 261 (kc = 256), 1030 columns (nc = 1024); integers keep the comparison exact
+		auto a = pattern_array<std::int32_t>( 67, 261, 1 );
+		auto b = pattern_array<std::int32_t>( 261, 1030, 2 );
+		nd_array<std::int32_t> c( 67, 1030 );
+		nd_array<std::int32_t> expected( 67, 1030 );
+		matmul( a, b, c );
+		naive_matmul( a, b, expected );
+		REQUIRE( equal_matrices( c, expected ) );
+	}
+
+	SECTION( "Small and degenerate shapes" )
+	{
+		auto a = pattern_array<double>( 3, 5, 3 );
+		auto b = pattern_array<double>( 5, 2, 4 );
+		auto c = matmul( a, b );
+		nd_array<double> expected( 3, 2 );
+		naive_matmul( a, b, expected );
+		REQUIRE( c.rank( ) == 2 );
+		REQUIRE( equal_matrices( c, expected ) );
+
+		nd_array<double> row( 1, 5 );
+		row.fill( 1.0 );
+		double column_sum = 0.0;
+		for( size_t k = 0; k < 5; ++k )
+		{
+			column_sum += b( k, 1 );
+		}
+		REQUIRE( matmul( row, b )( 0, 1 ) == column_sum );
+
+		nd_array<double> no_depth_a( 2, 0 );
+		nd_array<double> no_depth_b( 0, 3 );
+		nd_array<double> zeros( 2, 3 );
+		zeros.fill( 7.0 );
+		matmul( no_depth_a, no_depth_b, zeros );
+		REQUIRE( zeros( 1, 2 ) == 0.0 );
+	}
+
+	SECTION( "Transposed and strided operands are used in place" )
+	{
+		auto a_t = pattern_array<float>( 40, 30, 5 ); // a = a_t^T is 30 x 40
+		auto b   = pattern_array<float>( 40, 50, 6 );
+		auto b_t = pattern_array<float>( 50, 40, 6 );
+		nd_array<float> expected( 30, 50 );
+		naive_matmul( a_t.T( ), b, expected );
+
+		nd_array<float> c( 30, 50 );
+		matmul( a_t.T( ), b, c );
+		REQUIRE( equal_matrices( c, expected ) );
+
+		// Result stored column-major through a transposed view
+		nd_array<float> c_t( 50, 30 );
+		matmul( a_t.T( ), b, c_t.T( ) );
+		REQUIRE( equal_matrices( c_t.T( ), expected ) );
+
+		// Every other column of a wider array
+		nd_array<float> wide( 30, 100 );
+		matmul( a_t.T( ), b, wide.subspan( 1, { 0, 100 }, 2 ) );
+		REQUIRE( equal_matrices( wide.subspan( 1, { 0, 100 }, 2 ), expected ) );
+
+		nd_array<float> from_t( 30, 50 );
+		nd_array<float> expected_t( 30, 50 );
+		matmul( a_t.T( ), b_t.T( ), from_t );
+		naive_matmul( a_t.T( ), b_t.T( ), expected_t );
+		REQUIRE( equal_matrices( from_t, expected_t ) );
+	}
+
+	SECTION( "Mismatched extents" )
+	{
+		nd_array<float> a( 3, 4 );
+		nd_array<float> b( 5, 2 );
+		nd_array<float> c( 3, 2 );
+		nd_array<float> v( 4 );
+		REQUIRE_THROWS_AS( matmul( a, b, c ), std::invalid_argument );
+		REQUIRE_THROWS_AS( matmul( a, a.T( ), c ), std::invalid_argument );
+		REQUIRE_THROWS_AS( matmul( v, a ), std::invalid_argument );
+		REQUIRE_THROWS_AS( matvec( a, b.slice( 1, 0 ) ), std::invalid_argument );
+	}
+}
+
+TEST_CASE( "nd_linalg - Batched products", "[nd_linalg][parallel]" )
+{
+	nd_array<std::int64_t> q( 3, 2, 9, 6 );
+	nd_array<std::int64_t> k( 3, 2, 11, 6 );
+	for( size_t i = 0; i < q.size( ); ++i )
+	{
+		q.data( )[i] = static_cast<std::int64_t>( i % 13 ) - 6;
+	}
+	for( size_t i = 0; i < k.size( ); ++i )
+	{
+		k.data( )[i] = static_cast<std::int64_t>( i % 7 ) - 3;
+	}
+
+	SECTION( "Leading axes form the batch" )
+	{
+		auto scores = matmul( q, k.transpose( { 0, 1, 3, 2 } ) );
+		REQUIRE( scores.rank( ) == 4 );
+		REQUIRE( scores.extent( 2 ) == 9 );
+		REQUIRE( scores.extent( 3 ) == 11 );
+		for( size_t b0 = 0; b0 < 3; ++b0 )
+		{
+			for( size_t b1 = 0; b1 < 2; ++b1 )
+			{
+				nd_array<std::int64_t> expected( 9, 11 );
+				naive_matmul( q.slice( 0, b0 ).slice( 0, b1 ), k.slice( 0, b0 ).slice( 0, b1 ).T( ), expected );
+				REQUIRE( equal_matrices( scores.slice( 0, b0 ).slice( 0, b1 ), expected ) );
+			}
+		}
+
+		auto parallel = matmul( parallel_policy { 4 }, q, k.transpose( { 0, 1, 3, 2 } ) );
+		REQUIRE( std::equal( parallel.begin( ), parallel.end( ), scores.begin( ) ) );
+	}
+
+	SECTION( "Operands broadcast over missing batch axes" )
+	{
+		auto weights = pattern_array<std::int64_t>( 6, 4, 7 );
+		auto out     = matmul( q, weights );
+		REQUIRE( out.extent( 0 ) == 3 );
+		REQUIRE( out.extent( 3 ) == 4 );
+		nd_array<std::int64_t> expected( 9, 4 );
+		naive_matmul( q.slice( 0, 2 ).slice( 0, 1 ), weights, expected );
+		REQUIRE( equal_matrices( out.slice( 0, 2 ).slice( 0, 1 ), expected ) );
+
+		nd_array<std::int64_t> shared_rows( 1, 2, 9, 6 );
+		shared_rows.fill( 1 );
+		nd_array<std::int64_t> into( 3, 2, 9, 11 );
+		matmul( shared_rows, k.transpose( { 0, 1, 3, 2 } ), into );
+		REQUIRE( into( 2, 1, 4, 3 ) == into( 2, 1, 0, 3 ) );
+
+		nd_array<std::int64_t> wrong( 2, 2, 9, 11 );
+		REQUIRE_THROWS_AS( matmul( q, k.transpose( { 0, 1, 3, 2 } ), wrong ), std::invalid_argument );
+	}
+
+	SECTION( "Single matrices split rows across threads" )
+	{
+		auto a = pattern_array<std::int32_t>( 130, 40, 8 );
+		auto b = pattern_array<std::int32_t>( 40, 33, 9 );
+		nd_array<std::int32_t> c( 130, 33 );
+		nd_array<std::int32_t> expected( 130, 33 );
+		matmul( par, a, b, c );
+		naive_matmul( a, b, expected );
+		REQUIRE( equal_matrices( c, expected ) );
+	}
+}
+
+TEST_CASE( "nd_linalg - Matrix-vector products", "[nd_linalg][stride]" )
+{
+	auto a = pattern_array<double>( 37, 21, 10 );
+	nd_array<double> x( 21 );
+	for( size_t i = 0; i < x.size( ); ++i )
+	{
+		x( i ) = static_cast<double>( i ) * 0.5 - 3.0;
+	}
+
+	const auto reference = [&]( const auto& t_matrix, size_t t_row )
+	{
+		double sum = 0.0;
+		for( size_t k = 0; k < t_matrix.extent( 1 ); ++k )
+		{
+			sum += t_matrix( t_row, k ) * x( k );
+		}
+		return sum;
+	};
+
+	SECTION( "Row-major matrices" )
+	{
+		auto y = matvec( a, x );
+		REQUIRE( y.rank( ) == 1 );
+		REQUIRE( y.extent( 0 ) == 37 );
+		for( size_t i = 0; i < 37; ++i )
+		{
+			REQUIRE( y( i ) == reference( a, i ) );
+		}
+	}
+
+	SECTION( "Column-major matrices and strided vectors" )
+	{
+		auto storage = pattern_array<double>( 21, 37, 10 );
+		auto a_t     = storage.T( );
+		nd_array<double> y( 74 );
+		auto y_view = y.subspan( 0, { 0, 74 }, 2 );
+		matvec( parallel_policy { 3 }, a_t, x, y_view );
+		for( size_t i = 0; i < 37; ++i )
+		{
+			REQUIRE( y_view( i ) == reference( a_t, i ) );
+			REQUIRE( y( 2 * i + 1 ) == 0.0 );
+		}
+
+		auto reversed = matvec( a, x.flip( 0 ) );
+		double sum    = 0.0;
+		for( size_t k = 0; k < 21; ++k )
+		{
+			sum += a( 5, k ) * x( 20 - k );
+		}
+		REQUIRE( reversed( 5 ) == sum );
+	}
+}
@@ -0,0 +1,204 @@
+#include "nd_array/nd_reduce.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+
+using namespace cppa;
+
+namespace
+{
+	nd_array<int> iota_array( size_t t_rows, size_t t_cols )
+	{
+		nd_array<int> result( t_rows, t_cols );
+		for( size_t i = 0; i < result.size( ); ++i )
+		{
+			result.data( )[i] = static_cast<int>( i );
+		}
+		return result;
+	}
+} // namespace
+
+TEST_CASE( "nd_reduce - Sums along axes", "[nd_reduce][operations]" )
+{
+	const auto a = iota_array( 3, 4 );
+
+	SECTION( "Single axes of a matrix" )
+	{
+		const auto columns = cppa::sum( a, { 0 } );
+		REQUIRE( columns.rank( ) == 1 );
+		REQUIRE( columns.extent( 0 ) == 4 );
+		REQUIRE( columns( 1 ) == 1 + 5 + 9 );
+
+		const auto rows = cppa::sum( a, { 1 } );
+		REQUIRE( rows.extent( 0 ) == 3 );
+		REQUIRE( rows( 2 ) == 8 + 9 + 10 + 11 );
+
+		const auto total = cppa::sum( a, { 0, 1 } );
+		REQUIRE( total.rank( ) == 1 );
+		REQUIRE( total.extent( 0 ) == 1 );
+		REQUIRE( total( 0 ) == 66 );
+	}
+
+	SECTION( "Strided, transposed and broadcast operands" )
+	{
+		const auto rows_of_t = cppa::sum( a.T( ), { 1 } );
+		REQUIRE( rows_of_t.extent( 0 ) == 4 );
+		REQUIRE( rows_of_t( 3 ) == 3 + 7 + 11 );
+
+		const auto band = cppa::sum( a.subspan( 1, { 1, 3 } ), { 1 } );
+		REQUIRE( band( 0 ) == 1 + 2 );
+		REQUIRE( band( 2 ) == 9 + 10 );
+
+		const auto reversed = cppa::sum( a.flip( 1 ).subspan( 1, { 0, 4 }, 2 ), { 1 } );
+		REQUIRE( reversed( 1 ) == 7 + 5 );
+
+		const auto repeated = cppa::sum( a.slice( 0, 1 ).broadcast_to( 5, 4 ), { 0 } );
+		REQUIRE( repeated( 2 ) == 5 * 6 );
+	}
+
+	SECTION( "Several axes of a higher-rank array" )
+	{
+		nd_array<int> cube( 2, 3, 4 );
+		for( size_t i = 0; i < cube.size( ); ++i )
+		{
+			cube.data( )[i] = static_cast<int>( i );
+		}
+
+		const auto middle = cppa::sum( cube, { 0, 2 } );
+		REQUIRE( middle.rank( ) == 1 );
+		REQUIRE( middle.extent( 0 ) == 3 );
+		for( size_t j = 0; j < 3; ++j )
+		{
+			int expected = 0;
+			for( size_t i = 0; i < 2; ++i )
+			{
+				for( size_t k = 0; k < 4; ++k )
+				{
+					expected += cube( i, j, k );
+				}
+			}
+			REQUIRE( middle( j ) == expected );
+		}
+
+		const auto plane = cppa::sum( cube.transpose( { 2, 0, 1 } ), { 1 } );
+		REQUIRE( plane.extent( 0 ) == 4 );
+		REQUIRE( plane.extent( 1 ) == 3 );
+		REQUIRE( plane( 3, 2 ) == cube( 0, 2, 3 ) + cube( 1, 2, 3 ) );
+	}
+
+	SECTION( "Invalid axes" )
+	{
+		REQUIRE_THROWS_AS( cppa::sum( a, { 2 } ), std::out_of_range );
+		REQUIRE_THROWS_AS( cppa::sum( a, { 1, 1 } ), std::invalid_argument );
+	}
+}
+
+TEST_CASE( "nd_reduce - Built-in operations", "[nd_reduce][operations]" )
+{
+	auto a = iota_array( 3, 4 );
+	a( 1, 2 ) = -7;
+	a( 2, 0 ) = 50;
+
+	SECTION( "prod, min and max" )
+	{
+		nd_array<std::int64_t> small( 2, 3 );
+		small.fill( 2 );
+		REQUIRE( cppa::prod( small, { 1 } )( 0 ) == 8 );
+		REQUIRE( cppa::min( a, { 1 } )( 1 ) == -7 );
+		REQUIRE( cppa::max( a, { 0 } )( 0 ) == 50 );
+		REQUIRE( cppa::max( a, { 0, 1 } )( 0 ) == 50 );
+	}
+
+	SECTION( "mean averages integers in double" )
+	{
+		const auto means = cppa::mean( iota_array( 3, 4 ), { 0 } );
+		static_assert( std::is_same_v<decltype( means )::value_type, double> );
+		REQUIRE( means( 1 ) == 5.0 );
+
+		nd_array<float> values( 2, 2 );
+		values.fill( 1.5f );
+		static_assert( std::is_same_v<decltype( cppa::mean( values, { 1 } ) )::value_type, float> );
+		REQUIRE( cppa::mean( values, { 1 } )( 1 ) == 1.5f );
+	}
+
+	SECTION( "argmax and argmin return the first extreme" )
+	{
+		const auto along_rows = cppa::argmax( a, 1 );
+		REQUIRE( along_rows.extent( 0 ) == 3 );
+		REQUIRE( along_rows( 0 ) == 3 );
+		REQUIRE( along_rows( 2 ) == 0 );
+		REQUIRE( cppa::argmin( a, 1 )( 1 ) == 2 );
+
+		const auto along_columns = cppa::argmax( a, 0 );
+		REQUIRE( along_columns.extent( 0 ) == 4 );
+		REQUIRE( along_columns( 0 ) == 2 );
+		REQUIRE( along_columns( 2 ) == 2 );
+		REQUIRE( cppa::argmin( a, 0 )( 2 ) == 1 );
+
+		nd_array<int> ties( 4 );
+		ties.fill( 3 );
+		REQUIRE( cppa::argmax( ties, 0 )( 0 ) == 0 );
+
+		REQUIRE_THROWS_AS( cppa::argmax( a, 2 ), std::out_of_range );
+		nd_array<int> empty( 2, 0 );
+		REQUIRE_THROWS_AS( cppa::argmax( empty, 1 ), std::invalid_argument );
+	}
+
+	SECTION( "Custom operations with an initial value" )
+	{
+		const auto bits = cppa::reduce( a, { 1 }, std::int64_t { 0 }, []( std::int64_t t_lhs, std::int64_t t_rhs ) { return t_lhs | t_rhs; } );
+		static_assert( std::is_same_v<decltype( bits )::value_type, std::int64_t> );
+		REQUIRE( bits.extent( 0 ) == 3 );
+		REQUIRE( bits( 0 ) == ( 0 | 1 | 2 | 3 ) );
+		REQUIRE( bits( 2 ) == ( 50 | 9 | 10 | 11 ) );
+
+		nd_array<int> empty( 3, 0 );
+		const auto sums = cppa::reduce( empty, { 1 }, 10, std::plus<>( ) );
+		REQUIRE( sums.extent( 0 ) == 3 );
+		REQUIRE( sums( 2 ) == 10 );
+	}
+}
+
+TEST_CASE( "nd_reduce - Accuracy and parallel execution", "[nd_reduce][parallel]" )
+{
+	SECTION( "Float sums along rows are pairwise" )
+	{
+		nd_array<float> values( 2, 1 << 20 );
+		values.fill( 0.1f );
+		const auto sums = cppa::sum( values, { 1 } );
+		REQUIRE( std::abs( sums( 0 ) - 104857.6f ) < 0.1f );
+	}
+
+	SECTION( "Float sums across rows are compensated" )
+	{
+		nd_array<float> values( 1 << 20, 2 );
+		values.fill( 0.1f );
+		const auto sums = cppa::sum( values, { 0 } );
+		REQUIRE( std::abs( sums( 1 ) - 104857.6f ) < 0.1f );
+	}
+
+	SECTION( "Parallel results match sequential ones" )
+	{
+		nd_array<int> cube( 7, 33, 5 );
+		for( size_t i = 0; i < cube.size( ); ++i )
+		{
+			cube.data( )[i] = static_cast<int>( i % 97 );
+		}
+		for( const auto& axes: { std::initializer_list<size_t> { 0 }, std::initializer_list<size_t> { 1 }, std::initializer_list<size_t> { 2 } } )
+		{
+			const auto expected = cppa::sum( cube, axes );
+			const auto actual   = cppa::sum( parallel_policy { 4 }, cube, axes );
+			REQUIRE( std::equal( expected.begin( ), expected.end( ), actual.begin( ), actual.end( ) ) );
+		}
+
+		const auto transposed = cube.transpose( { 2, 1, 0 } );
+		const auto expected   = cppa::argmax( transposed, 1 );
+		const auto actual     = cppa::argmax( parallel_policy { 3 }, transposed, 1 );
+		REQUIRE( std::equal( expected.begin( ), expected.end( ), actual.begin( ), actual.end( ) ) );
+		REQUIRE( cppa::max( par, cube, { 0, 1, 2 } )( 0 ) == 96 );
+	}
+}
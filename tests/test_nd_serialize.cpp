@@ -0,0 +1,311 @@
+#include "nd_array/nd_serialize.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace cppa;
+
+namespace
+{
+	nd_array<float> iota_array( size_t t_rows, size_t t_cols )
+	{
+		nd_array<float> result( t_rows, t_cols );
+		for( size_t i = 0; i < result.size( ); ++i )
+		{
+			result.data( )[i] = static_cast<float>( i );
+		}
+		return result;
+	}
+
+	// Copies the stream contents into a heap buffer, which is aligned for every arithmetic type
+	std::vector<std::byte> to_buffer( const std::ostringstream& t_stream )
+	{
+		const std::string bytes = t_stream.str( );
+		std::vector<std::byte> buffer( bytes.size( ) );
+		std::memcpy( buffer.data( ), bytes.data( ), bytes.size( ) );
+		return buffer;
+	}
+
+	template<typename Ty, typename... Args>
+	std::vector<std::byte> serialized( const nd_span<Ty>& t_span, const Args&... t_args )
+	{
+		std::ostringstream out;
+		serialize( out, t_span, t_args... );
+		return to_buffer( out );
+	}
+
+	// Run-length encoding of bytes as (count, value) pairs; shrinks zeros, grows noise
+	struct rle_codec
+	{
+		static constexpr std::uint8_t id = 200;
+
+		size_t bound( size_t t_size ) const { return 2 * t_size; }
+
+		size_t compress( const std::byte* t_src, size_t t_size, std::byte* t_dst, size_t t_capacity ) const
+		{
+			size_t out = 0;
+			for( size_t i = 0; i < t_size; )
+			{
+				size_t run = 1;
+				while( i + run < t_size && run < 255 && t_src[i + run] == t_src[i] )
+				{
+					++run;
+				}
+				if( out + 2 > t_capacity )
+				{
+					return 0;
+				}
+				t_dst[out++] = static_cast<std::byte>( run );
+				t_dst[out++] = t_src[i];
+				i += run;
+			}
+			return out;
+		}
+
+		void decompress( const std::byte* t_src, size_t t_size, std::byte* t_dst, size_t t_raw_size ) const
+		{
+			size_t out = 0;
+			for( size_t i = 0; i + 1 < t_size; i += 2 )
+			{
+				const auto run = static_cast<size_t>( t_src[i] );
+				if( out + run > t_raw_size )
+				{
+					throw std::runtime_error( "Corrupt RLE block" );
+				}
+				std::memset( t_dst + out, static_cast<int>( t_src[i + 1] ), run );
+				out += run;
+			}
+			if( out != t_raw_size )
+			{
+				throw std::runtime_error( "Corrupt RLE block" );
+			}
+		}
+	};
+
+	struct other_codec : rle_codec
+	{
+		static constexpr std::uint8_t id = 201;
+	};
+
+	template<typename Codec>
+	void require_codec_round_trip( const Codec& t_codec )
+	{
+		auto source = iota_array( 64, 48 );
+		for( size_t i = 0; i < source.size( ); i += 3 )
+		{
+			source.data( )[i] = 0.0f;
+		}
+		for( const auto& view: { source.as_span( ), source.T( ), source.subspan( 1, { 5, 40 }, 3 ) } )
+		{
+			const auto buffer = serialized( view, t_codec, 1000 );
+			const auto copy   = deserialize<float>( buffer.data( ), buffer.size( ), t_codec );
+			REQUIRE( copy.extent( 0 ) == view.extent( 0 ) );
+			REQUIRE( copy.extent( 1 ) == view.extent( 1 ) );
+			for( size_t i = 0; i < view.extent( 0 ); ++i )
+			{
+				for( size_t j = 0; j < view.extent( 1 ); ++j )
+				{
+					REQUIRE( copy( i, j ) == view( i, j ) );
+				}
+			}
+		}
+	}
+} // namespace
+
+TEST_CASE( "nd_serialize - Round trip", "[nd_serialize][copy]" )
+{
+	auto source = iota_array( 3, 4 );
+
+	SECTION( "Contiguous arrays are viewed in place" )
+	{
+		const auto buffer = serialized( source.as_span( ) );
+		REQUIRE( buffer.size( ) == 64 + 12 * sizeof( float ) );
+
+		const auto info = read_serial_header( buffer.data( ), buffer.size( ) );
+		REQUIRE( info.kind == 'f' );
+		REQUIRE( info.element_size == 4 );
+		REQUIRE( info.extents == std::vector<size_t> { 3, 4 } );
+		REQUIRE( info.strides.empty( ) );
+		REQUIRE_FALSE( info.compressed( ) );
+		REQUIRE( info.data_offset == 64 );
+
+		const auto view = view_serialized<const float>( buffer.data( ), buffer.size( ) );
+		REQUIRE( static_cast<const void*>( view.data( ) ) == buffer.data( ) + 64 );
+		REQUIRE( view.is_contiguous( ) );
+		REQUIRE( view( 2, 3 ) == source( 2, 3 ) );
+
+		const auto copy = deserialize<float>( buffer.data( ), buffer.size( ) );
+		REQUIRE( copy( 1, 2 ) == source( 1, 2 ) );
+	}
+
+	SECTION( "Transposed views keep their strides" )
+	{
+		const auto buffer = serialized( source.T( ) );
+		const auto info   = read_serial_header( buffer.data( ), buffer.size( ) );
+		REQUIRE( info.strides == std::vector<std::ptrdiff_t> { 1, 4 } );
+
+		const auto view = view_serialized<const float>( buffer.data( ), buffer.size( ) );
+		REQUIRE( view.extent( 0 ) == 4 );
+		REQUIRE( view.stride( 1 ) == 4 );
+		REQUIRE( view( 3, 1 ) == source( 1, 3 ) );
+
+		const auto copy = deserialize<float>( buffer.data( ), buffer.size( ) );
+		REQUIRE( copy.as_span( ).is_contiguous( ) );
+		REQUIRE( copy( 3, 1 ) == source( 1, 3 ) );
+	}
+
+	SECTION( "Strided and reversed views are gathered in row-major order" )
+	{
+		const auto buffer = serialized( source.subspan( 1, { 0, 4 }, 2 ) );
+		const auto view   = view_serialized<const float>( buffer.data( ), buffer.size( ) );
+		REQUIRE( view.extent( 1 ) == 2 );
+		REQUIRE( view.is_contiguous( ) );
+		REQUIRE( view( 2, 1 ) == source( 2, 2 ) );
+
+		const auto flipped = serialized( source.flip( 0 ) );
+		REQUIRE( view_serialized<const float>( flipped.data( ), flipped.size( ) )( 0, 3 ) == source( 2, 3 ) );
+	}
+
+	SECTION( "Writable views over mutable buffers" )
+	{
+		nd_array<std::int16_t> values( 5 );
+		values.fill( 7 );
+		auto buffer = serialized( values.as_span( ) );
+		auto view   = view_serialized<std::int16_t>( buffer.data( ), buffer.size( ) );
+		view( 4 )   = -1;
+		REQUIRE( view_serialized<const std::int16_t>( buffer.data( ), buffer.size( ) )( 4 ) == -1 );
+	}
+
+	SECTION( "Empty arrays" )
+	{
+		const nd_array<double> empty( 0, 3 );
+		const auto buffer = serialized( empty.as_span( ) );
+		REQUIRE( view_serialized<const double>( buffer.data( ), buffer.size( ) ).size( ) == 0 );
+		REQUIRE( deserialize<double>( buffer.data( ), buffer.size( ) ).extent( 1 ) == 3 );
+	}
+}
+
+TEST_CASE( "nd_serialize - Header validation", "[nd_serialize][construction]" )
+{
+	const auto source = iota_array( 3, 4 );
+	auto buffer       = serialized( source.as_span( ) );
+
+	SECTION( "Element type and rank mismatch" )
+	{
+		REQUIRE_THROWS_AS( view_serialized<const double>( buffer.data( ), buffer.size( ) ), std::invalid_argument );
+		REQUIRE_THROWS_AS( view_serialized<const std::int32_t>( buffer.data( ), buffer.size( ) ), std::invalid_argument );
+		REQUIRE_THROWS_AS( ( view_serialized<const float, 1>( buffer.data( ), buffer.size( ) ) ), std::invalid_argument );
+	}
+
+	SECTION( "Malformed and truncated buffers" )
+	{
+		REQUIRE_THROWS_AS( view_serialized<const float>( buffer.data( ), buffer.size( ) - 1 ), std::runtime_error );
+		REQUIRE_THROWS_AS( view_serialized<const float>( buffer.data( ), 30 ), std::runtime_error );
+
+		auto corrupt = buffer;
+		corrupt[0]   = std::byte { 'X' };
+		REQUIRE_THROWS_AS( read_serial_header( corrupt.data( ), corrupt.size( ) ), std::runtime_error );
+
+		corrupt    = buffer;
+		corrupt[4] = std::byte { 9 };
+		REQUIRE_THROWS_AS( read_serial_header( corrupt.data( ), corrupt.size( ) ), std::runtime_error );
+
+		// Extents that disagree with the stored size
+		corrupt     = buffer;
+		corrupt[24] = std::byte { 4 };
+		REQUIRE_THROWS_AS( read_serial_header( corrupt.data( ), corrupt.size( ) ), std::runtime_error );
+	}
+
+	SECTION( "Strides reaching past the elements" )
+	{
+		auto strided = serialized( source.T( ) );
+		strided[48]  = std::byte { 5 };
+		REQUIRE_THROWS_AS( read_serial_header( strided.data( ), strided.size( ) ), std::runtime_error );
+	}
+
+	SECTION( "Misaligned buffers are rejected for views but can be copied" )
+	{
+		std::vector<std::byte> shifted( buffer.size( ) + 1 );
+		std::memcpy( shifted.data( ) + 1, buffer.data( ), buffer.size( ) );
+		REQUIRE_THROWS_AS( view_serialized<const float>( shifted.data( ) + 1, buffer.size( ) ), std::invalid_argument );
+		REQUIRE( deserialize<float>( shifted.data( ) + 1, buffer.size( ) )( 2, 1 ) == source( 2, 1 ) );
+
+		const auto transposed = serialized( source.T( ) );
+		std::vector<std::byte> shifted_transposed( transposed.size( ) + 1 );
+		std::memcpy( shifted_transposed.data( ) + 1, transposed.data( ), transposed.size( ) );
+		REQUIRE( deserialize<float>( shifted_transposed.data( ) + 1, transposed.size( ) )( 3, 1 ) == source( 1, 3 ) );
+	}
+
+	SECTION( "Rank-0 views cannot be serialized" )
+	{
+		std::ostringstream out;
+		REQUIRE_THROWS_AS( serialize( out, nd_array<float>( ).as_span( ) ), std::invalid_argument );
+	}
+}
+
+TEST_CASE( "nd_serialize - Block compression", "[nd_serialize][copy]" )
+{
+	nd_array<std::int32_t> zeros( 100, 50 );
+
+	SECTION( "Compressible blocks shrink" )
+	{
+		const auto buffer = serialized( zeros.as_span( ), rle_codec { }, 4096 );
+		REQUIRE( buffer.size( ) < zeros.size( ) * sizeof( std::int32_t ) / 10 );
+		REQUIRE( read_serial_header( buffer.data( ), buffer.size( ) ).codec == rle_codec::id );
+
+		const auto copy = deserialize<std::int32_t>( buffer.data( ), buffer.size( ), rle_codec { } );
+		REQUIRE( copy.extent( 0 ) == 100 );
+		REQUIRE( copy( 99, 49 ) == 0 );
+	}
+
+	SECTION( "Compressed data needs the matching codec" )
+	{
+		const auto buffer = serialized( zeros.as_span( ), rle_codec { } );
+		REQUIRE_THROWS_AS( view_serialized<const std::int32_t>( buffer.data( ), buffer.size( ) ), std::invalid_argument );
+		REQUIRE_THROWS_AS( deserialize<std::int32_t>( buffer.data( ), buffer.size( ) ), std::invalid_argument );
+		REQUIRE_THROWS_AS( deserialize<std::int32_t>( buffer.data( ), buffer.size( ), other_codec { } ), std::invalid_argument );
+		REQUIRE_THROWS_AS( deserialize<std::int32_t>( buffer.data( ), buffer.size( ) - 1, rle_codec { } ), std::runtime_error );
+	}
+
+	SECTION( "Incompressible blocks are stored raw" )
+	{
+		auto noise = iota_array( 16, 16 );
+		for( size_t i = 0; i < noise.size( ); ++i )
+		{
+			noise.data( )[i] = static_cast<float>( i * 2654435761u % 1000003u ) * 0.37f;
+		}
+		const auto buffer = serialized( noise.as_span( ), rle_codec { }, 100 );
+		// Header, then per block 8 bytes of sizes and the raw bytes
+		REQUIRE( buffer.size( ) == 64 + 11 * 8 + noise.size( ) * sizeof( float ) );
+		REQUIRE( deserialize<float>( buffer.data( ), buffer.size( ), rle_codec { } )( 15, 15 ) == noise( 15, 15 ) );
+	}
+
+	SECTION( "Blocks span gathered rows and column-major data" ) { require_codec_round_trip( rle_codec { } ); }
+
+	SECTION( "Uncompressed data reads with any codec" )
+	{
+		const auto buffer = serialized( zeros.as_span( ) );
+		REQUIRE( deserialize<std::int32_t>( buffer.data( ), buffer.size( ), rle_codec { } ).size( ) == zeros.size( ) );
+	}
+
+	SECTION( "Invalid block sizes" )
+	{
+		std::ostringstream out;
+		REQUIRE_THROWS_AS( serialize( out, zeros.as_span( ), rle_codec { }, 0 ), std::invalid_argument );
+	}
+
+#if defined( ND_ARRAY_USE_LZ4 )
+	SECTION( "LZ4" ) { require_codec_round_trip( lz4_codec { } ); }
+#endif
+#if defined( ND_ARRAY_USE_ZSTD )
+	SECTION( "zstd" ) { require_codec_round_trip( zstd_codec { } ); }
+#endif
+#if defined( ND_ARRAY_USE_ZLIB )
+	SECTION( "Deflate" ) { require_codec_round_trip( zlib_codec { } ); }
+#endif
+}
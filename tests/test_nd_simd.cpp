@@ -0,0 +1,154 @@
+#include "nd_array/nd_expr.hpp"
+#include "nd_array/nd_reduce.hpp"
+#include "nd_array/nd_simd.hpp"
+#include "nd_array/nd_stencil.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+using namespace cppa;
+
+namespace
+{
+	const simd_isa all_isas[] = { simd_isa::scalar, simd_isa::sse2, simd_isa::avx2, simd_isa::avx512, simd_isa::neon };
+
+	// Restores the active instruction set when a test leaves, also on failure
+	struct isa_guard
+	{
+		simd_isa previous = active_simd_isa( );
+		~isa_guard( ) { detail::active_simd_isa_slot( ).store( previous ); }
+	};
+
+	// Runs every bulk kernel once and flattens the results into one vector of int
+	std::vector<std::int64_t> run_kernels( )
+	{
+		std::vector<std::int64_t> result;
+		const auto append = [&result]( const auto& t_array )
+		{
+			for( size_t i = 0; i < t_array.size( ); ++i )
+			{
+				result.push_back( static_cast<std::int64_t>( t_array.data( )[i] ) );
+			}
+		};
+
+		// Odd extents leave a remainder after every vector width
+		nd_array<float> a( 37, 53 );
+		for( size_t i = 0; i < a.size( ); ++i )
+		{
+			a.data( )[i] = static_cast<float>( i % 19 );
+		}
+
+		nd_array<float> filled( 37, 53 );
+		filled.fill( 3.0f );
+		append( filled );
+		filled.fill( par, 5.0f );
+		append( filled );
+
+		nd_array<float> applied( a );
+		applied.apply( []( float t_x ) { return t_x * 3.0f + 1.0f; } );
+		append( applied );
+		applied.apply( par, []( float t_x ) { return t_x * t_x - 2.0f; } );
+		append( applied );
+
+		nd_array<std::int32_t> transformed( 53, 37 );
+		transformed.transform( a.T( ), []( float t_x ) { return static_cast<std::int32_t>( t_x ) * 2; } );
+		append( transformed );
+
+		nd_array<std::int16_t> converted( 53, 37 );
+		converted.copy_from( std::as_const( a ).T( ) );
+		append( converted );
+		converted.copy_from( par, std::as_const( a ).T( ) );
+		append( converted );
+
+		const nd_array<float> expression( a * a + a * 2.0f - 1.0f );
+		append( expression );
+
+		append( cppa::sum( a, { 0 } ) );
+		append( cppa::sum( par, a.T( ), { 1 } ) );
+		result.push_back( static_cast<std::int64_t>( a.reduce( 0.0, std::plus<>( ) ) ) );
+		result.push_back( static_cast<std::int64_t>( a.reduce( par, 0.0, std::plus<>( ) ) ) );
+
+		nd_array<float> weights( 3, 3 );
+		weights.fill( 1.0f );
+		append( correlate( a, weights, boundary_mode::reflect ) );
+		return result;
+	}
+} // namespace
+
+TEST_CASE( "nd_simd - Instruction set selection", "[nd_simd]" )
+{
+	isa_guard guard;
+
+	SECTION( "Names round trip through the parser" )
+	{
+		for( auto isa: all_isas )
+		{
+			simd_isa parsed = simd_isa::scalar;
+			REQUIRE( detail::parse_simd_isa( simd_isa_name( isa ), parsed ) );
+			REQUIRE( parsed == isa );
+		}
+		REQUIRE( std::strcmp( simd_isa_name( simd_isa::avx512 ), "avx512" ) == 0 );
+
+		simd_isa unchanged = simd_isa::avx2;
+		REQUIRE_FALSE( detail::parse_simd_isa( "AVX2", unchanged ) );
+		REQUIRE_FALSE( detail::parse_simd_isa( "", unchanged ) );
+		REQUIRE( unchanged == simd_isa::avx2 );
+	}
+
+	SECTION( "Detected and baseline instruction sets are supported" )
+	{
+		REQUIRE( simd_isa_supported( detected_simd_isa( ) ) );
+		REQUIRE( simd_isa_supported( detail::baseline_simd_isa( ) ) );
+		REQUIRE( simd_isa_supported( active_simd_isa( ) ) );
+		REQUIRE( detected_simd_isa( ) >= detail::baseline_simd_isa( ) );
+	}
+
+	SECTION( "set_simd_isa switches the active path" )
+	{
+		const simd_isa baseline = detail::baseline_simd_isa( );
+		const simd_isa before   = active_simd_isa( );
+		REQUIRE( set_simd_isa( baseline ) == before );
+		REQUIRE( active_simd_isa( ) == baseline );
+		REQUIRE( set_simd_isa( detected_simd_isa( ) ) == baseline );
+		REQUIRE( active_simd_isa( ) == detected_simd_isa( ) );
+	}
+
+	SECTION( "Unsupported instruction sets are rejected" )
+	{
+		const simd_isa before = active_simd_isa( );
+		for( auto isa: all_isas )
+		{
+			if( !simd_isa_supported( isa ) )
+			{
+				REQUIRE_THROWS_AS( set_simd_isa( isa ), std::invalid_argument );
+				REQUIRE( active_simd_isa( ) == before );
+			}
+		}
+		// Each build supports exactly one of the baseline instruction sets
+		REQUIRE_FALSE( ( simd_isa_supported( simd_isa::sse2 ) && simd_isa_supported( simd_isa::neon ) ) );
+	}
+}
+
+TEST_CASE( "nd_simd - Kernels agree on every path", "[nd_simd][parallel]" )
+{
+	isa_guard guard;
+
+	set_simd_isa( detail::baseline_simd_isa( ) );
+	const auto expected = run_kernels( );
+	REQUIRE_FALSE( expected.empty( ) );
+
+	for( auto isa: all_isas )
+	{
+		if( simd_isa_supported( isa ) )
+		{
+			set_simd_isa( isa );
+			REQUIRE( run_kernels( ) == expected );
+		}
+	}
+}
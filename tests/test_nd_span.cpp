@@ -1,8 +1,13 @@
 #include "nd_array/nd_array.hpp"
 
+#include <algorithm>
 #include <array>
 #include <catch2/catch_test_macros.hpp>
+#include <functional>
 #include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 
@@ -144,6 +149,34 @@ TEST_CASE( "nd_span - Element access", "[nd_span][access]" )
 		REQUIRE_THROWS_AS( span( 3, 0 ), std::out_of_range );
 		REQUIRE_THROWS_AS( span( 0, 4 ), std::out_of_range );
 	}
+
+	SECTION( "Unchecked access matches checked access" )
+	{
+		std::array<int, 24> data = { };
+		for( size_t i = 0; i < 24; ++i )
+		{
+			data[i] = static_cast<int>( i );
+		}
+
+		nd_span<int> span( data.data( ), 2, 3, 4 );
+		auto t = span.T( );
+		for( size_t i = 0; i < 2; ++i )
+		{
+			for( size_t j = 0; j < 4; ++j )
+			{
+				for( size_t k = 0; k < 3; ++k )
+				{
+					REQUIRE( &t.unchecked( i, j, k ) == &t( i, j, k ) );
+				}
+			}
+		}
+
+		span.unchecked( 1, 2, 3 ) = 99;
+		REQUIRE( data[23] == 99 );
+
+		const nd_span<int>& cspan = span;
+		REQUIRE( cspan.unchecked( 1, 2, 3 ) == 99 );
+	}
 }
 
 TEST_CASE( "nd_span - Const access", "[nd_span][const]" )
@@ -304,6 +337,29 @@ TEST_CASE( "nd_span - Properties", "[nd_span][properties]" )
 	}
 }
 
+TEST_CASE( "nd_span - Contiguity queries", "[nd_span][properties][stride]" )
+{
+	SECTION( "Contiguous and row-contiguous views" )
+	{
+		std::array<int, 24> data = { };
+		nd_span<int> span( data.data( ), 2, 3, 4 );
+		REQUIRE( span.is_contiguous( ) );
+		REQUIRE( span.has_contiguous_rows( ) );
+
+		auto rows = span.subspan( 1, { 0, 2 } );
+		REQUIRE_FALSE( rows.is_contiguous( ) );
+		REQUIRE( rows.has_contiguous_rows( ) );
+
+		auto cols = span.subspan( 2, { 1, 3 } );
+		REQUIRE_FALSE( cols.is_contiguous( ) );
+		REQUIRE( cols.has_contiguous_rows( ) );
+
+		auto t = span.T( );
+		REQUIRE_FALSE( t.is_contiguous( ) );
+		REQUIRE_FALSE( t.has_contiguous_rows( ) );
+	}
+}
+
 TEST_CASE( "nd_span - Shape transforms", "[nd_span][reshape][transpose][flatten][squeeze]" )
 {
 	SECTION( "Reshape and flatten" )
@@ -619,4 +675,601 @@ TEST_CASE( "nd_span - Stride-aware iteration", "[nd_span][iterators][stride]" )
 		// advance begin by size reaches end
 		REQUIRE( sub.begin( ) + static_cast<std::ptrdiff_t>( sub.size( ) ) == sub.end( ) );
 	}
+
+	SECTION( "Incremental stepping matches nested loops on permuted views" )
+	{
+		std::array<int, 60> data = { };
+		for( size_t i = 0; i < data.size( ); ++i )
+		{
+			data[i] = static_cast<int>( i );
+		}
+
+		nd_span<int> span( data.data( ), 3, 4, 5 );
+		auto view = span.transpose( { 2, 0, 1 } ).subspan( 2, { 1, 3 } ); // extents [5,3,2]
+
+		std::vector<int> expected;
+		for( size_t i = 0; i < view.extent( 0 ); ++i )
+		{
+			for( size_t j = 0; j < view.extent( 1 ); ++j )
+			{
+				for( size_t k = 0; k < view.extent( 2 ); ++k )
+				{
+					expected.push_back( view( i, j, k ) );
+				}
+			}
+		}
+
+		std::vector<int> forward( view.begin( ), view.end( ) );
+		REQUIRE( forward == expected );
+
+		// Walk backwards from end, borrowing across every dimension
+		std::vector<int> backward;
+		for( auto it = view.end( ); it != view.begin( ); )
+		{
+			--it;
+			backward.push_back( *it );
+		}
+		std::reverse( backward.begin( ), backward.end( ) );
+		REQUIRE( backward == expected );
+
+		// Mixing unit steps with random jumps stays consistent
+		auto it = view.begin( );
+		it += 7;
+		++it;
+		REQUIRE( *it == expected[8] );
+		it--;
+		REQUIRE( *it == expected[7] );
+		REQUIRE( it[5] == expected[12] );
+	}
+}
+
+TEST_CASE( "nd_span - Bulk algorithms", "[nd_span][operations][parallel]" )
+{
+	std::vector<int> data( 6 * 8 );
+	nd_span<int> span( data.data( ), 6, 8 );
+
+	SECTION( "Fill through a strided view leaves other elements untouched" )
+	{
+		auto inner = span.subspan( 0, { 1, 5 } ).subspan( 1, { 2, 6 } );
+		inner.fill( parallel_policy { 3 }, 9 );
+		REQUIRE( span( 0, 2 ) == 0 );
+		REQUIRE( span( 1, 1 ) == 0 );
+		REQUIRE( span( 1, 2 ) == 9 );
+		REQUIRE( span( 4, 5 ) == 9 );
+		REQUIRE( span( 4, 6 ) == 0 );
+		REQUIRE( std::count( data.begin( ), data.end( ), 9 ) == 16 );
+	}
+
+	SECTION( "Sequential and parallel reductions agree on a permuted view" )
+	{
+		std::iota( data.begin( ), data.end( ), 1 );
+		auto view        = span.T( ).subspan( 0, { 1, 7 } );
+		const int serial = view.reduce( 0, std::plus<>( ) );
+		int expected     = 0;
+		for( const int value: view )
+		{
+			expected += value;
+		}
+		REQUIRE( serial == expected );
+		REQUIRE( view.reduce( parallel_policy { 4 }, 0, std::plus<>( ) ) == expected );
+		REQUIRE( view.transform_reduce( par, 0, std::plus<>( ), []( int t_value ) { return 2 * t_value; } ) == 2 * expected );
+	}
+
+	SECTION( "Apply, transform and copy between views" )
+	{
+		std::iota( data.begin( ), data.end( ), 0 );
+		span.slice( 0, 2 ).apply( seq, []( int t_value ) { return -t_value; } );
+		REQUIRE( span( 2, 3 ) == -19 );
+		REQUIRE( span( 3, 3 ) == 27 );
+
+		std::vector<int> out( 8 * 6 );
+		nd_span<int> out_span( out.data( ), 8, 6 );
+		out_span.copy_from( parallel_policy { 2 }, span.T( ) );
+		REQUIRE( out_span( 3, 2 ) == -19 );
+		REQUIRE( out_span( 7, 5 ) == span( 5, 7 ) );
+
+		out_span.transform( span.T( ), []( int t_value ) { return t_value + 1; } );
+		REQUIRE( out_span( 0, 1 ) == span( 1, 0 ) + 1 );
+	}
+}
+
+TEST_CASE( "nd_span - Copy between views", "[nd_span][copy][stride]" )
+{
+	std::vector<int> data( 4 * 5 * 6 );
+	std::iota( data.begin( ), data.end( ), 0 );
+	const nd_span<int> cube( data.data( ), 4, 5, 6 );
+
+	// Reference: element-wise copy through the stride-aware iterators
+	auto expect_equal = []( const auto& t_lhs, const auto& t_rhs ) { REQUIRE( std::equal( t_lhs.begin( ), t_lhs.end( ), t_rhs.begin( ), t_rhs.end( ) ) ); };
+
+	SECTION( "Contiguous copy" )
+	{
+		std::vector<int> out( data.size( ) );
+		nd_span<int> dst( out.data( ), 4, 5, 6 );
+		copy( cube, dst );
+		REQUIRE( out == data );
+	}
+
+	SECTION( "Subspan and slice into dense storage" )
+	{
+		const auto sub = cube.subspan( 1, { 1, 4 } ).subspan( 2, { 2, 5 } );
+		std::vector<int> out( 4 * 3 * 3 );
+		nd_span<int> dst( out.data( ), 4, 3, 3 );
+		copy( sub, dst );
+		expect_equal( sub, dst );
+
+		const auto plane = cube.slice( 2, 3 );
+		std::vector<int> plane_out( 4 * 5 );
+		nd_span<int> plane_dst( plane_out.data( ), 4, 5 );
+		plane_dst.copy_from( plane );
+		expect_equal( plane, plane_dst );
+	}
+
+	SECTION( "Permuted source and destination" )
+	{
+		const auto permuted = cube.transpose( { 2, 0, 1 } );
+		std::vector<int> out( data.size( ) );
+		nd_span<int> dst( out.data( ), 6, 4, 5 );
+		copy( permuted, dst );
+		expect_equal( permuted, dst );
+
+		std::vector<int> back( data.size( ) );
+		nd_span<int> back_span( back.data( ), 4, 5, 6 );
+		copy( dst, back_span.transpose( { 2, 0, 1 } ) );
+		REQUIRE( back == data );
+	}
+
+	SECTION( "Converting copy and singleton dimensions" )
+	{
+		std::vector<double> out( 5 );
+		nd_span<double> dst( out.data( ), 1, 5, 1 );
+		copy( cube.subspan( 0, { 2, 3 } ).subspan( 2, { 4, 5 } ), dst );
+		REQUIRE( out[0] == static_cast<double>( cube( 2, 0, 4 ) ) );
+		REQUIRE( out[4] == static_cast<double>( cube( 2, 4, 4 ) ) );
+	}
+
+	SECTION( "Parallel copy matches sequential copy" )
+	{
+		std::vector<int> out( data.size( ) );
+		nd_span<int> dst( out.data( ), 5, 6, 4 );
+		copy( parallel_policy { 3 }, cube.transpose( { 1, 2, 0 } ), dst );
+		expect_equal( cube.transpose( { 1, 2, 0 } ), dst );
+	}
+
+	SECTION( "Mismatched extents throw" )
+	{
+		std::vector<int> out( data.size( ) );
+		nd_span<int> dst( out.data( ), 4, 6, 5 );
+		REQUIRE_THROWS_AS( copy( cube, dst ), std::invalid_argument );
+	}
+}
+
+TEST_CASE( "nd_span - Layout policies", "[nd_span][layout]" )
+{
+	std::vector<double> data( 12 );
+	std::iota( data.begin( ), data.end( ), 0.0 );
+
+	SECTION( "layout_left uses column-major strides" )
+	{
+		nd_span<double, 8, layout_left> left( data.data( ), 3, 4 );
+		REQUIRE( left.stride( 0 ) == 1 );
+		REQUIRE( left.stride( 1 ) == 3 );
+		REQUIRE( left( 2, 1 ) == data[2 + 3 * 1] );
+		REQUIRE( left.is_contiguous( ) );
+		static_assert( std::is_same_v<decltype( left.subspan( 1, { 0, 2 } ) ), nd_span<double, 8, layout_left>> );
+	}
+
+	SECTION( "Iteration follows memory order" )
+	{
+		nd_span<double, 8, layout_left> left( data.data( ), 3, 4 );
+		REQUIRE( std::equal( left.begin( ), left.end( ), data.begin( ) ) );
+		REQUIRE( *( left.begin( ) + 5 ) == data[5] );
+		REQUIRE( *--left.end( ) == data[11] );
+
+		nd_span<double> right( left );
+		REQUIRE_FALSE( right.is_contiguous( ) );
+		REQUIRE( right( 2, 1 ) == left( 2, 1 ) );
+		REQUIRE( *( right.begin( ) + 1 ) == left( 0, 1 ) );
+	}
+
+	SECTION( "Reshape and flatten in column-major order" )
+	{
+		nd_span<double, 8, layout_left> left( data.data( ), 3, 4 );
+		auto reshaped = left.reshape( 2, 6 );
+		REQUIRE( reshaped.stride( 0 ) == 1 );
+		REQUIRE( reshaped.stride( 1 ) == 2 );
+		REQUIRE( reshaped( 1, 3 ) == data[7] );
+		REQUIRE( left.flatten( )( 7 ) == data[7] );
+
+		REQUIRE_THROWS_AS( left.T( ).reshape( 12 ), std::runtime_error );
+	}
+
+	SECTION( "layout_stride accepts any exhaustive ordering" )
+	{
+		nd_span<double> right( data.data( ), 3, 4 );
+		nd_span<double, 8, layout_stride> strided( right.T( ) );
+		REQUIRE( strided.is_contiguous( ) );
+		REQUIRE( strided( 3, 2 ) == right( 2, 3 ) );
+		REQUIRE_THROWS_AS( strided.reshape( 12 ), std::runtime_error );
+
+		nd_span<double, 8, layout_stride> cols( right.subspan( 1, { 0, 2 } ) );
+		REQUIRE_FALSE( cols.is_contiguous( ) );
+	}
+
+	SECTION( "Copies between layouts match by index" )
+	{
+		nd_span<double> right( data.data( ), 3, 4 );
+		std::vector<double> out( 12 );
+		nd_span<double, 8, layout_left> left( out.data( ), 3, 4 );
+		copy( right, left );
+		for( size_t i = 0; i < 3; ++i )
+		{
+			for( size_t j = 0; j < 4; ++j )
+			{
+				REQUIRE( left( i, j ) == right( i, j ) );
+			}
+		}
+		REQUIRE( out[1] == data[4] );
+
+		std::vector<double> back( 12 );
+		nd_span<double>( back.data( ), 3, 4 ).copy_from( left );
+		REQUIRE( back == data );
+	}
+}
+
+TEST_CASE( "nd_span - Memory-order traversal", "[nd_span][iterators][stride]" )
+{
+	std::vector<int> data( 24 );
+	std::iota( data.begin( ), data.end( ), 0 );
+	nd_span<int> cube( data.data( ), 2, 3, 4 );
+
+	const auto visited = []( const nd_span<int>& t_view )
+	{
+		std::vector<int> result;
+		t_view.for_each_in_memory_order( [&result]( const int& t_value ) { result.push_back( t_value ); } );
+		return result;
+	};
+
+	SECTION( "Permuted views are swept linearly" )
+	{
+		REQUIRE( visited( cube.transpose( { 2, 0, 1 } ) ) == data );
+		REQUIRE( visited( cube.T( ) ) == data );
+	}
+
+	SECTION( "Strided views visit each element once in increasing address order" )
+	{
+		const auto expected = std::vector<int> { 1, 2, 5, 6, 9, 10, 13, 14, 17, 18, 21, 22 };
+		REQUIRE( visited( cube.subspan( 2, { 1, 3 } ).T( ) ) == expected );
+		REQUIRE( visited( cube.slice( 1, 2 ) ) == std::vector<int> { 8, 9, 10, 11, 20, 21, 22, 23 } );
+		REQUIRE( visited( nd_span<int>( data.data( ) + 5, 1, 1, 1 ) ) == std::vector<int> { 5 } );
+		REQUIRE( visited( nd_span<int>( data.data( ), { 0, 4 } ) ).empty( ) );
+	}
+
+	SECTION( "Mutation and execution policies" )
+	{
+		cube.T( ).for_each_in_memory_order( []( int& t_value ) { t_value *= 2; } );
+		REQUIRE( data[23] == 46 );
+
+		std::vector<int> counts( 24 );
+		cube.transpose( { 1, 2, 0 } ).for_each_in_memory_order( parallel_policy { 3 }, [&counts, &data]( int& t_value )
+		                                                        { ++counts[static_cast<size_t>( &t_value - data.data( ) )]; } );
+		REQUIRE( std::all_of( counts.begin( ), counts.end( ), []( int t_count ) { return t_count == 1; } ) );
+
+		cube.T( ).fill( par, 7 );
+		REQUIRE( std::all_of( data.begin( ), data.end( ), []( int t_value ) { return t_value == 7; } ) );
+	}
+}
+
+TEST_CASE( "nd_span - Contiguous ranges", "[nd_span][iterators][stride]" )
+{
+	std::vector<int> data( 24 );
+	std::iota( data.begin( ), data.end( ), 0 );
+	nd_span<int> cube( data.data( ), 2, 3, 4 );
+
+	SECTION( "Contiguous views yield raw pointers" )
+	{
+		REQUIRE( cube.is_contiguous_in_order( ) );
+		const auto range = cube.as_contiguous( );
+		static_assert( std::is_same_v<decltype( range.begin( ) ), int*> );
+		REQUIRE( range.data( ) == data.data( ) );
+		REQUIRE( range.size == 24 );
+		REQUIRE( std::equal( range.begin( ), range.end( ), cube.begin( ), cube.end( ) ) );
+
+		const auto inner = cube.subspan( 0, { 1, 2 } ).as_contiguous( );
+		REQUIRE( inner.begin( ) == data.data( ) + 12 );
+		REQUIRE( inner.size == 12 );
+
+		std::sort( range.begin( ), range.end( ), std::greater<>( ) );
+		REQUIRE( cube( 0, 0, 0 ) == 23 );
+
+		const nd_span<int>& view = cube;
+		static_assert( std::is_same_v<decltype( view.as_contiguous( ).begin( ) ), const int*> );
+		REQUIRE( nd_span<int>( data.data( ), { 0, 4 } ).as_contiguous( ).empty( ) );
+	}
+
+	SECTION( "Other views throw" )
+	{
+		REQUIRE_FALSE( cube.T( ).is_contiguous_in_order( ) );
+		REQUIRE_THROWS_AS( cube.T( ).as_contiguous( ), std::runtime_error );
+		REQUIRE_THROWS_AS( cube.subspan( 2, { 0, 2 } ).as_contiguous( ), std::runtime_error );
+		REQUIRE_THROWS_AS( cube.flip( 0 ).as_contiguous( ), std::runtime_error );
+
+		// Dense, but visited in a different order than memory
+		const nd_span<int, 8, layout_stride> permuted( cube.T( ) );
+		REQUIRE( permuted.is_contiguous( ) );
+		REQUIRE_FALSE( permuted.is_contiguous_in_order( ) );
+	}
+
+	SECTION( "Layouts iterate in their own order" )
+	{
+		nd_span<int, 8, layout_left> left( data.data( ), 4, 6 );
+		REQUIRE( left.is_contiguous_in_order( ) );
+		REQUIRE( std::equal( left.as_contiguous( ).begin( ), left.as_contiguous( ).end( ), left.begin( ), left.end( ) ) );
+	}
+
+	SECTION( "with_iterators picks pointers when it can" )
+	{
+		const auto kind = []( auto t_first, auto /*t_last*/ ) { return std::is_pointer_v<decltype( t_first )>; };
+		REQUIRE( cube.with_iterators( kind ) );
+		REQUIRE_FALSE( cube.T( ).with_iterators( kind ) );
+
+		const auto sum = []( auto t_first, auto t_last ) { return std::accumulate( t_first, t_last, 0 ); };
+		REQUIRE( cube.with_iterators( sum ) == 276 );
+		REQUIRE( cube.T( ).with_iterators( sum ) == 276 );
+		REQUIRE( std::as_const( cube ).subspan( 2, { 1, 3 } ).with_iterators( sum ) == 138 );
+
+		cube.T( ).with_iterators( []( auto t_first, auto t_last ) { std::fill( t_first, t_last, 5 ); } );
+		REQUIRE( std::all_of( data.begin( ), data.end( ), []( int t_value ) { return t_value == 5; } ) );
+	}
+}
+
+TEST_CASE( "nd_span - Coalesce", "[nd_span][properties][stride]" )
+{
+	std::vector<int> data( 24 );
+	std::iota( data.begin( ), data.end( ), 0 );
+	nd_span<int> cube( data.data( ), 2, 3, 4 );
+
+	SECTION( "Contiguous views collapse to rank 1" )
+	{
+		auto merged = nd_span<int>( data.data( ), { 1, 1, 1, 24 } ).coalesce( );
+		REQUIRE( merged.rank( ) == 1 );
+		REQUIRE( merged.extent( 0 ) == 24 );
+		REQUIRE( merged.stride( 0 ) == 1 );
+		REQUIRE( cube.coalesce( ).rank( ) == 1 );
+		REQUIRE( cube.inner_block_size( ) == 24 );
+	}
+
+	SECTION( "Only nested neighbours are merged" )
+	{
+		auto rows = cube.subspan( 1, { 0, 2 } ).coalesce( );
+		REQUIRE( rows.rank( ) == 2 );
+		REQUIRE( rows.extent( 0 ) == 2 );
+		REQUIRE( rows.extent( 1 ) == 8 );
+		REQUIRE( rows.stride( 0 ) == 12 );
+		REQUIRE( cube.subspan( 1, { 0, 2 } ).inner_block_size( ) == 8 );
+
+		auto cols = cube.subspan( 2, { 1, 3 } ).coalesce( );
+		REQUIRE( cols.rank( ) == 2 );
+		REQUIRE( cols.extent( 0 ) == 6 );
+		REQUIRE( cols.stride( 0 ) == 4 );
+		REQUIRE( cube.subspan( 2, { 1, 3 } ).inner_block_size( ) == 2 );
+
+		REQUIRE( cube.T( ).coalesce( ).rank( ) == 3 );
+		REQUIRE( cube.T( ).inner_block_size( ) == 1 );
+	}
+
+	SECTION( "Iteration order and elements are unchanged" )
+	{
+		const auto view   = cube.subspan( 1, { 1, 3 } );
+		const auto merged = view.coalesce( );
+		REQUIRE( merged.size( ) == view.size( ) );
+		REQUIRE( std::equal( view.begin( ), view.end( ), merged.begin( ) ) );
+
+		nd_span<int, 8, layout_left> left( data.data( ), 4, 3, 2 );
+		auto left_merged = left.subspan( 1, { 0, 2 } ).coalesce( );
+		REQUIRE( left_merged.rank( ) == 2 );
+		REQUIRE( left_merged.extent( 0 ) == 8 );
+		REQUIRE( left_merged.stride( 1 ) == 12 );
+		REQUIRE( left.subspan( 1, { 0, 2 } ).inner_block_size( ) == 8 );
+	}
+
+	SECTION( "Single and empty views" )
+	{
+		auto single = cube.subspan( 0, { 1, 2 } ).subspan( 1, { 2, 3 } ).subspan( 2, { 3, 4 } ).coalesce( );
+		REQUIRE( single.rank( ) == 1 );
+		REQUIRE( single.size( ) == 1 );
+		REQUIRE( single( 0 ) == 23 );
+
+		nd_span<int> empty( data.data( ), { 0, 4 } );
+		REQUIRE( empty.coalesce( ).rank( ) == 2 );
+		REQUIRE( empty.inner_block_size( ) == 0 );
+	}
+}
+
+TEST_CASE( "nd_span - Step slicing and reversal", "[nd_span][subspan][stride]" )
+{
+	std::vector<int> data( 24 );
+	std::iota( data.begin( ), data.end( ), 0 );
+	nd_span<int> grid( data.data( ), 4, 6 );
+
+	SECTION( "Positive steps decimate without copying" )
+	{
+		auto even = grid.subspan( 1, { 0, 6 }, 2 );
+		REQUIRE( even.extent( 0 ) == 4 );
+		REQUIRE( even.extent( 1 ) == 3 );
+		REQUIRE( even.stride( 1 ) == 2 );
+		REQUIRE( even.data( ) == data.data( ) );
+		REQUIRE( even( 2, 2 ) == grid( 2, 4 ) );
+
+		auto odd_rows = grid.subspan( 0, { 1, 4 }, 2 );
+		REQUIRE( odd_rows.extent( 0 ) == 2 );
+		REQUIRE( odd_rows( 1, 0 ) == grid( 3, 0 ) );
+		REQUIRE_FALSE( even.is_contiguous( ) );
+
+		REQUIRE_THROWS_AS( grid.subspan( 1, { 0, 6 }, 0 ), std::invalid_argument );
+		REQUIRE_THROWS_AS( grid.subspan( 2, { 0, 1 }, 1 ), std::out_of_range );
+	}
+
+	SECTION( "Negative steps and flip walk backwards" )
+	{
+		auto reversed = grid.subspan( 1, { 1, 6 }, -2 );
+		REQUIRE( reversed.extent( 1 ) == 3 );
+		REQUIRE( reversed.stride( 1 ) == -2 );
+		REQUIRE( reversed( 0, 0 ) == grid( 0, 5 ) );
+		REQUIRE( reversed( 0, 2 ) == grid( 0, 1 ) );
+
+		auto mirrored = grid.flip( 0 ).flip( 1 );
+		for( size_t i = 0; i < 4; ++i )
+		{
+			for( size_t j = 0; j < 6; ++j )
+			{
+				REQUIRE( mirrored( i, j ) == grid( 3 - i, 5 - j ) );
+			}
+		}
+		REQUIRE( mirrored.flip( 1 ).flip( 0 ).data( ) == data.data( ) );
+		REQUIRE_THROWS_AS( grid.flip( 2 ), std::out_of_range );
+		REQUIRE_THROWS( mirrored.reshape( { 24 } ) );
+	}
+
+	SECTION( "Algorithms accept reversed views" )
+	{
+		const auto flipped = grid.flip( 1 );
+		std::vector<int> expected;
+		for( size_t i = 0; i < 4; ++i )
+		{
+			for( size_t j = 0; j < 6; ++j )
+			{
+				expected.push_back( grid( i, 5 - j ) );
+			}
+		}
+		REQUIRE( std::equal( flipped.begin( ), flipped.end( ), expected.begin( ), expected.end( ) ) );
+
+		std::vector<int> out_data( 24 );
+		nd_span<int> out( out_data.data( ), 4, 6 );
+		copy( flipped, out );
+		REQUIRE( out_data == expected );
+
+		out.flip( 0 ).copy_from( grid.flip( 0 ) );
+		REQUIRE( std::equal( out_data.begin( ), out_data.end( ), data.begin( ) ) );
+
+		std::vector<const int*> visited;
+		grid.flip( 0 ).for_each_in_memory_order( [&]( const int& t_value ) { visited.push_back( &t_value ); } );
+		REQUIRE( visited.size( ) == 24 );
+		REQUIRE( std::is_sorted( visited.begin( ), visited.end( ) ) );
+
+		grid.subspan( 1, { 0, 6 }, -3 ).fill( -1 );
+		REQUIRE( data[5] == -1 );
+		REQUIRE( data[2] == -1 );
+		REQUIRE( data[3] == 3 );
+	}
+}
+
+TEST_CASE( "nd_span - Broadcasting views", "[nd_span][stride][properties]" )
+{
+	std::vector<int> data( 12 );
+	std::iota( data.begin( ), data.end( ), 0 );
+	nd_span<int> grid( data.data( ), 3, 4 );
+
+	SECTION( "expand_dims inserts singleton dimensions" )
+	{
+		auto column = grid.expand_dims( 1 );
+		REQUIRE( column.rank( ) == 3 );
+		REQUIRE( column.extent( 1 ) == 1 );
+		REQUIRE( column.stride( 1 ) == 0 );
+		REQUIRE( column( 2, 0, 3 ) == grid( 2, 3 ) );
+		REQUIRE( column.is_contiguous( ) );
+		REQUIRE( column.reshape( { 12 } )( 7 ) == 7 );
+
+		REQUIRE( grid.expand_dims( 2 ).extent( 2 ) == 1 );
+		REQUIRE_THROWS_AS( grid.expand_dims( 3 ), std::out_of_range );
+		REQUIRE_THROWS_AS( ( nd_span<int, 2>( data.data( ), 3, 4 ).expand_dims( 0 ) ), std::invalid_argument );
+	}
+
+	SECTION( "broadcast_to repeats elements through zero strides" )
+	{
+		nd_span<int> row( data.data( ), 4 );
+		auto rows = row.broadcast_to( 3, 4 );
+		REQUIRE( rows.rank( ) == 2 );
+		REQUIRE( rows.stride( 0 ) == 0 );
+		REQUIRE( rows.data( ) == data.data( ) );
+		REQUIRE( rows( 2, 3 ) == 3 );
+		REQUIRE_FALSE( rows.is_contiguous( ) );
+		REQUIRE_THROWS( rows.reshape( { 12 } ) );
+
+		auto columns = grid.subspan( 1, { 0, 1 } ).broadcast_to( { 2, 3, 4 } );
+		REQUIRE( columns.extent( 0 ) == 2 );
+		REQUIRE( columns( 1, 2, 3 ) == grid( 2, 0 ) );
+		REQUIRE( std::accumulate( columns.begin( ), columns.end( ), 0 ) == 2 * 4 * ( 0 + 4 + 8 ) );
+
+		std::vector<int> out_data( 12 );
+		nd_span<int> out( out_data.data( ), 3, 4 );
+		out.copy_from( rows );
+		REQUIRE( out( 1, 2 ) == 2 );
+
+		REQUIRE_THROWS_AS( grid.broadcast_to( 3, 5 ), std::invalid_argument );
+		REQUIRE_THROWS_AS( grid.broadcast_to( 4 ), std::invalid_argument );
+		REQUIRE_THROWS_AS( ( nd_span<int, 2>( data.data( ), 3, 4 ).broadcast_to( 2, 3, 4 ) ), std::invalid_argument );
+	}
+}
+
+TEST_CASE( "nd_span - Sliding windows", "[nd_span][stride][view]" )
+{
+	std::vector<int> data( 20 );
+	std::iota( data.begin( ), data.end( ), 0 );
+	nd_span<int> grid( data.data( ), 4, 5 );
+
+	SECTION( "Windows become trailing dimensions" )
+	{
+		auto windows = grid.sliding_window( { 3, 2 } );
+		REQUIRE( windows.rank( ) == 4 );
+		REQUIRE( windows.extent( 0 ) == 2 );
+		REQUIRE( windows.extent( 1 ) == 4 );
+		REQUIRE( windows.extent( 2 ) == 3 );
+		REQUIRE( windows.extent( 3 ) == 2 );
+		REQUIRE( windows.data( ) == data.data( ) );
+		for( size_t i = 0; i < 2; ++i )
+		{
+			for( size_t j = 0; j < 4; ++j )
+			{
+				REQUIRE( windows( i, j, 2, 1 ) == grid( i + 2, j + 1 ) );
+			}
+		}
+		REQUIRE( grid.sliding_window( { 4, 5 } ).size( ) == 20 );
+	}
+
+	SECTION( "Steps skip window positions" )
+	{
+		auto tiles = grid.sliding_window( { 2, 2 }, { 2, 3 } );
+		REQUIRE( tiles.extent( 0 ) == 2 );
+		REQUIRE( tiles.extent( 1 ) == 2 );
+		REQUIRE( tiles.stride( 0 ) == 10 );
+		REQUIRE( tiles.stride( 1 ) == 3 );
+		REQUIRE( tiles( 1, 1, 0, 0 ) == grid( 2, 3 ) );
+		REQUIRE( tiles( 1, 1, 1, 1 ) == grid( 3, 4 ) );
+	}
+
+	SECTION( "Windows of strided views keep their strides" )
+	{
+		auto windows = grid.T( ).sliding_window( { 2, 3 } );
+		REQUIRE( windows.extent( 0 ) == 4 );
+		REQUIRE( windows.extent( 1 ) == 2 );
+		REQUIRE( windows( 3, 1, 1, 2 ) == grid( 3, 4 ) );
+
+		auto reversed = grid.flip( 1 ).sliding_window( { 1, 2 } );
+		REQUIRE( reversed( 0, 0, 0, 1 ) == grid( 0, 3 ) );
+
+		nd_array<int> owned( 3, 3 );
+		owned.fill( 5 );
+		REQUIRE( owned.sliding_window( { 2, 2 }, { 1, 1 } )( 1, 1, 1, 1 ) == 5 );
+	}
+
+	SECTION( "Invalid windows" )
+	{
+		REQUIRE_THROWS_AS( grid.sliding_window( { 5, 1 } ), std::invalid_argument );
+		REQUIRE_THROWS_AS( grid.sliding_window( { 0, 1 } ), std::invalid_argument );
+		REQUIRE_THROWS_AS( grid.sliding_window( { 2 } ), std::invalid_argument );
+		REQUIRE_THROWS_AS( grid.sliding_window( { 2, 2 }, { 1, 0 } ), std::invalid_argument );
+		REQUIRE_THROWS_AS( grid.sliding_window( { 2, 2 }, { 1 } ), std::invalid_argument );
+		REQUIRE_THROWS_AS( ( nd_span<int, 3>( data.data( ), 4, 5 ).sliding_window( { 2, 2 } ) ), std::invalid_argument );
+	}
 }
@@ -0,0 +1,153 @@
+#include "nd_array/nd_linalg.hpp"
+#include "nd_array/nd_stats.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+using namespace cppa;
+
+// The same operations run in every build; without ND_ARRAY_ENABLE_STATS every count must stay zero
+namespace
+{
+	size_t counted( size_t t_count ) { return stats_enabled ? t_count : 0; }
+
+	std::vector<std::string>& trace_log( )
+	{
+		static std::vector<std::string> log;
+		return log;
+	}
+
+	void record_trace( trace_phase t_phase, const char* t_name ) { trace_log( ).push_back( std::string( t_phase == trace_phase::begin ? "+" : "-" ) + t_name ); }
+} // namespace
+
+TEST_CASE( "nd_stats - Counters", "[nd_stats]" )
+{
+	reset_thread_stats( );
+	REQUIRE( thread_stats( ).allocations == 0 );
+	REQUIRE( thread_stats( ).deep_copies == 0 );
+
+	SECTION( "Allocations count heap buffers only" )
+	{
+		nd_array<float> a( 4, 5 );
+		REQUIRE( thread_stats( ).allocations == counted( 1 ) );
+		REQUIRE( thread_stats( ).allocated_bytes == counted( 20 * sizeof( float ) ) );
+
+		const small_nd_array<float, 16> inline_array( 4, 4 );
+		REQUIRE( thread_stats( ).allocations == counted( 1 ) );
+
+		a.resize( { 8, 5 } );
+		REQUIRE( thread_stats( ).allocations == counted( 2 ) );
+		REQUIRE( thread_stats( ).allocated_bytes == counted( 60 * sizeof( float ) ) );
+
+		const nd_array<float> empty;
+		REQUIRE( thread_stats( ).allocations == counted( 2 ) );
+	}
+
+	SECTION( "Deep copies and element-wise copies" )
+	{
+		const nd_array<int> a( 6, 7 );
+		reset_thread_stats( );
+
+		const nd_array<int> copy( a );
+		REQUIRE( thread_stats( ).deep_copies == counted( 1 ) );
+		REQUIRE( thread_stats( ).copied_bytes == counted( 42 * sizeof( int ) ) );
+
+		nd_array<int> assigned( 6, 7 );
+		assigned = a;
+		REQUIRE( thread_stats( ).deep_copies == counted( 2 ) );
+
+		// A contiguous source copies whole rows, a transposed one cannot
+		const nd_array<int> rows( a.subspan( 0, { 1, 4 } ) );
+		REQUIRE( thread_stats( ).deep_copies == counted( 3 ) );
+		REQUIRE( thread_stats( ).element_wise_copies == 0 );
+
+		const nd_array<int> transposed( a.T( ) );
+		const nd_array<int> decimated( a.subspan( 1, { 0, 7 }, 2 ) );
+		REQUIRE( thread_stats( ).deep_copies == counted( 5 ) );
+		REQUIRE( thread_stats( ).element_wise_copies == counted( 2 ) );
+
+		nd_array<int> moved( std::move( assigned ) );
+		REQUIRE( thread_stats( ).deep_copies == counted( 5 ) );
+	}
+
+	SECTION( "Iteration over non-contiguous views and failed reshapes" )
+	{
+		nd_array<int> a( 3, 4 );
+		reset_thread_stats( );
+
+		int sum = 0;
+		for( int value: a.as_span( ) )
+		{
+			sum += value;
+		}
+		for( int value: a.T( ) )
+		{
+			sum += value;
+		}
+		for( auto it = a.subspan( 1, { 1, 3 } ).cbegin( ); it != a.subspan( 1, { 1, 3 } ).cend( ); ++it )
+		{
+			sum += *it;
+		}
+		REQUIRE( sum == 0 );
+		REQUIRE( thread_stats( ).noncontiguous_iterations == counted( 2 ) );
+
+		REQUIRE_THROWS_AS( a.T( ).reshape( { 12 } ), std::runtime_error );
+		REQUIRE( thread_stats( ).reshape_failures == counted( 1 ) );
+		REQUIRE( a.as_span( ).reshape( { 12 } ).size( ) == 12 );
+		REQUIRE( thread_stats( ).reshape_failures == counted( 1 ) );
+	}
+
+	SECTION( "Counters are per thread" )
+	{
+		const nd_array<float> a( 4, 4 );
+		nd_stats other;
+		std::thread worker( [&other] { other = thread_stats( ); } );
+		worker.join( );
+		REQUIRE( other.allocations == 0 );
+		REQUIRE( thread_stats( ).allocations == counted( 1 ) );
+
+		reset_thread_stats( );
+		REQUIRE( thread_stats( ).allocations == 0 );
+	}
+}
+
+TEST_CASE( "nd_stats - Trace callback", "[nd_stats]" )
+{
+	trace_log( ).clear( );
+	REQUIRE( set_trace_callback( record_trace ) == nullptr );
+
+	nd_array<double> a( 3, 3 );
+	nd_array<double> b( 3, 3 );
+	nd_array<double> c( 3, 3 );
+	a.fill( 1.0 );
+	b.as_span( ).fill( par, 2.0 );
+	matmul( a, b, c );
+
+	REQUIRE( set_trace_callback( nullptr ) == record_trace );
+	a.fill( 0.0 );
+
+	if constexpr( stats_enabled )
+	{
+		REQUIRE( trace_log( ) == std::vector<std::string> { "+fill", "-fill", "+fill", "-fill", "+matmul", "-matmul" } );
+	}
+	else
+	{
+		REQUIRE( trace_log( ).empty( ) );
+	}
+
+	SECTION( "Begin and end pair up when an operation throws" )
+	{
+		trace_log( ).clear( );
+		set_trace_callback( record_trace );
+		nd_array<double> wrong( 2, 3 );
+		REQUIRE_THROWS_AS( matmul( a, b, wrong ), std::invalid_argument );
+		set_trace_callback( nullptr );
+		REQUIRE( trace_log( ).size( ) == counted( 2 ) );
+	}
+}
@@ -0,0 +1,239 @@
+#include "nd_array/nd_stencil.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+
+using namespace cppa;
+
+namespace
+{
+	nd_array<int> iota_array( size_t t_rows, size_t t_cols )
+	{
+		nd_array<int> result( t_rows, t_cols );
+		for( size_t i = 0; i < result.size( ); ++i )
+		{
+			result.data( )[i] = static_cast<int>( i * 7 % 11 );
+		}
+		return result;
+	}
+
+	// Element (i, j) of t_src completed by t_mode, indexed one element at a time
+	int padded( const nd_array<int>& t_src, std::ptrdiff_t t_i, std::ptrdiff_t t_j, boundary_mode t_mode, int t_value )
+	{
+		const auto fold = [t_mode]( std::ptrdiff_t t_index, std::ptrdiff_t t_extent ) -> std::ptrdiff_t
+		{
+			while( t_index < 0 || t_index >= t_extent )
+			{
+				switch( t_mode )
+				{
+					case boundary_mode::nearest:
+						return t_index < 0 ? 0 : t_extent - 1;
+					case boundary_mode::reflect:
+						if( t_extent == 1 )
+						{
+							return 0;
+						}
+						t_index = t_index < 0 ? -t_index : 2 * ( t_extent - 1 ) - t_index;
+						break;
+					case boundary_mode::wrap:
+						t_index = t_index < 0 ? t_index + t_extent : t_index - t_extent;
+						break;
+					case boundary_mode::constant:
+						return -1;
+				}
+			}
+			return t_index;
+		};
+		const auto i = fold( t_i, static_cast<std::ptrdiff_t>( t_src.extent( 0 ) ) );
+		const auto j = fold( t_j, static_cast<std::ptrdiff_t>( t_src.extent( 1 ) ) );
+		return i < 0 || j < 0 ? t_value : t_src( static_cast<size_t>( i ), static_cast<size_t>( j ) );
+	}
+
+	nd_array<int> naive_correlate( const nd_array<int>& t_src, const nd_array<int>& t_weights, boundary_mode t_mode, int t_value = 0 )
+	{
+		nd_array<int> result( t_src.extent( 0 ), t_src.extent( 1 ) );
+		const auto di = static_cast<std::ptrdiff_t>( t_weights.extent( 0 ) / 2 );
+		const auto dj = static_cast<std::ptrdiff_t>( t_weights.extent( 1 ) / 2 );
+		for( size_t i = 0; i < t_src.extent( 0 ); ++i )
+		{
+			for( size_t j = 0; j < t_src.extent( 1 ); ++j )
+			{
+				int sum = 0;
+				for( size_t a = 0; a < t_weights.extent( 0 ); ++a )
+				{
+					for( size_t b = 0; b < t_weights.extent( 1 ); ++b )
+					{
+						sum += t_weights( a, b ) * padded( t_src, static_cast<std::ptrdiff_t>( i + a ) - di, static_cast<std::ptrdiff_t>( j + b ) - dj, t_mode, t_value );
+					}
+				}
+				result( i, j ) = sum;
+			}
+		}
+		return result;
+	}
+
+	template<typename Lhs, typename Rhs>
+	bool same_elements( const Lhs& t_lhs, const Rhs& t_rhs )
+	{
+		if( t_lhs.extent( 0 ) != t_rhs.extent( 0 ) || t_lhs.extent( 1 ) != t_rhs.extent( 1 ) )
+		{
+			return false;
+		}
+		for( size_t i = 0; i < t_lhs.extent( 0 ); ++i )
+		{
+			for( size_t j = 0; j < t_lhs.extent( 1 ); ++j )
+			{
+				if( t_lhs( i, j ) != t_rhs( i, j ) )
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	const auto cross = []( const auto& t_w ) { return t_w( -1, 0 ) + t_w( 1, 0 ) + t_w( 0, -1 ) + t_w( 0, 1 ) - 4 * t_w.center( ); };
+} // namespace
+
+TEST_CASE( "nd_stencil - Stencil kernels", "[nd_stencil][operations]" )
+{
+	auto image = iota_array( 9, 13 );
+	nd_array<int> laplace( 3, 3 );
+	laplace( 0, 1 ) = laplace( 1, 0 ) = laplace( 1, 2 ) = laplace( 2, 1 ) = 1;
+	laplace( 1, 1 )                                                     = -4;
+
+	SECTION( "Interior and boundary elements match a padded reference" )
+	{
+		for( auto mode: { boundary_mode::constant, boundary_mode::nearest, boundary_mode::reflect, boundary_mode::wrap } )
+		{
+			nd_array<int> out( 9, 13 );
+			stencil( image, out, { 1, 1 }, mode, cross );
+			REQUIRE( same_elements( out, naive_correlate( image, laplace, mode ) ) );
+		}
+	}
+
+	SECTION( "Constant boundaries use the given value" )
+	{
+		auto out = stencil( image, { 1, 1 }, { boundary_mode::constant, 100 }, cross );
+		static_assert( std::is_same_v<decltype( out ), nd_array<int>> );
+		REQUIRE( same_elements( out, naive_correlate( image, laplace, boundary_mode::constant, 100 ) ) );
+		REQUIRE( out( 0, 0 ) == 200 + image( 1, 0 ) + image( 0, 1 ) - 4 * image( 0, 0 ) );
+	}
+
+	SECTION( "Strided inputs and outputs" )
+	{
+		nd_array<int> out( 9, 13 );
+		stencil( image.T( ), out.T( ), { 1, 1 }, boundary_mode::reflect, cross );
+		REQUIRE( same_elements( out, naive_correlate( image, laplace, boundary_mode::reflect ) ) );
+
+		nd_array<int> sub( 9, 5 );
+		stencil( image.subspan( 1, { 2, 12 }, 2 ), sub, { 1, 1 }, boundary_mode::nearest, cross );
+		REQUIRE( same_elements( sub, naive_correlate( nd_array<int>( image.subspan( 1, { 2, 12 }, 2 ) ), laplace, boundary_mode::nearest ) ) );
+	}
+
+	SECTION( "Halos wider than the extents" )
+	{
+		auto tiny = iota_array( 2, 3 );
+		for( auto mode: { boundary_mode::constant, boundary_mode::nearest, boundary_mode::reflect, boundary_mode::wrap } )
+		{
+			auto out = stencil( tiny, { 4, 4 }, mode, []( const auto& t_w ) { return t_w( -4, 3 ) + 2 * t_w( 4, -4 ); } );
+			for( size_t i = 0; i < 2; ++i )
+			{
+				for( size_t j = 0; j < 3; ++j )
+				{
+					const auto si = static_cast<std::ptrdiff_t>( i );
+					const auto sj = static_cast<std::ptrdiff_t>( j );
+					REQUIRE( out( i, j ) == padded( tiny, si - 4, sj + 3, mode, 0 ) + 2 * padded( tiny, si + 4, sj - 4, mode, 0 ) );
+				}
+			}
+		}
+	}
+
+	SECTION( "Rank 1 and rank 3" )
+	{
+		nd_array<std::int64_t> line( 10 );
+		for( size_t i = 0; i < 10; ++i )
+		{
+			line( i ) = static_cast<std::int64_t>( i * i );
+		}
+		auto diff = stencil( line, { 1 }, boundary_mode::nearest, []( const auto& t_w ) { return t_w( 1 ) - t_w( -1 ); } );
+		REQUIRE( diff( 0 ) == 1 );
+		REQUIRE( diff( 5 ) == 36 - 16 );
+		REQUIRE( diff( 9 ) == 81 - 64 );
+
+		nd_array<int> volume( 4, 5, 6 );
+		volume.fill( 1 );
+		auto count = stencil( volume, { 1, 1, 1 }, boundary_mode::constant,
+		                      []( const auto& t_w ) { return t_w( -1, 0, 0 ) + t_w( 1, 0, 0 ) + t_w( 0, -1, 0 ) + t_w( 0, 1, 0 ) + t_w( 0, 0, -1 ) + t_w( 0, 0, 1 ); } );
+		REQUIRE( count( 0, 0, 0 ) == 3 );
+		REQUIRE( count( 0, 2, 3 ) == 5 );
+		REQUIRE( count( 2, 2, 3 ) == 6 );
+		REQUIRE( count( 3, 4, 5 ) == 3 );
+	}
+
+	SECTION( "Mismatched arguments" )
+	{
+		nd_array<int> wrong( 9, 12 );
+		REQUIRE_THROWS_AS( stencil( image, wrong, { 1, 1 }, boundary_mode::nearest, cross ), std::invalid_argument );
+		REQUIRE_THROWS_AS( stencil( image, { 1 }, boundary_mode::nearest, cross ), std::invalid_argument );
+	}
+}
+
+TEST_CASE( "nd_stencil - Correlation", "[nd_stencil][parallel]" )
+{
+	auto image = iota_array( 37, 41 );
+	nd_array<int> weights( 3, 4 );
+	for( size_t i = 0; i < weights.size( ); ++i )
+	{
+		weights.data( )[i] = static_cast<int>( i ) - 5;
+	}
+
+	SECTION( "Even and odd weight extents" )
+	{
+		for( auto mode: { boundary_mode::constant, boundary_mode::nearest, boundary_mode::reflect, boundary_mode::wrap } )
+		{
+			REQUIRE( same_elements( correlate( image, weights, mode ), naive_correlate( image, weights, mode ) ) );
+		}
+
+		nd_array<int> box( 5, 1 );
+		box.fill( 1 );
+		REQUIRE( same_elements( correlate( image, box ), naive_correlate( image, box, boundary_mode::constant ) ) );
+	}
+
+	SECTION( "Parallel and strided" )
+	{
+		const auto expected = naive_correlate( image, weights, boundary_mode::reflect );
+		nd_array<int> out( 37, 41 );
+		correlate( parallel_policy { 4 }, image, weights, out, boundary_mode::reflect );
+		REQUIRE( same_elements( out, expected ) );
+
+		nd_array<int> transposed( 41, 37 );
+		correlate( par, image.T( ), weights.T( ), transposed.T( ).T( ), boundary_mode::reflect );
+		REQUIRE( same_elements( transposed.T( ), expected ) );
+	}
+
+	SECTION( "Weights of another type and flipped weights" )
+	{
+		nd_array<double> half( 1, 3 );
+		half.fill( 0.5 );
+		auto smoothed = correlate( image, half, boundary_mode::nearest );
+		static_assert( std::is_same_v<decltype( smoothed ), nd_array<double>> );
+		REQUIRE( smoothed( 3, 0 ) == 0.5 * ( 2 * image( 3, 0 ) + image( 3, 1 ) ) );
+
+		nd_array<int> shift( 1, 3 );
+		shift( 0, 2 ) = 1;
+		auto left  = correlate( image, shift, boundary_mode::wrap );
+		auto right = correlate( image, shift.flip( 1 ), boundary_mode::wrap );
+		REQUIRE( left( 4, 7 ) == image( 4, 8 ) );
+		REQUIRE( right( 4, 7 ) == image( 4, 6 ) );
+		REQUIRE( right( 4, 0 ) == image( 4, 40 ) );
+	}
+
+	SECTION( "Invalid weights" )
+	{
+		REQUIRE_THROWS_AS( correlate( image, nd_array<int>( 3 ) ), std::invalid_argument );
+	}
+}
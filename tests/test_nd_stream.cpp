@@ -0,0 +1,144 @@
+#include "nd_array/nd_stream.hpp"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+
+using namespace cppa;
+
+namespace
+{
+	// Fills batch n with n * 100 + flat index, writing t_last_rows rows into batch t_count - 1
+	batch_stream<int>::fill_function numbered_batches( size_t t_count, size_t t_last_rows )
+	{
+		auto next = std::make_shared<size_t>( 0 );
+		return [next, t_count, t_last_rows]( nd_span<int> t_batch ) -> size_t
+		{
+			if( *next == t_count )
+			{
+				return 0;
+			}
+			const size_t rows = *next + 1 == t_count ? t_last_rows : t_batch.extent( 0 );
+			size_t i          = 0;
+			for( auto& value: t_batch )
+			{
+				value = static_cast<int>( *next * 100 + i++ );
+			}
+			++*next;
+			return rows;
+		};
+	}
+} // namespace
+
+TEST_CASE( "nd_stream - Batch streaming", "[nd_stream][parallel]" )
+{
+	SECTION( "Batches arrive in order, the last one short" )
+	{
+		batch_stream<int> stream( { 4, 3 }, numbered_batches( 5, 2 ) );
+		REQUIRE( stream.buffer_count( ) == 2 );
+		REQUIRE( stream.extents( ).size == 2 );
+
+		std::set<const int*> buffers;
+		size_t count = 0;
+		while( auto batch = stream.next( ) )
+		{
+			REQUIRE( batch.sequence( ) == count );
+			const auto view = batch.view( );
+			REQUIRE( view.rank( ) == 2 );
+			REQUIRE( view.extent( 0 ) == ( count == 4 ? 2 : 4 ) );
+			REQUIRE( batch.rows( ) == view.extent( 0 ) );
+			REQUIRE( view( 1, 2 ) == static_cast<int>( count * 100 + 5 ) );
+			buffers.insert( view.data( ) );
+			++count;
+		}
+		REQUIRE( count == 5 );
+		// No buffer is allocated after construction
+		REQUIRE( buffers.size( ) == 2 );
+
+		// The end is sticky
+		REQUIRE_FALSE( stream.next( ) );
+		REQUIRE( stream.next( ).rows( ) == 0 );
+	}
+
+	SECTION( "The producer stays at most buffer_count batches ahead" )
+	{
+		std::atomic<size_t> filled { 0 };
+		batch_stream<float> stream(
+		    std::vector<size_t> { 2, 2 },
+		    [&filled]( nd_span<float> t_batch ) -> size_t
+		    {
+			    t_batch.fill( 1.0f );
+			    return ++filled <= 10 ? t_batch.extent( 0 ) : 0;
+		    },
+		    3 );
+
+		std::vector<batch_stream<float>::batch> held;
+		for( int i = 0; i < 3; ++i )
+		{
+			held.push_back( stream.next( ) );
+			REQUIRE( held.back( ) );
+		}
+		// All buffers are leased, so the producer cannot fill a fourth batch
+		REQUIRE( filled.load( ) <= 4 );
+		held.clear( );
+
+		size_t rest = 0;
+		while( auto batch = stream.next( ) )
+		{
+			batch.release( );
+			REQUIRE_FALSE( batch );
+			++rest;
+		}
+		REQUIRE( rest == 7 );
+	}
+
+	SECTION( "Exceptions of the fill function end the stream" )
+	{
+		size_t calls = 0;
+		batch_stream<int> stream( { 2 },
+		                          [&calls]( nd_span<int> t_batch ) -> size_t
+		                          {
+			                          if( ++calls == 3 )
+			                          {
+				                          throw std::runtime_error( "read failed" );
+			                          }
+			                          return t_batch.extent( 0 );
+		                          } );
+		REQUIRE( stream.next( ) );
+		REQUIRE( stream.next( ) );
+		REQUIRE_THROWS_AS( stream.next( ), std::runtime_error );
+		REQUIRE_THROWS_AS( stream.next( ), std::runtime_error );
+	}
+
+	SECTION( "Destroying a stream that is still filling" )
+	{
+		std::atomic<size_t> calls { 0 };
+		{
+			batch_stream<int> stream( { 16, 16 },
+			                          [&calls]( nd_span<int> t_batch ) -> size_t
+			                          {
+				                          ++calls;
+				                          return t_batch.extent( 0 );
+			                          } );
+			auto first = stream.next( );
+			REQUIRE( first.view( ).size( ) == 256 );
+		}
+		REQUIRE( calls.load( ) >= 1 );
+	}
+
+	SECTION( "Invalid arguments" )
+	{
+		const auto fill = []( nd_span<int> /*t_batch*/ ) -> size_t { return 0; };
+		REQUIRE_THROWS_AS( batch_stream<int>( { 4 }, fill, 0 ), std::invalid_argument );
+		REQUIRE_THROWS_AS( batch_stream<int>( { 4 }, batch_stream<int>::fill_function( ) ), std::invalid_argument );
+		REQUIRE_THROWS_AS( batch_stream<int>( std::vector<size_t>( ), fill ), std::invalid_argument );
+
+		const batch_stream<int>::batch empty;
+		REQUIRE_FALSE( empty );
+		REQUIRE_THROWS_AS( empty.view( ), std::logic_error );
+	}
+}
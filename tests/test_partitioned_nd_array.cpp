@@ -0,0 +1,231 @@
+#include "nd_array/partitioned_nd_array.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+
+using namespace cppa;
+
+namespace
+{
+	// Sets every owned element to its global flat index
+	void fill_global_index( partitioned_nd_array<int>& t_grid )
+	{
+		const size_t cols = t_grid.extents( ).data[1];
+		t_grid.for_each_part(
+		    [&t_grid, cols]( size_t t_part, nd_span<int> t_local )
+		    {
+			    const size_t first = t_grid.owned_range( t_part ).first;
+			    for( size_t i = 0; i < t_local.extent( 0 ); ++i )
+			    {
+				    for( size_t j = 0; j < t_local.extent( 1 ); ++j )
+				    {
+					    t_local( i, j ) = static_cast<int>( ( first + i ) * cols + j );
+				    }
+			    }
+		    } );
+	}
+} // namespace
+
+TEST_CASE( "partitioned_nd_array - Partitioning", "[partitioned_nd_array][construction]" )
+{
+	SECTION( "The split axis is divided as evenly as possible" )
+	{
+		partitioned_nd_array<int> grid( { 10, 4 }, 3 );
+		REQUIRE( grid.part_count( ) == 3 );
+		REQUIRE( grid.owned_range( 0 ) == std::pair<size_t, size_t> { 0, 4 } );
+		REQUIRE( grid.owned_range( 1 ) == std::pair<size_t, size_t> { 4, 7 } );
+		REQUIRE( grid.owned_range( 2 ) == std::pair<size_t, size_t> { 7, 10 } );
+		REQUIRE( grid.part_of( 3 ) == 0 );
+		REQUIRE( grid.part_of( 4 ) == 1 );
+		REQUIRE( grid.part_of( 9 ) == 2 );
+
+		REQUIRE( grid.local( 1 ).extent( 0 ) == 3 );
+		REQUIRE( grid.local( 1 ).is_contiguous( ) );
+		REQUIRE( grid.local( 0 ).data( ) != grid.local( 1 ).data( ) );
+		REQUIRE( grid( 9, 3 ) == 0 );
+	}
+
+	SECTION( "Global indices reach the owning part" )
+	{
+		partitioned_nd_array<int> grid( { 10, 4 }, 3 );
+		fill_global_index( grid );
+		REQUIRE( grid( 0, 0 ) == 0 );
+		REQUIRE( grid( 5, 2 ) == 22 );
+		REQUIRE( grid.local( 1 )( 1, 2 ) == 22 );
+		grid( 7, 1 ) = -1;
+		REQUIRE( grid.local( 2 )( 0, 1 ) == -1 );
+		REQUIRE_THROWS_AS( grid( 10, 0 ), std::out_of_range );
+		REQUIRE_THROWS_AS( grid( 0, 4 ), std::out_of_range );
+		REQUIRE_THROWS_AS( grid( 1 ), std::out_of_range );
+	}
+
+	SECTION( "Splitting another axis" )
+	{
+		partition_options options;
+		options.axis = 1;
+		partitioned_nd_array<float> grid( std::vector<size_t> { 3, 8, 2 }, 2, options );
+		REQUIRE( grid.axis( ) == 1 );
+		REQUIRE( grid.local( 1 ).extent( 0 ) == 3 );
+		REQUIRE( grid.local( 1 ).extent( 1 ) == 4 );
+		grid( 2, 5, 1 ) = 3.0f;
+		REQUIRE( grid.local( 1 )( 2, 1, 1 ) == 3.0f );
+	}
+
+	SECTION( "Invalid arguments" )
+	{
+		partition_options wide;
+		wide.halo = 4;
+		partition_options axis;
+		axis.axis = 2;
+		REQUIRE_THROWS_AS( partitioned_nd_array<int>( { 10, 4 }, 0 ), std::invalid_argument );
+		REQUIRE_THROWS_AS( partitioned_nd_array<int>( { 10, 4 }, 11 ), std::invalid_argument );
+		REQUIRE_THROWS_AS( partitioned_nd_array<int>( { 10, 4 }, 3, wide ), std::invalid_argument );
+		REQUIRE_THROWS_AS( partitioned_nd_array<int>( { 10, 4 }, 3, axis ), std::invalid_argument );
+		REQUIRE_THROWS_AS( partitioned_nd_array<int>( std::vector<size_t>( ), 1 ), std::invalid_argument );
+
+		partitioned_nd_array<int> grid( { 10, 4 }, 3 );
+		REQUIRE_THROWS_AS( grid.local( 3 ), std::out_of_range );
+		REQUIRE_THROWS_AS( grid.owned_range( 3 ), std::out_of_range );
+	}
+}
+
+TEST_CASE( "partitioned_nd_array - Halo exchange", "[partitioned_nd_array][stride]" )
+{
+	partition_options options;
+	options.halo = 2;
+
+	SECTION( "Ghost layers receive the neighbouring boundary layers" )
+	{
+		partitioned_nd_array<int> grid( { 12, 5 }, 3, options );
+		REQUIRE( grid.local_with_halo( 0 ).extent( 0 ) == 6 );
+		REQUIRE( grid.local_with_halo( 1 ).extent( 0 ) == 8 );
+		REQUIRE( grid.local_with_halo( 2 ).extent( 0 ) == 6 );
+		REQUIRE( grid.local( 1 ).data( ) == grid.local_with_halo( 1 ).data( ) + 2 * 5 );
+
+		fill_global_index( grid );
+		grid.exchange_halos( );
+
+		// Every row of a padded part holds its global row, ghost rows included
+		for( size_t p = 0; p < 3; ++p )
+		{
+			const auto padded      = grid.local_with_halo( p );
+			const size_t first_row = grid.owned_range( p ).first - ( p > 0 ? 2 : 0 );
+			for( size_t i = 0; i < padded.extent( 0 ); ++i )
+			{
+				REQUIRE( padded( i, 4 ) == static_cast<int>( ( first_row + i ) * 5 + 4 ) );
+			}
+		}
+	}
+
+	SECTION( "Hooks see every face in a fixed order" )
+	{
+		partitioned_nd_array<int> grid( { 12, 5 }, 3, options );
+		std::vector<std::pair<size_t, size_t>> order;
+		grid.exchange_halos(
+		    [&order]( const partitioned_nd_array<int>::transfer_type& t_transfer )
+		    {
+			    REQUIRE( t_transfer.source.extent( 0 ) == 2 );
+			    REQUIRE( t_transfer.target.extent( 1 ) == 5 );
+			    REQUIRE( ( t_transfer.side == halo_side::lower ) == ( t_transfer.target_part > t_transfer.source_part ) );
+			    order.emplace_back( t_transfer.source_part, t_transfer.target_part );
+		    } );
+		REQUIRE( order == std::vector<std::pair<size_t, size_t>> { { 0, 1 }, { 1, 0 }, { 1, 2 }, { 2, 1 } } );
+	}
+
+	SECTION( "Parts split across processes exchange through the hook" )
+	{
+		// Two "processes" holding one part each, connected by a mailbox instead of MPI
+		partition_options left_options  = options;
+		partition_options right_options = options;
+		left_options.local_parts        = { 0, 1 };
+		right_options.local_parts       = { 1, 2 };
+		partitioned_nd_array<int> left( { 8, 3 }, 2, left_options );
+		partitioned_nd_array<int> right( { 8, 3 }, 2, right_options );
+		REQUIRE( left.is_local( 0 ) );
+		REQUIRE_FALSE( left.is_local( 1 ) );
+		REQUIRE_THROWS_AS( left.local( 1 ), std::out_of_range );
+		REQUIRE_THROWS_AS( left( 5, 0 ), std::out_of_range );
+
+		left.local( 0 ).fill( 1 );
+		right.local( 1 ).fill( 2 );
+
+		std::vector<nd_array<int>> mailbox;
+		const auto send = [&mailbox]( const partitioned_nd_array<int>::transfer_type& t_transfer )
+		{
+			if( t_transfer.source.data( ) != nullptr )
+			{
+				REQUIRE( t_transfer.target.data( ) == nullptr );
+				mailbox.emplace_back( t_transfer.source );
+			}
+		};
+		left.exchange_halos( send );
+		right.exchange_halos( send );
+		REQUIRE( mailbox.size( ) == 2 );
+
+		size_t received = 0;
+		const auto receive = [&mailbox, &received]( const partitioned_nd_array<int>::transfer_type& t_transfer )
+		{
+			if( t_transfer.target.data( ) != nullptr )
+			{
+				// The left part sent first, so its layer is the first message
+				auto target = t_transfer.target;
+				target.copy_from( mailbox[t_transfer.source_part == 0 ? 0 : 1].as_span( ) );
+				++received;
+			}
+		};
+		left.exchange_halos( receive );
+		right.exchange_halos( receive );
+		REQUIRE( received == 2 );
+		REQUIRE( left.local_with_halo( 0 )( 5, 2 ) == 2 );
+		REQUIRE( right.local_with_halo( 1 )( 0, 0 ) == 1 );
+	}
+}
+
+TEST_CASE( "partitioned_nd_array - Parallel parts", "[partitioned_nd_array][parallel]" )
+{
+	std::mutex mutex;
+	std::vector<std::thread::id> placed( 4 );
+	partition_options options;
+	options.placement = [&mutex, &placed]( size_t t_part )
+	{
+		const std::lock_guard<std::mutex> lock( mutex );
+		placed[t_part] = std::this_thread::get_id( );
+	};
+	partitioned_nd_array<double> grid( { 64, 16 }, 4, options );
+	REQUIRE( std::set<std::thread::id>( placed.begin( ), placed.end( ) ).size( ) == 4 );
+
+	std::vector<std::thread::id> ran( 4 );
+	grid.for_each_part( par,
+	                    [&ran, &placed]( size_t t_part, nd_span<double> t_local )
+	                    {
+		                    // The placement function runs again on each worker before its part
+		                    REQUIRE( std::this_thread::get_id( ) == placed[t_part] );
+		                    ran[t_part] = std::this_thread::get_id( );
+		                    t_local.fill( static_cast<double>( t_part ) );
+	                    } );
+	REQUIRE( std::set<std::thread::id>( ran.begin( ), ran.end( ) ).count( std::this_thread::get_id( ) ) == 0 );
+	REQUIRE( grid( 63, 15 ) == 3.0 );
+	REQUIRE( grid( 16, 0 ) == 1.0 );
+
+	SECTION( "Exceptions are rethrown after all parts finished" )
+	{
+		size_t finished = 0;
+		REQUIRE_THROWS_AS( grid.for_each_part( par,
+		                                       [&mutex, &finished]( size_t t_part, nd_span<double> /*t_local*/ )
+		                                       {
+			                                       if( t_part == 2 )
+			                                       {
+				                                       throw std::runtime_error( "part failed" );
+			                                       }
+			                                       const std::lock_guard<std::mutex> lock( mutex );
+			                                       ++finished;
+		                                       } ),
+		                   std::runtime_error );
+		REQUIRE( finished == 3 );
+	}
+}
@@ -0,0 +1,153 @@
+#include "nd_array/shared_nd_array.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace cppa;
+
+namespace
+{
+	nd_array<int> iota_array( size_t t_rows, size_t t_cols )
+	{
+		nd_array<int> result( t_rows, t_cols );
+		for( size_t i = 0; i < result.size( ); ++i )
+		{
+			result.data( )[i] = static_cast<int>( i );
+		}
+		return result;
+	}
+} // namespace
+
+TEST_CASE( "shared_nd_array - Shared ownership", "[shared][construction][view]" )
+{
+	auto source      = iota_array( 4, 6 );
+	const auto* data = source.data( );
+
+	SECTION( "Moving an array in does not copy" )
+	{
+		shared_nd_array<int> shared( std::move( source ) );
+		REQUIRE( shared.data( ) == data );
+		REQUIRE( shared.rank( ) == 2 );
+		REQUIRE( shared.extent( 1 ) == 6 );
+		REQUIRE( shared( 3, 5 ) == 23 );
+		REQUIRE( shared.use_count( ) == 1 );
+
+		auto copy = shared;
+		REQUIRE( copy.data( ) == data );
+		REQUIRE( shared.use_count( ) == 2 );
+		REQUIRE_FALSE( shared.is_unique( ) );
+	}
+
+	SECTION( "Copying an array in makes a deep copy" )
+	{
+		shared_nd_array<int> shared( source );
+		REQUIRE( shared.data( ) != data );
+		REQUIRE( shared( 1, 1 ) == 7 );
+	}
+
+	SECTION( "Views keep the buffer alive" )
+	{
+		shared_nd_array<int> row;
+		shared_nd_array<int> column;
+		{
+			shared_nd_array<int> shared( std::move( source ) );
+			row    = shared.slice( 0, 2 );
+			column = shared.T( ).subspan( 0, { 1, 5 }, 2 ).slice( 0, 1 );
+			REQUIRE( shared.use_count( ) == 3 );
+		}
+		REQUIRE( row.use_count( ) == 2 );
+		REQUIRE( row.rank( ) == 1 );
+		REQUIRE( row( 4 ) == 16 );
+		REQUIRE( column.extent( 0 ) == 4 );
+		REQUIRE( column( 2 ) == 15 );
+		REQUIRE( row.data( ) == data + 12 );
+	}
+
+	SECTION( "Empty handles" )
+	{
+		shared_nd_array<int> empty;
+		REQUIRE( empty.size( ) == 0 );
+		REQUIRE( empty.use_count( ) == 0 );
+		REQUIRE( empty.is_unique( ) );
+		REQUIRE( empty.to_array( ).size( ) == 0 );
+		REQUIRE( empty.as_mutable_span( ).size( ) == 0 );
+	}
+
+	SECTION( "Invalid views throw like nd_span" )
+	{
+		shared_nd_array<int> shared( std::move( source ) );
+		REQUIRE_THROWS_AS( shared.slice( 2, 0 ), std::out_of_range );
+		REQUIRE_THROWS_AS( shared.transpose( { 0, 0 } ), std::invalid_argument );
+		REQUIRE_THROWS_AS( shared.T( ).reshape( { 24 } ), std::runtime_error );
+		REQUIRE( shared.reshape( { 2, 12 } )( 1, 0 ) == 12 );
+	}
+}
+
+TEST_CASE( "shared_nd_array - Copy on write", "[shared][copy]" )
+{
+	shared_nd_array<int> frame( iota_array( 4, 6 ) );
+	const auto* data = frame.data( );
+
+	SECTION( "Unique handles write in place" )
+	{
+		frame.as_mutable_span( )( 0, 0 ) = -1;
+		REQUIRE( frame.data( ) == data );
+		REQUIRE( frame( 0, 0 ) == -1 );
+	}
+
+	SECTION( "Shared handles copy before writing" )
+	{
+		auto consumer = frame;
+		auto span     = consumer.as_mutable_span( );
+		span( 1, 2 )  = -1;
+		REQUIRE( consumer.data( ) != data );
+		REQUIRE( consumer( 1, 2 ) == -1 );
+		REQUIRE( frame( 1, 2 ) == 8 );
+		REQUIRE( frame.is_unique( ) );
+		REQUIRE( consumer.is_unique( ) );
+
+		// The copy is unique now, further writes stay in place
+		const auto* copied = consumer.data( );
+		consumer.as_mutable_span( ).fill( 3 );
+		REQUIRE( consumer.data( ) == copied );
+	}
+
+	SECTION( "Writing to a view copies only the view" )
+	{
+		auto roi = frame.subspan( 0, { 1, 3 } ).T( );
+		roi.as_mutable_span( ).fill( 0 );
+		REQUIRE( roi.size( ) == 12 );
+		REQUIRE( roi.extent( 0 ) == 6 );
+		REQUIRE( roi.view( ).is_contiguous( ) );
+		REQUIRE( roi( 5, 1 ) == 0 );
+		REQUIRE( frame( 1, 0 ) == 6 );
+		REQUIRE( frame.use_count( ) == 1 );
+	}
+
+	SECTION( "Handles can be read from several threads" )
+	{
+		std::vector<std::thread> workers;
+		std::vector<long> sums( 4, 0 );
+		for( size_t t = 0; t < sums.size( ); ++t )
+		{
+			workers.emplace_back(
+			    [handle = frame, &sums, t]( ) mutable
+			    {
+				    for( size_t i = 0; i < handle.extent( 1 ); ++i )
+				    {
+					    sums[t] += handle( t, i );
+				    }
+				    handle.as_mutable_span( ).fill( 0 );
+			    } );
+		}
+		for( auto& worker: workers )
+		{
+			worker.join( );
+		}
+		REQUIRE( sums[3] == 18 + 19 + 20 + 21 + 22 + 23 );
+		REQUIRE( frame( 3, 5 ) == 23 );
+		REQUIRE( frame.data( ) == data );
+	}
+}
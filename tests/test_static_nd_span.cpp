@@ -0,0 +1,119 @@
+#include "nd_array/nd_array.hpp"
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+
+using namespace cppa;
+
+// Fully static views carry nothing but the pointer
+static_assert( sizeof( static_nd_span<float, extents<4, 4>> ) == sizeof( float* ), "Fully static view must be pointer-sized" );
+static_assert( sizeof( static_nd_span<float, extents<dynamic_extent, 4>> ) == sizeof( float* ) + sizeof( size_t ), "Only dynamic extents are stored" );
+static_assert( extents<3, dynamic_extent, 5>::rank( ) == 3, "Rank of extents" );
+static_assert( extents<3, dynamic_extent, 5>::rank_dynamic( ) == 1, "Dynamic rank of extents" );
+static_assert( std::is_same_v<dextents<2>, extents<dynamic_extent, dynamic_extent>>, "dextents expands to dynamic extents" );
+static_assert( extents<2, 3>( ).extent( 1 ) == 3, "Static extents are usable in constant expressions" );
+
+TEST_CASE( "static_nd_span - Construction", "[static_nd_span][construction]" )
+{
+	SECTION( "Fully static extents" )
+	{
+		std::array<int, 9> data = { };
+		static_nd_span<int, extents<3, 3>> tile( data.data( ) );
+		REQUIRE( tile.rank( ) == 2 );
+		REQUIRE( tile.extent( 0 ) == 3 );
+		REQUIRE( tile.extent( 1 ) == 3 );
+		REQUIRE( tile.size( ) == 9 );
+	}
+
+	SECTION( "Mixed static and dynamic extents" )
+	{
+		std::array<int, 24> data = { };
+		static_nd_span<int, extents<2, dynamic_extent, 4>> view( data.data( ), 3 );
+		REQUIRE( view.extent( 1 ) == 3 );
+		REQUIRE( view.stride( 0 ) == 12 );
+		REQUIRE( view.stride( 1 ) == 4 );
+		REQUIRE( view.stride( 2 ) == 1 );
+
+		static_nd_span<int, extents<2, dynamic_extent, 4>> all( data.data( ), 2, 3, 4 );
+		REQUIRE( all.size( ) == 24 );
+		REQUIRE_THROWS_AS( ( static_nd_span<int, extents<2, dynamic_extent, 4>>( data.data( ), 2, 3, 5 ) ), std::invalid_argument );
+	}
+
+	SECTION( "From a contiguous nd_span" )
+	{
+		std::array<int, 12> data = { };
+		nd_span<int> span( data.data( ), 3, 4 );
+		static_nd_span<int, extents<dynamic_extent, 4>> view( span );
+		REQUIRE( view.extent( 0 ) == 3 );
+		REQUIRE( view.data( ) == data.data( ) );
+
+		REQUIRE_THROWS_AS( ( static_nd_span<int, extents<3, 4, 1>>( span ) ), std::invalid_argument );
+		REQUIRE_THROWS_AS( ( static_nd_span<int, extents<3, 5>>( span ) ), std::invalid_argument );
+		REQUIRE_THROWS_AS( ( static_nd_span<int, extents<4, 3>>( span.T( ) ) ), std::runtime_error );
+	}
+}
+
+TEST_CASE( "static_nd_span - Element access", "[static_nd_span][access]" )
+{
+	SECTION( "Row-major indexing" )
+	{
+		std::array<int, 24> data = { };
+		for( size_t i = 0; i < data.size( ); ++i )
+		{
+			data[i] = static_cast<int>( i );
+		}
+
+		static_nd_span<int, extents<2, 3, 4>> view( data.data( ) );
+		int counter = 0;
+		for( size_t i = 0; i < 2; ++i )
+		{
+			for( size_t j = 0; j < 3; ++j )
+			{
+				for( size_t k = 0; k < 4; ++k )
+				{
+					REQUIRE( view( i, j, k ) == counter );
+					REQUIRE( view.unchecked( i, j, k ) == counter );
+					++counter;
+				}
+			}
+		}
+	}
+
+	SECTION( "Out of bounds access throws" )
+	{
+		std::array<int, 16> data = { };
+		static_nd_span<int, extents<4, 4>> tile( data.data( ) );
+		REQUIRE_THROWS_AS( tile( 4, 0 ), std::out_of_range );
+		REQUIRE_THROWS_AS( tile( 0, 4 ), std::out_of_range );
+		REQUIRE_THROWS_AS( tile.extent( 2 ), std::out_of_range );
+	}
+
+	SECTION( "Contiguous iteration" )
+	{
+		std::array<int, 6> data = { 1, 2, 3, 4, 5, 6 };
+		static_nd_span<int, extents<2, 3>> view( data.data( ) );
+		std::vector<int> values( view.begin( ), view.end( ) );
+		REQUIRE( values == std::vector<int> { 1, 2, 3, 4, 5, 6 } );
+	}
+}
+
+TEST_CASE( "static_nd_span - Conversion to nd_span", "[static_nd_span][span]" )
+{
+	SECTION( "Implicit conversion keeps extents and strides" )
+	{
+		std::array<int, 12> data = { };
+		static_nd_span<int, extents<dynamic_extent, 4>> view( data.data( ), 3 );
+		view( 2, 1 ) = 42;
+
+		nd_span<int> span = view;
+		REQUIRE( span.rank( ) == 2 );
+		REQUIRE( span.extent( 0 ) == 3 );
+		REQUIRE( span.stride( 0 ) == 4 );
+		REQUIRE( span( 2, 1 ) == 42 );
+
+		nd_span<const int, 4> cspan = view;
+		REQUIRE( cspan( 2, 1 ) == 42 );
+	}
+}